@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+/**
+ * Many concurrent single-row Inserts into the same table, as found in OLTP workloads. The argument is the table's
+ * insert shard count. With a single shard, all Inserts serialize on the table's append mutex. With (at least) one shard
+ * per thread, they reserve rows in different chunks.
+ */
+static void BM_ConcurrentInserts(benchmark::State& state) {
+  const auto table_name = std::string{"insert_benchmark_table"};
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  // All threads wait for each other before the first iteration, so they see the table created by the first thread.
+  if (state.thread_index() == 0) {
+    if (storage_manager.has_table(table_name)) {
+      storage_manager.drop_table(table_name);
+    }
+
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+    table->set_insert_shard_count(static_cast<uint32_t>(state.range(0)));
+    storage_manager.add_table(table_name, table);
+  }
+
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({int32_t{1}, int32_t{2}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+}
+
+BENCHMARK(BM_ConcurrentInserts)->Arg(1)->Arg(64)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace hyrise
@@ -210,7 +210,8 @@ void registerTableScanSortedBenchmarks() {
       {"FixedStringDictionary", EncodingAndSupportedDataTypes(EncodingType::FixedStringDictionary, {"String"})},
       {"FrameOfReference", EncodingAndSupportedDataTypes(EncodingType::FrameOfReference, {"Int"})},
       {"RunLength", EncodingAndSupportedDataTypes(EncodingType::RunLength, {"Int", "String"})},
-      {"LZ4", EncodingAndSupportedDataTypes(EncodingType::LZ4, {"Int", "String"})}};
+      {"LZ4", EncodingAndSupportedDataTypes(EncodingType::LZ4, {"Int", "String"})},
+      {"FSST", EncodingAndSupportedDataTypes(EncodingType::FSST, {"String"})}};
 
   const std::vector<double> selectivities{0.001, 0.01, 0.1, 0.3, 0.5, 0.7, 0.8, 0.9, 0.99};
 
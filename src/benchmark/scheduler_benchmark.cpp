@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+/**
+ * Schedules `job_count` tiny JobTasks and waits for them. If `spawn_from_worker` is set, the jobs are spawned by a
+ * JobTask, as operators do, and end up in the deque of a worker. Otherwise, the benchmark thread submits them to the
+ * node queues. The time between scheduling a job and the start of its execution is stored in `latencies_ns`.
+ */
+void run_tiny_jobs(const size_t job_count, const bool spawn_from_worker, std::vector<uint64_t>& latencies_ns) {
+  auto counter = std::atomic_uint64_t{0};
+  const auto spawn = [&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+      const auto scheduled = std::chrono::steady_clock::now();
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_id, scheduled]() {
+        latencies_ns[job_id] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - scheduled)
+                                   .count();
+        ++counter;
+      }));
+      jobs.back()->schedule();
+    }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+  };
+
+  if (spawn_from_worker) {
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks({std::make_shared<JobTask>(spawn)});
+  } else {
+    spawn();
+  }
+
+  benchmark::DoNotOptimize(counter.load());
+}
+
+void benchmark_tiny_jobs(benchmark::State& state, const bool spawn_from_worker) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto job_count = static_cast<size_t>(state.range(0));
+  auto latencies_ns = std::vector<uint64_t>(job_count);
+  auto all_latencies_ns = std::vector<uint64_t>{};
+  for (auto _ : state) {
+    run_tiny_jobs(job_count, spawn_from_worker, latencies_ns);
+
+    state.PauseTiming();
+    all_latencies_ns.insert(all_latencies_ns.end(), latencies_ns.begin(), latencies_ns.end());
+    state.ResumeTiming();
+  }
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+
+  // Report the task throughput and the tail latency of starting a job.
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * job_count));
+  std::ranges::sort(all_latencies_ns);
+  const auto percentile = [&](const double fraction) {
+    const auto index = static_cast<size_t>(fraction * static_cast<double>(all_latencies_ns.size() - 1));
+    return static_cast<double>(all_latencies_ns[index]);
+  };
+  state.counters["latency_p50_ns"] = percentile(0.5);
+  state.counters["latency_p99_ns"] = percentile(0.99);
+  state.counters["latency_p999_ns"] = percentile(0.999);
+  state.counters["latency_max_ns"] = static_cast<double>(all_latencies_ns.back());
+}
+
+}  // namespace
+
+namespace hyrise {
+
+/**
+ * Fan-out of tiny jobs spawned by a running task, as done by operators that split their work into JobTasks. The jobs
+ * are pushed to the spawning worker's deque and stolen by the other workers.
+ */
+static void BM_SchedulerTinyJobsSpawnedByWorker(benchmark::State& state) {
+  benchmark_tiny_jobs(state, true);
+}
+
+/**
+ * Tiny jobs submitted by a non-worker thread, which go through the shared node queues.
+ */
+static void BM_SchedulerTinyJobsSubmittedExternally(benchmark::State& state) {
+  benchmark_tiny_jobs(state, false);
+}
+
+BENCHMARK(BM_SchedulerTinyJobsSpawnedByWorker)->RangeMultiplier(10)->Range(100, 100'000)->UseRealTime();
+BENCHMARK(BM_SchedulerTinyJobsSubmittedExternally)->RangeMultiplier(10)->Range(100, 100'000)->UseRealTime();
+
+}  // namespace hyrise
@@ -326,7 +326,56 @@ BENCHMARK_DEFINE_F(TPCHDataMicroBenchmarkFixture, BM_LineitemHistogramCreation)(
   });
 }
 
+/**
+ * Builds histograms from a sample of 10 % of the chunks. Besides the build time, the mean and maximum q-error of
+ * `column <= x` estimates are reported, where x are the bin maxima of the histogram built from the entire column. For
+ * these values, the full histogram's estimates are exact.
+ */
+BENCHMARK_DEFINE_F(TPCHDataMicroBenchmarkFixture, BM_LineitemSampledHistogramCreation)(benchmark::State& state) {
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>();
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+
+  const auto column_id = ColumnID{static_cast<ColumnID::base_type>(state.range(0))};
+  constexpr auto SAMPLING_RATE = 0.1;
+
+  const auto& sm = Hyrise::get().storage_manager;
+  const auto& lineitem_table = sm.get_table("lineitem");
+
+  const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, lineitem_table->row_count() / 2'000));
+
+  const auto column_data_type = lineitem_table->column_data_type(column_id);
+
+  resolve_data_type(column_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    auto sampled_histogram = std::shared_ptr<EqualDistinctCountHistogram<ColumnDataType>>{};
+    for (auto _ : state) {
+      sampled_histogram = EqualDistinctCountHistogram<ColumnDataType>::from_column_sample(
+          *lineitem_table, column_id, histogram_bin_count, SAMPLING_RATE);
+    }
+
+    const auto full_histogram =
+        EqualDistinctCountHistogram<ColumnDataType>::from_column(*lineitem_table, column_id, histogram_bin_count);
+    auto q_error_sum = 0.0;
+    auto q_error_max = 0.0;
+    const auto bin_count = full_histogram->bin_count();
+    for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+      const auto value = AllTypeVariant{full_histogram->bin_maximum(bin_id)};
+      const auto exact = std::max(1.0, full_histogram->estimate_cardinality(PredicateCondition::LessThanEquals, value));
+      const auto estimate =
+          std::max(1.0, sampled_histogram->estimate_cardinality(PredicateCondition::LessThanEquals, value));
+      const auto q_error = std::max(exact / estimate, estimate / exact);
+      q_error_sum += q_error;
+      q_error_max = std::max(q_error_max, q_error);
+    }
+
+    state.counters["mean_q_error"] = q_error_sum / static_cast<double>(bin_count);
+    state.counters["max_q_error"] = q_error_max;
+  });
+}
+
 constexpr auto LINEITEM_COLUMN_COUNT = 15;
 BENCHMARK_REGISTER_F(TPCHDataMicroBenchmarkFixture, BM_LineitemHistogramCreation)->DenseRange(0, LINEITEM_COLUMN_COUNT);
+BENCHMARK_REGISTER_F(TPCHDataMicroBenchmarkFixture, BM_LineitemSampledHistogramCreation)
+    ->DenseRange(0, LINEITEM_COLUMN_COUNT);
 
 }  // namespace hyrise
@@ -0,0 +1,32 @@
+#include "benchmark/benchmark.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+
+namespace hyrise {
+
+/**
+ * Many concurrent short transactions, as found in OLTP workloads. Each transaction registers and deregisters its
+ * snapshot-commit-id at the TransactionManager.
+ */
+static void BM_ShortTransactions(benchmark::State& state) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context(AutoCommit::No);
+    transaction_context->commit();
+  }
+}
+
+static void BM_ShortTransactionsWithLowestSnapshotQuery(benchmark::State& state) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context(AutoCommit::No);
+    benchmark::DoNotOptimize(transaction_manager.get_lowest_active_snapshot_commit_id());
+    transaction_context->commit();
+  }
+}
+
+BENCHMARK(BM_ShortTransactions)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ShortTransactionsWithLowestSnapshotQuery)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace hyrise
@@ -15,6 +15,7 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/constraints/constraint_utils.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -140,6 +141,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
         ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
         encoding_performed = true;
       }
+      place_chunk_on_numa_node(*table, chunk_id);
     };
     jobs.emplace_back(std::make_shared<JobTask>(encode));
   }
@@ -1,5 +1,6 @@
 #include "server/server.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -43,7 +44,9 @@ cxxopts::Options get_server_cli_options() {
                        "at server start (e.g., \"TPC-C:5\", \"TPC-DS:5\", or \"TPC-H:10\"). Supported are TPC-C, "
                        "TPC-DS, and TPC-H. The sizing factor determines the scale factor in TPC-DS and TPC-H, and the "
                        "warehouse count in TPC-C.", cxxopts::value<std::string>())
-    ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false"));  // NOLINT(whitespace/line_length)
+    ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
+    ("max_concurrent_queries", "Maximum number of concurrently executed queries of default priority. Further queries "
+                               "wait until they are admitted. 0 means no limit", cxxopts::value<size_t>()->default_value("0"));  // NOLINT(whitespace/line_length)
   // clang-format on
 
   return cli_options;
@@ -108,13 +111,15 @@ int main(int argc, char* argv[]) {
 
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
+  const auto max_concurrent_queries = parsed_options["max_concurrent_queries"].as<size_t>();
 
   auto error = boost::system::error_code{};
   const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>(), error);
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
-  auto server = hyrise::Server{address, port, static_cast<hyrise::SendExecutionInfo>(execution_info)};
+  auto server = hyrise::Server{address, port, static_cast<hyrise::SendExecutionInfo>(execution_info),
+                               max_concurrent_queries};
   server.run();
 
   return 0;
@@ -5,20 +5,27 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <thread>
+#include <vector>
 
 #include "commit_context.hpp"  // IWYU pragma: keep
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
 
 TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id,
-                                       const AutoCommit is_auto_commit)
+                                       const AutoCommit is_auto_commit, const IsolationLevel isolation_level)
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
       _is_auto_commit{is_auto_commit},
+      _isolation_level{isolation_level},
       _phase{TransactionPhase::Active},
       _num_active_operators{0} {
   Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
@@ -61,6 +68,10 @@ AutoCommit TransactionContext::is_auto_commit() const {
   return _is_auto_commit;
 }
 
+IsolationLevel TransactionContext::isolation_level() const {
+  return _isolation_level;
+}
+
 CommitID TransactionContext::commit_id() const {
   Assert(_commit_context, "TransactionContext CommitID only available after commit context has been created.");
 
@@ -91,9 +102,29 @@ void TransactionContext::rollback(RollbackReason rollback_reason) {
   _mark_as_rolled_back(rollback_reason);
 }
 
+void TransactionContext::register_read_set(const std::vector<std::shared_ptr<const Table>>& read_tables,
+                                           const std::shared_ptr<const Table>& read_rows) {
+  DebugAssert(_isolation_level == IsolationLevel::Serializable, "Only serializable transactions record reads.");
+  const auto lock = std::lock_guard<std::mutex>{_read_set_mutex};
+  _read_tables.insert(read_tables.begin(), read_tables.end());
+  _read_rows.emplace_back(read_rows);
+}
+
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
   _prepare_commit();
 
+  if (!_validate_read_set()) {
+    // The commit id has been assigned already. We still have to mark it as pending (without any modifications) so that
+    // subsequent transactions can commit.
+    _transition(TransactionPhase::Committing, TransactionPhase::Conflicted);
+    for (const auto& op : _read_write_operators) {
+      op->rollback_records();
+    }
+    _mark_as_rolled_back(RollbackReason::Conflict);
+    _mark_as_pending_and_try_commit(callback);
+    return;
+  }
+
   for (const auto& op : _read_write_operators) {
     op->commit_records(commit_id());
   }
@@ -158,16 +189,20 @@ void TransactionContext::_prepare_commit() {
 }
 
 void TransactionContext::_mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback) {
+  // Serializable transactions that failed to validate their read set commit nothing.
+  const auto is_rolled_back = _phase == TransactionPhase::RolledBackAfterConflict;
   if constexpr (HYRISE_DEBUG) {
+    const auto expected_state = is_rolled_back ? ReadWriteOperatorState::RolledBack : ReadWriteOperatorState::Committed;
     for (const auto& op : _read_write_operators) {
-      Assert(op->state() == ReadWriteOperatorState::Committed, "All read/write operators must have been committed.");
+      Assert(op->state() == expected_state, "All read/write operators must have been committed or rolled back.");
     }
   }
 
   auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
+  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback, is_rolled_back](auto transaction_id) {
     // If the transaction context still exists, set its phase to Committed.
-    if (auto context_ptr = context_weak_ptr.lock()) {
+    auto context_ptr = context_weak_ptr.lock();
+    if (context_ptr && !is_rolled_back) {
       context_ptr->_transition(TransactionPhase::Committing, TransactionPhase::Committed);
     }
 
@@ -179,6 +214,79 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
   Hyrise::get().transaction_manager._try_increment_last_commit_id(_commit_context);
 }
 
+bool TransactionContext::_validate_read_set() const {
+  if (_isolation_level == IsolationLevel::SnapshotIsolation || _read_rows.empty()) {
+    return true;
+  }
+
+  // Wait for all transactions that are serialized before this one. Since they have committed their modifications, the
+  // MVCC data of the read tables is final for all commit ids lower than ours.
+  const auto commit_id = this->commit_id();
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  while (transaction_manager.last_commit_id() + 1 < commit_id) {
+    std::this_thread::yield();
+  }
+
+  // Uncommitted rows, including the ones modified by this transaction, have MAX_COMMIT_ID as begin or end CID.
+  const auto committed_concurrently = [&](const CommitID row_commit_id) {
+    return row_commit_id > _snapshot_commit_id && row_commit_id < commit_id;
+  };
+
+  // Deleted (or updated) rows that this transaction has read.
+  for (const auto& read_rows : _read_rows) {
+    const auto chunk_count = read_rows->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = read_rows->get_chunk(chunk_id);
+      if (chunk->column_count() == 0) {
+        continue;
+      }
+
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(ColumnID{0}));
+      const auto& referenced_table = *reference_segment.referenced_table();
+      for (const auto& row_id : *reference_segment.pos_list()) {
+        const auto referenced_chunk = referenced_table.get_chunk(row_id.chunk_id);
+        // Chunks are only removed physically once no active transaction can see them anymore.
+        if (!referenced_chunk) {
+          continue;
+        }
+
+        const auto& mvcc_data = *referenced_chunk->mvcc_data();
+        const auto max_end_cid = mvcc_data.max_end_cid.load();
+        if (max_end_cid != MAX_COMMIT_ID && max_end_cid > _snapshot_commit_id &&
+            committed_concurrently(mvcc_data.get_end_cid(row_id.chunk_offset))) {
+          return false;
+        }
+      }
+    }
+  }
+
+  // Phantoms: rows that were inserted into the read tables. Only chunks with recent inserts have to be scanned.
+  for (const auto& table : _read_tables) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      const auto& mvcc_data = *chunk->mvcc_data();
+      const auto max_begin_cid = mvcc_data.max_begin_cid.load();
+      if (max_begin_cid == MAX_COMMIT_ID || max_begin_cid <= _snapshot_commit_id) {
+        continue;
+      }
+
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (committed_concurrently(mvcc_data.get_begin_cid(chunk_offset))) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 void TransactionContext::on_operator_started() {
   ++_num_active_operators;
 }
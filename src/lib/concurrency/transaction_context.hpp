@@ -3,6 +3,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 #include <vector>
 
 #include "types.hpp"
@@ -11,6 +13,7 @@ namespace hyrise {
 
 class AbstractReadWriteOperator;
 class CommitContext;
+class Table;
 
 /**
  * @brief Overview of the different transaction phases
@@ -31,10 +34,13 @@ class CommitContext;
  *     +------------+                    | Committing |                   | RolledBackByUser |
  *           |                           +------------+                   +------------------+
  *   Rollback operators                        |
- *           |                           Commit operators
- *  +-------------------------+                |
- *  | RolledBackAfterConflict |       Wait for all previous
- *  +-------------------------+    transaction to be committed
+ *           |                           Validate read set -------+
+ *           |                           (only Serializable)      |
+ *           |                                 |                  | IF (a read row was modified concurrently)
+ *  +-------------------------+          Commit operators         |
+ *  | RolledBackAfterConflict |                |           Continue as Conflicted
+ *  +-------------------------+       Wait for all previous
+ *                                 transaction to be committed
  *                                             |
  *                                       +-----------+
  *                                       | Committed |
@@ -57,12 +63,25 @@ std::ostream& operator<<(std::ostream& stream, const TransactionPhase& phase);
 
 /**
  * @brief Representation of a transaction
+ *
+ * By default, transactions run with snapshot isolation: the read/write operators only detect write-write conflicts,
+ * but read-write anomalies such as write skew are possible. Serializable transactions additionally validate their
+ * reads optimistically. Each Validate operator of a serializable transaction registers the tables it reads from and
+ * its output, i.e., the positions of all rows the transaction has seen. When a serializable transaction with
+ * modifications commits, it waits until all transactions with a lower commit id have committed. It then checks that
+ * none of the rows it has read was deleted and that no row was inserted into the read tables by a transaction that
+ * committed after its snapshot. Otherwise, the transaction is rolled back and ends as RolledBackAfterConflict. Since
+ * the commit ids give the serialization order, read-only transactions never have to be validated.
+ *
+ * Phantoms are detected per table, not per predicate: any concurrent insert into a table that was read invalidates
+ * the transaction. Transactions with snapshot isolation neither record nor validate reads.
  */
 class TransactionContext : public std::enable_shared_from_this<TransactionContext> {
   friend class TransactionManager;
 
  public:
-  TransactionContext(TransactionID transaction_id, CommitID snapshot_commit_id, AutoCommit is_auto_commit);
+  TransactionContext(TransactionID transaction_id, CommitID snapshot_commit_id, AutoCommit is_auto_commit,
+                     IsolationLevel isolation_level = IsolationLevel::SnapshotIsolation);
   ~TransactionContext();
 
   /**
@@ -88,6 +107,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   AutoCommit is_auto_commit() const;
 
+  IsolationLevel isolation_level() const;
+
   /**
    * Returns the current phase of the transaction
    */
@@ -116,7 +137,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * Blocks until transaction is actually committed.
+   * Blocks until transaction is actually committed. Serializable transactions can fail to commit if their read set is
+   * invalidated. Callers have to check the phase afterwards.
    */
   void commit();
 
@@ -134,6 +156,13 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
     return _read_write_operators;
   }
 
+  /**
+   * Used by Validate operators of serializable transactions to record what has been read: the stored tables that are
+   * scanned and the validated rows of these tables as a reference table. Thread-safe.
+   */
+  void register_read_set(const std::vector<std::shared_ptr<const Table>>& read_tables,
+                         const std::shared_ptr<const Table>& read_rows);
+
   /**
    * @defgroup Update the counter of active operators
    * @{
@@ -188,6 +217,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**@}*/
 
+  /**
+   * Waits until all transactions with a lower commit id have committed. Returns false if one of them deleted a row
+   * from the read set or inserted into a read table. Always succeeds for transactions with snapshot isolation.
+   */
+  bool _validate_read_set() const;
+
   void _wait_for_active_operators_to_finish() const;
 
   /**
@@ -199,9 +234,14 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
   const AutoCommit _is_auto_commit;
+  const IsolationLevel _isolation_level;
 
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
 
+  std::unordered_set<std::shared_ptr<const Table>> _read_tables;
+  std::vector<std::shared_ptr<const Table>> _read_rows;
+  std::mutex _read_set_mutex;
+
   std::atomic<TransactionPhase> _phase;
   std::shared_ptr<CommitContext> _commit_context;
 
@@ -2,9 +2,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 #include "commit_context.hpp"
 #include "transaction_context.hpp"
@@ -19,7 +22,7 @@ TransactionManager::TransactionManager()
       _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
 
 TransactionManager::~TransactionManager() {
-  Assert(_active_snapshot_commit_ids.empty(),
+  Assert(get_lowest_active_snapshot_commit_id() == std::nullopt,
          "Some transactions do not seem to have finished yet as they are still registered as active.");
 }
 
@@ -27,7 +30,12 @@ TransactionManager& TransactionManager::operator=(TransactionManager&& transacti
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
   _last_commit_context = transaction_manager._last_commit_context;
-  _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
+  for (auto slot_id = size_t{0}; slot_id < ACTIVE_SNAPSHOT_SLOT_COUNT; ++slot_id) {
+    _active_snapshot_slots[slot_id].snapshot_commit_id =
+        transaction_manager._active_snapshot_slots[slot_id].snapshot_commit_id.load();
+  }
+  _overflowing_snapshot_commit_ids = transaction_manager._overflowing_snapshot_commit_ids;
+  _overflowing_snapshot_commit_id_count = transaction_manager._overflowing_snapshot_commit_id_count.load();
   return *this;
 }
 
@@ -35,40 +43,68 @@ CommitID TransactionManager::last_commit_id() const {
   return _last_commit_id;
 }
 
-std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(const AutoCommit auto_commit) {
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
+    const AutoCommit auto_commit, const IsolationLevel isolation_level) {
   const CommitID snapshot_commit_id = _last_commit_id;
-  return std::make_shared<TransactionContext>(TransactionID{_next_transaction_id++}, snapshot_commit_id, auto_commit);
+  return std::make_shared<TransactionContext>(TransactionID{_next_transaction_id++}, snapshot_commit_id, auto_commit,
+                                              isolation_level);
 }
 
 void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
-}
+  DebugAssert(snapshot_commit_id != MAX_COMMIT_ID, "MAX_COMMIT_ID is not a valid snapshot-commit-id.");
 
-void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+  const auto first_slot_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  for (auto probe = size_t{0}; probe < ACTIVE_SNAPSHOT_SLOT_COUNT; ++probe) {
+    auto& slot = _active_snapshot_slots[(first_slot_id + probe) % ACTIVE_SNAPSHOT_SLOT_COUNT].snapshot_commit_id;
+    auto expected_commit_id = MAX_COMMIT_ID;
+    if (slot.load() == MAX_COMMIT_ID && slot.compare_exchange_strong(expected_commit_id, snapshot_commit_id)) {
+      return;
+    }
+  }
 
-  auto it = std::ranges::find(_active_snapshot_commit_ids, snapshot_commit_id);
+  const auto lock = std::lock_guard<std::mutex>{_overflowing_snapshot_commit_ids_mutex};
+  _overflowing_snapshot_commit_ids.insert(snapshot_commit_id);
+  ++_overflowing_snapshot_commit_id_count;
+}
 
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
-    return;
+void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
+  // Usually, a transaction is deregistered by the thread that registered it. Thus, we start searching at the same slot.
+  const auto first_slot_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  for (auto probe = size_t{0}; probe < ACTIVE_SNAPSHOT_SLOT_COUNT; ++probe) {
+    auto& slot = _active_snapshot_slots[(first_slot_id + probe) % ACTIVE_SNAPSHOT_SLOT_COUNT].snapshot_commit_id;
+    auto expected_commit_id = snapshot_commit_id;
+    if (slot.load() == snapshot_commit_id && slot.compare_exchange_strong(expected_commit_id, MAX_COMMIT_ID)) {
+      return;
+    }
   }
 
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+  const auto lock = std::lock_guard<std::mutex>{_overflowing_snapshot_commit_ids_mutex};
+  const auto iter = _overflowing_snapshot_commit_ids.find(snapshot_commit_id);
+  Assert(iter != _overflowing_snapshot_commit_ids.end(),
+         "Could not find snapshot_commit_id in TransactionManager's active snapshot-commit-ids. Therefore, the removal "
+         "failed and the function should not have been called.");
+  _overflowing_snapshot_commit_ids.erase(iter);
+  --_overflowing_snapshot_commit_id_count;
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+  auto lowest_commit_id = MAX_COMMIT_ID;
+  for (const auto& slot : _active_snapshot_slots) {
+    lowest_commit_id = std::min(lowest_commit_id, slot.snapshot_commit_id.load());
+  }
+
+  if (_overflowing_snapshot_commit_id_count > 0) {
+    const auto lock = std::lock_guard<std::mutex>{_overflowing_snapshot_commit_ids_mutex};
+    for (const auto snapshot_commit_id : _overflowing_snapshot_commit_ids) {
+      lowest_commit_id = std::min(lowest_commit_id, snapshot_commit_id);
+    }
+  }
 
-  if (_active_snapshot_commit_ids.empty()) {
+  if (lowest_commit_id == MAX_COMMIT_ID) {
     return std::nullopt;
   }
 
-  return std::ranges::min(_active_snapshot_commit_ids);
+  return lowest_commit_id;
 }
 
 /**
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -59,8 +60,11 @@ class TransactionManager : public Noncopyable {
    * @param is_auto_commit declares whether the transaction is created (and will also commit) automatically. The
    * alternative would be that it was created through a user command (BEGIN). This information is used by the
    * SQLPipelineStatement to auto-commit the transaction - the transaction does not commit itself.
+   * @param isolation_level declares whether the transaction runs with snapshot isolation (the default) or is
+   * serializable, see TransactionContext.
    */
-  std::shared_ptr<TransactionContext> new_transaction_context(const AutoCommit auto_commit);
+  std::shared_ptr<TransactionContext> new_transaction_context(
+      const AutoCommit auto_commit, const IsolationLevel isolation_level = IsolationLevel::SnapshotIsolation);
 
   /**
    * Returns the lowest snapshot-commit-id currently used by a transaction.
@@ -96,7 +100,25 @@ class TransactionManager : public Noncopyable {
 
   std::shared_ptr<CommitContext> _last_commit_context;
 
-  mutable std::mutex _active_snapshot_commit_ids_mutex;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  /**
+   * Transactions are started and finished very frequently, so the active snapshot-commit-ids are not kept in a
+   * mutex-protected container. Instead, each active transaction occupies one of a fixed number of slots, which is
+   * claimed and released with a single compare-and-swap. Free slots hold MAX_COMMIT_ID. The search for a slot starts
+   * at a position derived from the calling thread so that concurrent threads usually claim different slots. Slots are
+   * aligned to cache lines to avoid false sharing. Getting the lowest active snapshot-commit-id scans all slots but
+   * does not block transactions. Since equal snapshot-commit-ids are interchangeable, a transaction can be
+   * deregistered by releasing any slot holding its snapshot-commit-id.
+   * If all slots are occupied, further snapshot-commit-ids are stored in a mutex-protected multiset.
+   */
+  struct alignas(64) ActiveSnapshotSlot {
+    std::atomic<CommitID> snapshot_commit_id{MAX_COMMIT_ID};
+  };
+
+  static constexpr auto ACTIVE_SNAPSHOT_SLOT_COUNT = size_t{256};
+  std::array<ActiveSnapshotSlot, ACTIVE_SNAPSHOT_SLOT_COUNT> _active_snapshot_slots;
+
+  mutable std::mutex _overflowing_snapshot_commit_ids_mutex;
+  std::unordered_multiset<CommitID> _overflowing_snapshot_commit_ids;
+  std::atomic<size_t> _overflowing_snapshot_commit_id_count{0};
 };
 }  // namespace hyrise
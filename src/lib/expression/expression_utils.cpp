@@ -94,6 +94,35 @@ std::vector<std::shared_ptr<AbstractExpression>> expressions_deep_copy(
   return copied_expressions;
 }
 
+std::shared_ptr<AbstractExpression> expression_copy_for_execution(
+    const std::shared_ptr<AbstractExpression>& expression,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) {
+  auto has_execution_state = false;
+
+  visit_expression(expression, [&](const auto& sub_expression) {
+    has_execution_state |= sub_expression->type == ExpressionType::PQPSubquery ||
+                           sub_expression->type == ExpressionType::CorrelatedParameter;
+    return !has_execution_state ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+  });
+
+  if (!has_execution_state) {
+    return expression;
+  }
+
+  return expression->deep_copy(copied_ops);
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> expressions_copy_for_execution(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) {
+  auto copied_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  copied_expressions.reserve(expressions.size());
+  for (const auto& expression : expressions) {
+    copied_expressions.emplace_back(expression_copy_for_execution(expression, copied_ops));
+  }
+  return copied_expressions;
+}
+
 void expression_deep_replace(std::shared_ptr<AbstractExpression>& expression,
                              const ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>& mapping) {
   visit_expression(expression, [&](auto& sub_expression) {
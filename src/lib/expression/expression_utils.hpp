@@ -58,6 +58,21 @@ std::vector<std::shared_ptr<AbstractExpression>> expressions_deep_copy(
     const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops);
 
+/**
+ * Copies an expression of a PQP for another execution of the plan (see AbstractOperator::deep_copy()). Only
+ * expressions that hold per-execution state are deep-copied: PQPSubqueryExpressions own operators, and the values of
+ * CorrelatedParameterExpressions are set via AbstractOperator::set_parameters(). All other PQP expressions are not
+ * modified after construction. Thus, expressions without such state are shared with the original plan.
+ * @param copied_ops is used as in expressions_deep_copy().
+ */
+std::shared_ptr<AbstractExpression> expression_copy_for_execution(
+    const std::shared_ptr<AbstractExpression>& expression,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops);
+
+std::vector<std::shared_ptr<AbstractExpression>> expressions_copy_for_execution(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops);
+
 /**
  * Recurse through the expression and replace them according to @param mapping, where applicable
  */
@@ -7,6 +7,7 @@
 #include "memory/default_memory_resource.hpp"
 #include "scheduler/abstract_scheduler.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/log_manager.hpp"
@@ -36,6 +37,7 @@ Hyrise::Hyrise() {
 
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
+  MorselDispatcher::reset_cost_statistics();
   get() = Hyrise{};
 }
 
@@ -16,10 +16,13 @@
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/dictionary_segment/contiguous_string_vector.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/run_length_segment.hpp"
@@ -30,6 +33,8 @@
 #include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_width_integer/fixed_width_integer_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/enum_constant.hpp"
@@ -57,6 +62,19 @@ pmr_compact_vector BinaryParser::_read_values_compact_vector(std::ifstream& file
   return values;
 }
 
+std::unique_ptr<SimdBp128Vector> BinaryParser::_read_simd_bp128_vector(std::ifstream& file, const size_t count) {
+  const auto block_count = (count + SimdBp128Packing::BLOCK_SIZE - 1) / SimdBp128Packing::BLOCK_SIZE;
+  auto bit_widths = _read_values<uint8_t>(file, block_count);
+
+  auto word_count = size_t{0};
+  for (const auto bit_width : bit_widths) {
+    word_count += SimdBp128Packing::block_word_count(bit_width);
+  }
+  auto data = _read_values<uint32_t>(file, word_count);
+
+  return std::make_unique<SimdBp128Vector>(std::move(data), std::move(bit_widths), count);
+}
+
 template <typename T>
 pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
   auto values = pmr_vector<T>(count);
@@ -94,6 +112,21 @@ pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, co
   return values;
 }
 
+std::shared_ptr<ContiguousStringVector> BinaryParser::_import_contiguous_string_vector(std::ifstream& file,
+                                                                                      const size_t count) {
+  if (count == 0) {
+    return std::make_shared<ContiguousStringVector>();
+  }
+
+  // The strings are stored as in _read_string_values, but read directly into a single buffer.
+  const auto string_lengths = _read_values<size_t>(file, count);
+  auto offsets = pmr_vector<size_t>(count + 1);
+  std::inclusive_scan(string_lengths.cbegin(), string_lengths.cend(), offsets.begin() + 1);
+  auto chars = _read_values<char>(file, offsets.back());
+
+  return std::make_shared<ContiguousStringVector>(std::move(chars), std::move(offsets));
+}
+
 template <typename T>
 T BinaryParser::_read_value(std::ifstream& file) {
   auto result = T{};
@@ -186,6 +219,13 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
@@ -212,7 +252,12 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
                                                                                ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
-  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
+  auto dictionary = std::shared_ptr<typename DictionarySegment<T>::Dictionary>{};
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    dictionary = _import_contiguous_string_vector(file, dictionary_size);
+  } else {
+    dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
+  }
 
   auto attribute_vector = _import_attribute_vector(file, row_count, compressed_vector_type_id);
 
@@ -303,12 +348,38 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
                                          block_size, last_block_size, compressed_size, num_elements);
 }
 
+std::shared_ptr<FSSTSegment<pmr_string>> BinaryParser::_import_fsst_segment(std::ifstream& file,
+                                                                          ChunkOffset row_count) {
+  const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
+
+  const auto symbol_count = _read_value<uint32_t>(file);
+  auto symbols = _read_values<uint64_t>(file, symbol_count);
+  auto symbol_lengths = _read_values<uint8_t>(file, symbol_count);
+  auto symbol_table = FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+
+  const auto compressed_values_size = _read_value<uint32_t>(file);
+  auto compressed_values = _read_values<char>(file, compressed_values_size);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = _read_values<bool>(file, row_count);
+  }
+
+  auto offsets = _import_offset_value_vector(file, row_count, compressed_vector_type_id);
+
+  return std::make_shared<FSSTSegment<pmr_string>>(std::move(symbol_table), std::move(compressed_values),
+                                                   std::move(offsets), std::move(null_values));
+}
+
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
     std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
       return std::make_shared<BitPackingVector>(_read_values_compact_vector<uint32_t>(file, row_count));
+    case CompressedVectorType::SimdBp128:
+      return _read_simd_bp128_vector(file, row_count);
     case CompressedVectorType::FixedWidthInteger1Byte:
       return std::make_shared<FixedWidthIntegerVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
     case CompressedVectorType::FixedWidthInteger2Byte:
@@ -327,6 +398,8 @@ std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_v
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
       return std::make_unique<BitPackingVector>(_read_values_compact_vector<uint32_t>(file, row_count));
+    case CompressedVectorType::SimdBp128:
+      return _read_simd_bp128_vector(file, row_count);
     case CompressedVectorType::FixedWidthInteger1Byte:
       return std::make_unique<FixedWidthIntegerVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
     case CompressedVectorType::FixedWidthInteger2Byte:
@@ -12,11 +12,13 @@
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 namespace hyrise {
 
@@ -89,6 +91,8 @@ class BinaryParser {
   template <typename T>
   static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
 
+  static std::shared_ptr<FSSTSegment<pmr_string>> _import_fsst_segment(std::ifstream& file, ChunkOffset row_count);
+
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given compressed_vector_type_id.
   static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(
       std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
@@ -98,6 +102,9 @@ class BinaryParser {
 
   static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
 
+  static std::shared_ptr<ContiguousStringVector> _import_contiguous_string_vector(std::ifstream& file,
+                                                                                 const size_t count);
+
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
   static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
@@ -106,6 +113,9 @@ class BinaryParser {
   template <typename T>
   static pmr_compact_vector _read_values_compact_vector(std::ifstream& file, const size_t count);
 
+  // Reads the bit widths and the packed blocks of a SimdBp128Vector with count many values.
+  static std::unique_ptr<SimdBp128Vector> _read_simd_bp128_vector(std::ifstream& file, const size_t count);
+
   // Reads row_count many strings from input file. String lengths are encoded in type T.
   static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
 
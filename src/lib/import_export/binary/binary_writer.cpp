@@ -13,10 +13,12 @@
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/dictionary_segment/contiguous_string_vector.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -27,6 +29,7 @@
 #include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_width_integer/fixed_width_integer_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -89,6 +92,19 @@ void export_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values
   export_string_values(ofstream, values);
 }
 
+// Writes the strings in the same format as export_string_values, so that they can be read as pmr_vector<pmr_string>.
+void export_values(std::ofstream& ofstream, const ContiguousStringVector& values) {
+  const auto& offsets = values.offsets();
+  const auto value_count = values.size();
+  auto string_lengths = pmr_vector<size_t>(value_count);
+  for (auto index = size_t{0}; index < value_count; ++index) {
+    string_lengths[index] = offsets[index + 1] - offsets[index];
+  }
+
+  export_values(ofstream, string_lengths);
+  export_values(ofstream, values.chars());
+}
+
 // specialized implementation for bool values
 template <typename Alloc>
 void export_values(std::ofstream& ofstream, const std::vector<bool, Alloc>& values) {
@@ -108,6 +124,12 @@ void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& va
   ofstream.write(reinterpret_cast<const char*>(values.get()), static_cast<int64_t>(values.bytes()));
 }
 
+// The number of blocks and the size of the packed data follow from the row count and the bit widths.
+void export_simd_bp128_vector(std::ofstream& ofstream, const SimdBp128Vector& vector) {
+  export_values(ofstream, vector.bit_widths());
+  export_values(ofstream, vector.data());
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -350,6 +372,36 @@ void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool /*colum
   }
 }
 
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/,
+                                  std::ofstream& ofstream) {
+  export_value(ofstream, EncodingType::FSST);
+
+  // Write offset vector compression id
+  const auto compressed_vector_type_id = _compressed_vector_type_id<T>(fsst_segment);
+  export_value(ofstream, compressed_vector_type_id);
+
+  // Write symbol table
+  const auto& symbol_table = fsst_segment.symbol_table();
+  export_value(ofstream, static_cast<uint32_t>(symbol_table.symbol_count()));
+  export_values(ofstream, symbol_table.symbols());
+  export_values(ofstream, symbol_table.symbol_lengths());
+
+  // Write compressed values
+  export_value(ofstream, static_cast<uint32_t>(fsst_segment.compressed_values().size()));
+  export_values(ofstream, fsst_segment.compressed_values());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ofstream, static_cast<BoolAsByteType>(fsst_segment.null_values().has_value()));
+  if (fsst_segment.null_values()) {
+    // Write NULL values
+    export_values(ofstream, *fsst_segment.null_values());
+  }
+
+  // Write offsets
+  _export_compressed_vector(ofstream, *fsst_segment.compressed_vector_type(), *fsst_segment.offsets());
+}
+
 template <typename T>
 CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
     const AbstractEncodedSegment& abstract_encoded_segment) {
@@ -362,6 +414,7 @@ CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
       case CompressedVectorType::FixedWidthInteger2Byte:
       case CompressedVectorType::FixedWidthInteger1Byte:
       case CompressedVectorType::BitPacking:
+      case CompressedVectorType::SimdBp128:
         compressed_vector_type_id = static_cast<uint8_t>(*compressed_vector_type);
         break;
       default:
@@ -386,6 +439,9 @@ void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const Comp
     case CompressedVectorType::BitPacking:
       export_compact_vector(ofstream, dynamic_cast<const BitPackingVector&>(compressed_vector).data());
       return;
+    case CompressedVectorType::SimdBp128:
+      export_simd_bp128_vector(ofstream, dynamic_cast<const SimdBp128Vector&>(compressed_vector));
+      return;
     default:
       Fail("Any other type should have been caught before.");
   }
@@ -7,6 +7,7 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -222,10 +223,41 @@ class BinaryWriter {
   template <typename T>
   static void _write_segment(const LZ4Segment<T>& lz4_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
 
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Offset vector compr. ID     | CompressedVectorTypeID              | 1
+   * Number of symbols           | uint32_t                            | 4
+   * Symbols                     | vector<uint64_t>                    | Number of symbols * 8
+   * Symbol lengths              | vector<uint8_t>                     | Number of symbols * 1
+   * Size of compressed values   | uint32_t                            | 4
+   * Compressed values           | vector<char>                        | Size of compressed values * 1
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | Rows * 1
+   * Vector compress. bit width² | uint8_t                             | 1
+   * Offsets²                    | uint8_t                             | Rows * (vector compr. bit width) / 8
+   *                                                                     rounded up to next multiple of word (8 byte)
+   * Offsets³                    | uint(8|16|32)_t                     | Rows * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   * ²: This field is only written if the vector compression is BitPacking
+   * ³: This field is only written if the vector compression is FixedWidthInteger
+   */
+  template <typename T>
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
+
   template <typename T>
   static CompressedVectorTypeID _compressed_vector_type_id(const AbstractEncodedSegment& abstract_encoded_segment);
 
-  // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it.
+  // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it. SimdBp128 vectors are
+  // written as the bit widths of their blocks (one byte per block of 128 rows), followed by the packed words
+  // (uint32_t).
   static void _export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
                                         const BaseCompressedVector& compressed_vector);
 };
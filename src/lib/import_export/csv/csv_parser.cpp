@@ -1,11 +1,13 @@
 #include "csv_parser.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <exception>
 #include <fstream>
 #include <ios>
+#include <istream>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -33,13 +35,11 @@ namespace hyrise {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const CsvMeta& csv_meta,
                                         const ChunkOffset chunk_size) {
-  const auto table = _create_table_from_meta(chunk_size, csv_meta);
-
-  auto csvfile = std::ifstream{filename};
+  auto csvfile = std::ifstream{filename, std::ios::binary};
 
   // Return empty table if input file is empty.
   if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') {
-    return table;
+    return _create_table_from_meta(chunk_size, csv_meta);
   }
 
   {
@@ -48,61 +48,38 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const CsvMe
     Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
   }
 
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  auto content = std::string(csvfile_size, ' ');
+  csvfile.clear();
   csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
+  return _parse_stream(csvfile, csv_meta, chunk_size, READ_BLOCK_SIZE);
+}
+
+std::shared_ptr<Table> CsvParser::parse_content(std::string content, const CsvMeta& csv_meta,
+                                                const ChunkOffset chunk_size) {
+  const auto table = _create_table_from_meta(chunk_size, csv_meta);
+
+  if (content.empty()) {
+    return table;
+  }
 
   // The content should end with a delimiter for better row processing later.
   if (content.back() != csv_meta.config.delimiter) {
     content.push_back(csv_meta.config.delimiter);
   }
 
-  auto content_view = std::string_view{content.c_str(), content.size()};
-
   // Save chunks in list to avoid memory relocation.
   auto segments_by_chunks = std::list<Segments>{};
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
-  auto field_ends = std::vector<size_t>{};
   auto append_chunk_mutex = std::mutex{};
   const auto escaped_linebreak =
       std::string(1, csv_meta.config.delimiter_escape) + std::string(1, csv_meta.config.delimiter);
-  while (_find_fields_in_chunk(content_view, *table, field_ends, csv_meta)) {
-    // Create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
-
-    // Only pass the part of the string that is actually needed to the parsing task
-    auto relevant_content = std::string_view{content_view.substr(0, field_ends.back())};
-
-    // Remove processed part of the CSV content
-    content_view = content_view.substr(field_ends.back() + 1);
-
-    // Create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends = std::move(field_ends), &table,
-                                                  &segments, &csv_meta, &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, csv_meta, escaped_linebreak,
-                        append_chunk_mutex);
-    }));
-    tasks.back()->schedule();
-    field_ends = std::vector<size_t>{};
-  }
 
+  auto in_quotes = false;
+  const auto row_ends = _find_row_ends(content, csv_meta, 0, in_quotes);
+  _schedule_chunks(std::make_shared<const std::string>(std::move(content)), row_ends, true, *table, csv_meta,
+                   escaped_linebreak, segments_by_chunks, tasks, append_chunk_mutex);
   Hyrise::get().scheduler()->wait_for_tasks(tasks);
 
-  for (auto& segments : segments_by_chunks) {
-    DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), UNSET_COMMIT_ID);
-    table->append_chunk(segments, mvcc_data);
-    table->last_chunk()->set_immutable();
-  }
-
+  _append_chunks(*table, segments_by_chunks);
   return table;
 }
 
@@ -129,6 +106,240 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
   return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 }
 
+std::shared_ptr<Table> CsvParser::_parse_stream(std::istream& stream, const CsvMeta& meta, const ChunkOffset chunk_size,
+                                                const size_t read_block_size) {
+  Assert(read_block_size > 0, "Read block size must be larger than zero.");
+  const auto table = _create_table_from_meta(chunk_size, meta);
+
+  // Save chunks in list to avoid memory relocation.
+  auto segments_by_chunks = std::list<Segments>{};
+  auto append_chunk_mutex = std::mutex{};
+  const auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
+
+  // The tasks of the current block convert its chunks while the next block is read. Before the block after the next
+  // one is scheduled, we wait for them. Thus, at most two blocks are in memory.
+  auto previous_block_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  // The block holds the rows that could not be scheduled yet. Their row ends and whether the scanned part ends within
+  // a quoted value are kept as well, so that every byte is searched for row ends only once, even if a block has to be
+  // extended several times until it contains a full chunk.
+  auto block = std::string{};
+  auto row_ends = std::vector<size_t>{};
+  auto ends_in_quotes = false;
+  auto is_last_block = false;
+  while (!is_last_block) {
+    const auto scanned_size = block.size();
+    block.resize(scanned_size + read_block_size);
+    stream.read(block.data() + scanned_size, static_cast<std::streamsize>(read_block_size));
+    block.resize(scanned_size + static_cast<size_t>(stream.gcount()));
+    is_last_block = !stream;
+
+    if (block.empty()) {
+      break;
+    }
+
+    // The content should end with a delimiter for better row processing later.
+    if (is_last_block && block.back() != meta.config.delimiter) {
+      block.push_back(meta.config.delimiter);
+    }
+
+    const auto new_row_ends = _find_row_ends(block, meta, scanned_size, ends_in_quotes);
+    row_ends.insert(row_ends.end(), new_row_ends.begin(), new_row_ends.end());
+
+    // Read further data into the same block until it contains at least one full chunk.
+    if (!is_last_block && row_ends.size() < static_cast<size_t>(chunk_size)) {
+      continue;
+    }
+
+    const auto content = std::make_shared<const std::string>(std::move(block));
+    auto block_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    const auto scheduled_row_count = _schedule_chunks(content, row_ends, is_last_block, *table, meta,
+                                                      escaped_linebreak, segments_by_chunks, block_tasks,
+                                                      append_chunk_mutex);
+
+    // Move the remaining rows to the beginning of the next block. The scheduled content is still used by the tasks, so
+    // the tail is copied once into a new buffer that already has room for the next read.
+    const auto scheduled_size = scheduled_row_count == 0 ? size_t{0} : row_ends[scheduled_row_count - 1] + 1;
+    const auto remainder_size = content->size() - scheduled_size;
+    block = std::string{};
+    block.reserve(remainder_size + read_block_size);
+    block.append(content->data() + scheduled_size, remainder_size);
+
+    row_ends.erase(row_ends.begin(), row_ends.begin() + static_cast<std::ptrdiff_t>(scheduled_row_count));
+    for (auto& row_end : row_ends) {
+      row_end -= scheduled_size;
+    }
+
+    Hyrise::get().scheduler()->wait_for_tasks(previous_block_tasks);
+    previous_block_tasks = std::move(block_tasks);
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(previous_block_tasks);
+  Assert(stream.eof(), "Error while reading the CSV file.");
+
+  _append_chunks(*table, segments_by_chunks);
+  return table;
+}
+
+std::vector<size_t> CsvParser::_find_row_ends(std::string_view csv_content, const CsvMeta& meta, const size_t begin,
+                                              bool& in_quotes) {
+  const auto quote = meta.config.quote;
+  const auto delimiter = meta.config.delimiter;
+  const auto escape = meta.config.escape;
+
+  // Same rule as in _find_fields_in_chunk: a quote that follows an escape character (that differs from the quote)
+  // does not start or end a quoted value.
+  const auto is_unescaped_quote = [&](const size_t pos) {
+    return csv_content[pos] == quote && (quote == escape || pos == 0 || csv_content[pos - 1] != escape);
+  };
+
+  const auto content_size = csv_content.size();
+  const auto search_size = content_size - begin;
+  const auto segment_count = std::max(search_size / ROW_SEARCH_SEGMENT_SIZE, size_t{1});
+  const auto segment_size = (search_size + segment_count - 1) / segment_count;
+
+  // Run one task per segment. For small contents, we avoid the scheduling overhead.
+  const auto for_each_segment = [&](const auto& functor) {
+    if (segment_count == 1) {
+      functor(size_t{0});
+      return;
+    }
+
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    tasks.reserve(segment_count);
+    for (auto segment_id = size_t{0}; segment_id < segment_count; ++segment_id) {
+      tasks.emplace_back(std::make_shared<JobTask>([&, segment_id]() {
+        functor(segment_id);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  };
+
+  // First pass: count the unescaped quotes of every segment. The loop has no branches so that it can be vectorized.
+  auto quote_counts = std::vector<size_t>(segment_count);
+  for_each_segment([&](const size_t segment_id) {
+    const auto segment_begin = begin + segment_id * segment_size;
+    const auto segment_end = std::min(segment_begin + segment_size, content_size);
+    const auto* const data = csv_content.data();
+
+    auto quote_count = size_t{0};
+    if (quote == escape) {
+      quote_count = static_cast<size_t>(std::count(data + segment_begin, data + segment_end, quote));
+    } else {
+      if (segment_begin == 0 && segment_end > 0) {
+        quote_count += static_cast<size_t>(data[0] == quote);
+      }
+
+      // This empty block is used to convince clang-format to keep the pragma indented.
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(+:quote_count)
+      // clang-format on
+      for (auto pos = std::max(segment_begin, size_t{1}); pos < segment_end; ++pos) {
+        quote_count += static_cast<size_t>((data[pos] == quote) & (data[pos - 1] != escape));
+      }
+    }
+    quote_counts[segment_id] = quote_count;
+  });
+
+  // A segment starts within a quoted value if the number of unescaped quotes before it is odd.
+  auto starts_in_quotes = std::vector<bool>(segment_count);
+  auto preceding_quote_count = size_t{in_quotes};
+  for (auto segment_id = size_t{0}; segment_id < segment_count; ++segment_id) {
+    starts_in_quotes[segment_id] = preceding_quote_count % 2 == 1;
+    preceding_quote_count += quote_counts[segment_id];
+  }
+  in_quotes = preceding_quote_count % 2 == 1;
+
+  // Second pass: find the row delimiters outside of quoted values.
+  auto row_ends_by_segment = std::vector<std::vector<size_t>>(segment_count);
+  for_each_segment([&](const size_t segment_id) {
+    const auto segment_begin = begin + segment_id * segment_size;
+    const auto segment_end = std::min(segment_begin + segment_size, content_size);
+    const auto search_for = std::string{delimiter, quote};
+    auto& row_ends = row_ends_by_segment[segment_id];
+
+    auto segment_in_quotes = starts_in_quotes[segment_id];
+    auto pos = csv_content.find_first_of(search_for, segment_begin);
+    while (pos < segment_end) {
+      if (csv_content[pos] == delimiter) {
+        if (!segment_in_quotes) {
+          row_ends.push_back(pos);
+        }
+      } else if (is_unescaped_quote(pos)) {
+        segment_in_quotes = !segment_in_quotes;
+      }
+      pos = csv_content.find_first_of(search_for, pos + 1);
+    }
+  });
+
+  auto row_end_count = size_t{0};
+  for (const auto& row_ends : row_ends_by_segment) {
+    row_end_count += row_ends.size();
+  }
+
+  auto row_ends = std::vector<size_t>{};
+  row_ends.reserve(row_end_count);
+  for (const auto& segment_row_ends : row_ends_by_segment) {
+    row_ends.insert(row_ends.end(), segment_row_ends.begin(), segment_row_ends.end());
+  }
+
+  return row_ends;
+}
+
+size_t CsvParser::_schedule_chunks(const std::shared_ptr<const std::string>& content,
+                                   const std::vector<size_t>& row_ends, const bool is_last_block, const Table& table,
+                                   const CsvMeta& meta, const std::string& escaped_linebreak,
+                                   std::list<Segments>& segments_by_chunks,
+                                   std::vector<std::shared_ptr<AbstractTask>>& tasks, std::mutex& append_chunk_mutex) {
+  DebugAssert(!is_last_block || content->empty() || content->back() == meta.config.delimiter,
+              "The last block should end with a delimiter.");
+  const auto content_view = std::string_view{*content};
+
+  const auto row_count = row_ends.size();
+  const auto chunk_size = static_cast<size_t>(table.target_chunk_size());
+  const auto chunk_count = is_last_block ? (row_count + chunk_size - 1) / chunk_size : row_count / chunk_size;
+
+  auto chunk_begin = size_t{0};
+  for (auto chunk_id = size_t{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto last_row = std::min((chunk_id + 1) * chunk_size, row_count) - 1;
+    // The chunk includes the delimiter of its last row, which _find_fields_in_chunk uses to detect the row end.
+    const auto chunk_end = row_ends[last_row] + 1;
+
+    // Create empty chunk
+    segments_by_chunks.emplace_back();
+    auto& segments = segments_by_chunks.back();
+
+    // Only pass the part of the string that is actually needed to the parsing task
+    const auto chunk_content = content_view.substr(chunk_begin, chunk_end - chunk_begin);
+
+    // Create and start task to find the fields and to parse them into the chunk. The task holds a reference to the
+    // content so that the block can be released as soon as all of its chunks are parsed.
+    tasks.emplace_back(std::make_shared<JobTask>([content, chunk_content, &table, &segments, &meta, &escaped_linebreak,
+                                                  &append_chunk_mutex]() {
+      auto field_ends = std::vector<size_t>{};
+      _find_fields_in_chunk(chunk_content, table, field_ends, meta);
+      _parse_into_chunk(chunk_content.substr(0, field_ends.back()), field_ends, table, segments, meta,
+                        escaped_linebreak, append_chunk_mutex);
+    }));
+    tasks.back()->schedule();
+
+    chunk_begin = chunk_end;
+  }
+
+  Assert(!is_last_block || chunk_begin == content->size(), "Unexpected end of CSV content (unterminated quote?).");
+  return std::min(chunk_count * chunk_size, row_count);
+}
+
+void CsvParser::_append_chunks(Table& table, std::list<Segments>& segments_by_chunks) {
+  for (auto& segments : segments_by_chunks) {
+    DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
+    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), UNSET_COMMIT_ID);
+    table.append_chunk(segments, mvcc_data);
+    table.last_chunk()->set_immutable();
+  }
+}
+
 bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
                                       const CsvMeta& meta) {
   field_ends.clear();
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <istream>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -9,6 +13,7 @@
 
 namespace hyrise {
 
+class AbstractTask;
 class Table;
 class Chunk;
 
@@ -19,11 +24,17 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a Hyrise chunk. In the end all chunks are combined to the final table.
+ * This parser reads the csv file in blocks of READ_BLOCK_SIZE bytes. The row ends of a block are searched in parallel
+ * (see _find_row_ends), and the block is separated into data chunks that are aligned with the csv rows. Each data chunk
+ * is parsed and converted into a Hyrise chunk by a separate task while the next block is read. Rows that do not form a
+ * full chunk are carried over to the next block together with their row ends, so that no byte is searched twice. If a
+ * block does not contain a full chunk (e.g., for wide rows), it is extended by the next read before it is scheduled.
+ * Thus, only about two blocks (and the converted table) are held in memory instead of the whole file. In the end all
+ * chunks are combined to the final table.
  */
 class CsvParser {
+  friend class CsvParserTest;
+
  public:
   /*
    * @param filename      Path to the input file.
@@ -32,15 +43,70 @@ class CsvParser {
    */
   static std::shared_ptr<Table> parse(const std::string& filename, const CsvMeta& csv_meta,
                                       const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+
+  /*
+   * Same as parse(), but for CSV data that is already held in memory (e.g., data received by the server via COPY).
+   * @param content       CSV rows (without header). The content is moved into the parser to avoid a copy.
+   */
+  static std::shared_ptr<Table> parse_content(std::string content, const CsvMeta& csv_meta,
+                                              const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
  protected:
+  // Number of bytes that are read from the csv file at once.
+  static constexpr auto READ_BLOCK_SIZE = size_t{64} * 1024 * 1024;
+
+  // Minimum number of bytes that a single task searches for row ends.
+  static constexpr auto ROW_SEARCH_SEGMENT_SIZE = size_t{4} * 1024 * 1024;
+
+  /*
+   * Reads the csv rows from \p stream in blocks of \p read_block_size bytes and converts them into a new table.
+   */
+  static std::shared_ptr<Table> _parse_stream(std::istream& stream, const CsvMeta& meta, const ChunkOffset chunk_size,
+                                              const size_t read_block_size);
+
   /*
    * Use the meta information stored in _meta to create a new table with according column description.
    */
   static std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta);
 
+  /*
+   * Returns the positions of all row delimiters in \p csv_content from \p begin on that are not part of a quoted value.
+   * The searched content is split into segments of at least ROW_SEARCH_SEGMENT_SIZE bytes. First, the unescaped quotes
+   * of every segment are counted in parallel. Their prefix sums tell whether a segment starts within a quoted value.
+   * Second, the row delimiters of all segments are searched in parallel. \p csv_content has to start at the beginning
+   * of a row.
+   * @param         begin      Position from which on the content is searched. The content before it has been searched
+   *                           by a previous call.
+   * @param[in,out] in_quotes  Whether \p begin lies within a quoted value. Set to whether the end of \p csv_content
+   *                           lies within a quoted value.
+   */
+  static std::vector<size_t> _find_row_ends(std::string_view csv_content, const CsvMeta& meta, const size_t begin,
+                                            bool& in_quotes);
+
+  /*
+   * Separates \p content into chunks of table.target_chunk_size() rows and schedules a task for each chunk that finds
+   * its fields and parses it into a new entry of \p segments_by_chunks. The tasks keep \p content alive.
+   * @param      content            Csv rows, starting at the beginning of a row.
+   * @param      row_ends           Positions of the row delimiters in \p content (see _find_row_ends).
+   * @param      is_last_block      If true, the remaining rows are parsed into a smaller chunk. In this case, \p
+   * content has to end with a delimiter.
+   * @param[out] tasks              The scheduled tasks are appended.
+   * @returns                       The number of rows that were scheduled. The remaining rows (rows that do not form a
+   * full chunk) and incomplete rows have to be passed again with the next block.
+   */
+  static size_t _schedule_chunks(const std::shared_ptr<const std::string>& content, const std::vector<size_t>& row_ends,
+                                 const bool is_last_block, const Table& table, const CsvMeta& meta,
+                                 const std::string& escaped_linebreak,
+                                 std::list<Segments>& segments_by_chunks,
+                                 std::vector<std::shared_ptr<AbstractTask>>& tasks, std::mutex& append_chunk_mutex);
+
+  /*
+   * Appends the parsed chunks to \p table and marks them as immutable.
+   */
+  static void _append_chunks(Table& table, std::list<Segments>& segments_by_chunks);
+
   /*
    * @param      csv_content String_view on the remaining content of the CSV.
    * @param      table       Empty table created by _process_meta_file.
@@ -0,0 +1,93 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+#include <numa.h>
+#endif
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+size_t hardware_node_count() {
+#if HYRISE_NUMA_SUPPORT
+  if (numa_available() >= 0) {
+    return static_cast<size_t>(numa_max_node()) + 1;
+  }
+#endif
+  return 1;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+// We discourage manual memory management in Hyrise (such as malloc, or new), but in case of allocator/memory resource
+// implementations, it is fine.
+// NOLINTBEGIN(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory,hicpp-no-malloc)
+
+NumaMemoryResource::NumaMemoryResource(const NodeID node_id) : _node_id{node_id} {}
+
+NumaMemoryResource& NumaMemoryResource::get(const NodeID node_id) {
+  // Intentionally leaked, see header.
+  static auto& resources = *[]() {
+    auto* node_resources = new std::vector<std::unique_ptr<NumaMemoryResource>>{};
+    const auto node_count = hardware_node_count();
+    for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+      node_resources->emplace_back(new NumaMemoryResource{node_id});
+    }
+    return node_resources;
+  }();
+
+  DebugAssert(node_id != INVALID_NODE_ID && node_id != CURRENT_NODE_ID, "Expected a concrete NUMA node.");
+  return *resources[node_id % resources.size()];
+}
+
+bool NumaMemoryResource::is_numa_available() {
+  static const auto numa_available = hardware_node_count() > 1;
+  return numa_available;
+}
+
+NodeID NumaMemoryResource::node_id() const {
+  return _node_id;
+}
+
+void* NumaMemoryResource::do_allocate(std::size_t bytes, std::size_t /*alignment*/) {
+#if HYRISE_NUMA_SUPPORT
+  // libnuma returns page-aligned memory, which satisfies any alignment requested by containers.
+  if (bytes >= MIN_NODE_ALLOCATION_SIZE && is_numa_available()) {
+    auto* pointer = numa_alloc_onnode(bytes, static_cast<int>(_node_id));
+    if (!pointer) {
+      throw std::bad_alloc{};
+    }
+    return pointer;
+  }
+#endif
+  return std::malloc(bytes);
+}
+
+void NumaMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t /*alignment*/) {
+#if HYRISE_NUMA_SUPPORT
+  if (bytes >= MIN_NODE_ALLOCATION_SIZE && is_numa_available()) {
+    numa_free(pointer, bytes);
+    return;
+  }
+#endif
+  std::free(pointer);
+}
+
+[[nodiscard]] bool NumaMemoryResource::do_is_equal(const MemoryResource& other) const noexcept {
+  return &other == this;
+}
+
+// NOLINTEND(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory,hicpp-no-malloc)
+
+}  // namespace hyrise
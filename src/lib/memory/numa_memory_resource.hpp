@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Memory resource that allocates memory on a given NUMA node. Only allocations of at least MIN_NODE_ALLOCATION_SIZE
+ * bytes (e.g., the value vectors of segments) are bound to the node, as libnuma allocates entire pages. Smaller
+ * allocations (e.g., strings that exceed the small string buffer) fall back to malloc.
+ *
+ * Without NUMA support (or if the system does not support the NUMA API), all allocations fall back to malloc.
+ */
+class NumaMemoryResource : public MemoryResource {
+ public:
+  static constexpr auto MIN_NODE_ALLOCATION_SIZE = size_t{16'384};
+
+  /**
+   * Returns the memory resource of the given node. Node IDs of fake NUMA topologies that exceed the number of hardware
+   * nodes are mapped to the hardware nodes round-robin. The resources are never destroyed, as segments that were
+   * allocated with them might outlive any static object.
+   */
+  static NumaMemoryResource& get(const NodeID node_id);
+
+  /**
+   * Returns true if memory can be bound to NUMA nodes, i.e., Hyrise was built with NUMA support and the system has more
+   * than one node.
+   */
+  static bool is_numa_available();
+
+  NodeID node_id() const;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(const MemoryResource& other) const noexcept override;
+
+ protected:
+  explicit NumaMemoryResource(const NodeID node_id);
+
+  const NodeID _node_id;
+};
+
+}  // namespace hyrise
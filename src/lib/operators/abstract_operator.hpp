@@ -21,6 +21,7 @@ class PQPSubqueryExpression;
 enum class OperatorType {
   Aggregate,
   Alias,
+  AppendChunks,
   ChangeMetaTable,
   CreateTable,
   CreatePreparedPlan,
@@ -30,6 +30,7 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
@@ -618,18 +619,18 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
 
   // CacheResultIds is a boolean type parameter that is forwarded to get_or_add_result, see the documentation over there
   // for details.
-  const auto process_position = [&](const auto cache_result_ids, const auto& position) {
+  const auto process_value = [&](const auto cache_result_ids, const bool is_null, const auto& value) {
     auto& result = get_or_add_result(cache_result_ids, result_ids, results,
                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
                                      RowID{chunk_id, chunk_offset});
 
     // If the value is NULL, the current aggregate value does not change.
-    if (!position.is_null()) {
+    if (!is_null) {
       if constexpr (aggregate_function == WindowFunction::CountDistinct) {
         // For the case of CountDistinct, insert the current value into the set to keep track of distinct values.
-        result.accumulator.emplace(position.value());
+        result.accumulator.emplace(value);
       } else {
-        aggregator(ColumnDataType{position.value()}, result.aggregate_count, result.accumulator);
+        aggregator(ColumnDataType{value}, result.aggregate_count, result.accumulator);
       }
 
       ++result.aggregate_count;
@@ -638,18 +639,34 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
     ++chunk_offset;
   };
 
+  const auto aggregate_values = [&](const auto cache_result_ids) {
+    // Encoded segments of numeric columns are decoded block by block instead of decoding one value per hash table
+    // lookup. Strings are not worth it, as they are copied either way.
+    if constexpr (!std::is_same_v<ColumnDataType, pmr_string>) {
+      if (dynamic_cast<const AbstractEncodedSegment*>(&abstract_segment)) {
+        segment_decode_blocks<ColumnDataType>(abstract_segment, [&](const ChunkOffset /*begin*/, const size_t count,
+                                                                    const ColumnDataType* values, const bool* nulls) {
+          for (auto index = size_t{0}; index < count; ++index) {
+            process_value(cache_result_ids, nulls[index], values[index]);
+          }
+        });
+        return;
+      }
+    }
+
+    segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
+      process_value(cache_result_ids, position.is_null(), position.value());
+    });
+  };
+
   // Pass true_type into get_or_add_result to enable certain optimizations: If we have more than one aggregate function
   // (and thus more than one context), it makes sense to cache the results indexes, see get_or_add_result for details.
   // Furthermore, if we use the immediate key shortcut (which uses the same code path as caching), we need to pass
   // true_type so that the aggregate keys are checked for immediate access values.
   if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
-    segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
-      process_position(std::true_type{}, position);
-    });
+    aggregate_values(std::true_type{});
   } else {
-    segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
-      process_position(std::false_type{}, position);
-    });
+    aggregate_values(std::false_type{});
   }
 }
 
@@ -0,0 +1,246 @@
+#include "append_chunks.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// A contiguous range [begin_offset, end_offset) of rows of an input chunk.
+struct ChunkRange {
+  ChunkID chunk_id;
+  ChunkOffset begin_offset;
+  ChunkOffset end_offset;
+};
+
+template <typename T>
+std::shared_ptr<AbstractSegment> materialize_segment(const Table& input_table, const ColumnID column_id,
+                                                     const std::vector<ChunkRange>& chunk_ranges,
+                                                     const ChunkOffset row_count, const bool nullable) {
+  auto values = pmr_vector<T>(row_count);
+  auto null_values = pmr_vector<bool>(nullable ? row_count : ChunkOffset{0});
+
+  auto target_offset = ChunkOffset{0};
+  for (const auto& [chunk_id, begin_offset, end_offset] : chunk_ranges) {
+    const auto& source_segment = *input_table.get_chunk(chunk_id)->get_segment(column_id);
+    segment_with_iterators<T>(source_segment, [&](auto iter, const auto /*end*/) {
+      iter += static_cast<std::ptrdiff_t>(begin_offset);
+      for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset, ++iter) {
+        const auto& position = *iter;
+        if (position.is_null()) {
+          Assert(nullable, "Cannot append NULL values to a non-nullable column.");
+          null_values[target_offset] = true;
+        } else {
+          values[target_offset] = position.value();
+        }
+        ++target_offset;
+      }
+    });
+  }
+
+  if (nullable) {
+    return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  }
+  return std::make_shared<ValueSegment<T>>(std::move(values));
+}
+
+}  // namespace
+
+namespace hyrise {
+
+AppendChunks::AppendChunks(const std::string& target_table_name,
+                           const std::shared_ptr<const AbstractOperator>& values_to_append,
+                           const std::vector<SortColumnDefinition>& sorted_by)
+    : AbstractReadWriteOperator(OperatorType::AppendChunks, values_to_append),
+      _target_table_name(target_table_name),
+      _sorted_by(sorted_by) {}
+
+const std::string& AppendChunks::name() const {
+  static const auto name = std::string{"AppendChunks"};
+  return name;
+}
+
+std::shared_ptr<const Table> AppendChunks::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _target_table = Hyrise::get().storage_manager.get_table(_target_table_name);
+  Assert(_target_table->uses_mvcc() == UseMvcc::Yes, "AppendChunks requires a table with MVCC data.");
+
+  const auto column_count = _target_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    Assert(left_input_table()->column_data_type(column_id) == _target_table->column_data_type(column_id),
+           "Cannot handle appends to columns of different type.");
+  }
+
+  /**
+   * 1. Distribute the input rows in their order to chunks of the target table's target chunk size and materialize
+   *    them into ValueSegments without holding the table's append mutex.
+   */
+  const auto target_chunk_size = _target_table->target_chunk_size();
+  auto output_chunk_ranges = std::vector<std::vector<ChunkRange>>{};
+  auto output_chunk_row_counts = std::vector<ChunkOffset>{};
+  const auto input_chunk_count = left_input_table()->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_chunk_count; ++chunk_id) {
+    const auto input_chunk = left_input_table()->get_chunk(chunk_id);
+    if (!input_chunk) {
+      continue;
+    }
+
+    const auto input_chunk_size = input_chunk->size();
+    auto begin_offset = ChunkOffset{0};
+    while (begin_offset < input_chunk_size) {
+      if (output_chunk_row_counts.empty() || output_chunk_row_counts.back() == target_chunk_size) {
+        output_chunk_ranges.emplace_back();
+        output_chunk_row_counts.emplace_back(0);
+      }
+
+      const auto end_offset =
+          std::min(input_chunk_size, ChunkOffset{begin_offset + target_chunk_size - output_chunk_row_counts.back()});
+      output_chunk_ranges.back().emplace_back(ChunkRange{chunk_id, begin_offset, end_offset});
+      output_chunk_row_counts.back() += end_offset - begin_offset;
+      begin_offset = end_offset;
+    }
+  }
+
+  // Output chunks are materialized in parallel.
+  const auto output_chunk_count = output_chunk_ranges.size();
+  auto segments_to_append = std::vector<Segments>(output_chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(output_chunk_count);
+  for (auto output_chunk_index = size_t{0}; output_chunk_index < output_chunk_count; ++output_chunk_index) {
+    const auto materialize_chunk = [&, output_chunk_index]() {
+      auto& segments = segments_to_append[output_chunk_index];
+      segments.reserve(column_count);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          segments.emplace_back(materialize_segment<ColumnDataType>(
+              *left_input_table(), column_id, output_chunk_ranges[output_chunk_index],
+              output_chunk_row_counts[output_chunk_index], _target_table->column_is_nullable(column_id)));
+        });
+      }
+    };
+
+    if (output_chunk_count < 2) {
+      // No reason to spawn a job and wait when there is only a single job.
+      materialize_chunk();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(materialize_chunk));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  if (segments_to_append.empty()) {
+    // Nothing to append. Leave the last chunk of the table untouched.
+    return nullptr;
+  }
+
+  /**
+   * 2. Append the chunks while locking the table. The rows are locked by the current transaction and invisible to
+   *    others until they are committed.
+   */
+  const auto append_lock = _target_table->acquire_append_mutex();
+
+  // The mutable chunks that Inserts currently fill (see Table::insert_tail_chunk_ids()) are left to them, even if they
+  // are empty. As the appended chunks are immutable, Inserts keep filling the tail chunks instead of starting new ones.
+  _target_table->keep_insert_tail();
+
+  const auto transaction_id = context->transaction_id();
+  for (const auto& segments : segments_to_append) {
+    const auto row_count = segments.front()->size();
+    const auto mvcc_data = std::make_shared<MvccData>(row_count, MAX_COMMIT_ID);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      mvcc_data->set_tid(chunk_offset, transaction_id, std::memory_order_relaxed);
+    }
+
+    // Make sure the MVCC data is written before the chunk becomes visible.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    _target_table->append_chunk(segments, mvcc_data);
+
+    const auto chunk_id = ChunkID{_target_table->chunk_count() - 1};
+    const auto chunk = _target_table->get_chunk(chunk_id);
+
+    // The chunk is immutable right away so that no Insert operator appends to it. As its `max_begin_cid` is not set
+    // before the commit, Validate checks each row individually until then.
+    chunk->mark_as_full();
+    const auto marked_as_immutable = chunk->try_set_immutable();
+    Assert(marked_as_immutable, "Appended chunk could not be marked as immutable.");
+    if (!_sorted_by.empty()) {
+      chunk->set_individually_sorted_by(_sorted_by);
+    }
+
+    _appended_chunk_ids.emplace_back(chunk_id);
+  }
+
+  return nullptr;
+}
+
+void AppendChunks::_on_commit_records(const CommitID commit_id) {
+  for (const auto chunk_id : _appended_chunk_ids) {
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    const auto& mvcc_data = chunk->mvcc_data();
+
+    const auto row_count = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, commit_id, std::memory_order_relaxed);
+      mvcc_data->set_tid(chunk_offset, TransactionID{0}, std::memory_order_relaxed);
+    }
+
+    set_atomic_max(mvcc_data->max_begin_cid, commit_id);
+  }
+
+  // This fence ensures that changes to the TIDs (which are not sequentially consistent) are visible to other threads.
+  std::atomic_thread_fence(std::memory_order_release);
+
+  if (!_appended_chunk_ids.empty()) {
+    std::make_shared<ChunkCompressionTask>(_target_table, _appended_chunk_ids)->schedule();
+  }
+}
+
+void AppendChunks::_on_rollback_records() {
+  for (const auto chunk_id : _appended_chunk_ids) {
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    const auto& mvcc_data = chunk->mvcc_data();
+
+    // Unlock the rows. For other transactions, the chunk looks like its rows were never appended.
+    const auto row_count = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      mvcc_data->set_tid(chunk_offset, TransactionID{0}, std::memory_order_relaxed);
+    }
+
+    chunk->increase_invalid_row_count(row_count, std::memory_order_release);
+  }
+}
+
+std::shared_ptr<AbstractOperator> AppendChunks::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<AppendChunks>(_target_table_name, copied_left_input, _sorted_by);
+}
+
+void AppendChunks::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace hyrise
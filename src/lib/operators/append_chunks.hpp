@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class TransactionContext;
+
+/**
+ * Operator that appends its input as new, immutable chunks to a table. Expects the table name of the table to append
+ * to and the values to append in a separate table using the same column layout.
+ *
+ * In contrast to the Insert operator, which fills the last mutable chunk of the table, the input rows are not mixed
+ * with concurrently inserted rows. They are packed in input order into chunks of the table's target chunk size, so
+ * the new chunks are full (except for the last one) regardless of how the input is chunked. The new chunks are
+ * materialized in parallel. If the input is sorted, each new chunk is sorted as well, which can be passed as
+ * `sorted_by`. This is used to write back rows that have been reorganized (e.g., sorted by a clustering key or merged
+ * from sparse chunks) in the same transaction that deletes their original rows.
+ *
+ * The mutable chunks that Inserts currently fill are not sealed. Subsequent Inserts continue to fill them, even though
+ * they are no longer the last chunks of the table (see Table::keep_insert_tail()). The appended rows become visible
+ * once the transaction commits. Afterwards, the new chunks are encoded in the
+ * background by a ChunkCompressionTask, which also creates their pruning statistics.
+ *
+ * Assumption: The input has been validated before.
+ */
+class AppendChunks : public AbstractReadWriteOperator {
+ public:
+  explicit AppendChunks(const std::string& target_table_name,
+                        const std::shared_ptr<const AbstractOperator>& values_to_append,
+                        const std::vector<SortColumnDefinition>& sorted_by = {});
+
+  const std::string& name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_commit_records(const CommitID commit_id) override;
+  void _on_rollback_records() override;
+
+ private:
+  const std::string _target_table_name;
+  const std::vector<SortColumnDefinition> _sorted_by;
+
+  std::vector<ChunkID> _appended_chunk_ids;
+
+  std::shared_ptr<Table> _target_table;
+};
+
+}  // namespace hyrise
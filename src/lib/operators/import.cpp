@@ -21,6 +21,7 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/constraints/constraint_utils.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -116,6 +117,9 @@ std::shared_ptr<const Table> Import::_on_execute() {
   }
 
   if (!Hyrise::get().storage_manager.has_table(_tablename)) {
+    // Distribute the chunks across the NUMA nodes before the table becomes visible to queries.
+    place_table_on_numa_nodes(*table);
+
     // We create statistics when tables are added to the storage manager. As statistics can be expensive to create
     // and their creation benefits from dictionary encoding, we add the tables after they are encoded.
     Hyrise::get().storage_manager.add_table(_tablename, table);
@@ -124,8 +128,8 @@ std::shared_ptr<const Table> Import::_on_execute() {
 
   const auto existing_table = Hyrise::get().storage_manager.get_table(_tablename);
   const auto append_lock = existing_table->acquire_append_mutex();
-  if (existing_table->chunk_count() > 0 && existing_table->last_chunk()->is_mutable()) {
-    existing_table->last_chunk()->set_immutable();
+  for (const auto tail_chunk_id : existing_table->insert_tail_chunk_ids()) {
+    existing_table->get_chunk(tail_chunk_id)->set_immutable();
   }
 
   const auto chunk_count = table->chunk_count();
@@ -121,90 +121,129 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
    *    faster than writing to the memory, allocating under lock and then writing - in a second step - without lock will
    *    minimize the time that the Table's `_append_mutex` is locked.
    */
-  {
-    const auto append_lock = _target_table->acquire_append_mutex();
+  const auto target_size = _target_table->target_chunk_size();
+
+  // Reserves up to `remaining_rows` rows in the given mutable chunk and returns the number of reserved rows. Requires
+  // that no other Insert reserves rows in the chunk concurrently.
+  const auto reserve_rows = [&](const ChunkID target_chunk_id, const size_t remaining_rows) {
+    const auto target_chunk = _target_table->get_chunk(target_chunk_id);
+
+    // Register that Insert is pending. See `chunk.hpp`. for details.
+    const auto& mvcc_data = target_chunk->mvcc_data();
+    DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data.");
+    mvcc_data->register_insert();
+
+    const auto num_rows_for_target_chunk = std::min<size_t>(target_size - target_chunk->size(), remaining_rows);
+
+    _target_chunk_ranges.emplace_back(
+        ChunkRange{.chunk_id = target_chunk_id,
+                   .begin_chunk_offset = target_chunk->size(),
+                   .end_chunk_offset = static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
+
+    // Mark new (but still empty) rows as being under modification by current transaction. Do so before resizing the
+    // Segments, because the resize of `Chunk::_segments.front()` is what releases the new row count.
+    {
+      const auto transaction_id = context->transaction_id();
+      const auto end_offset = target_chunk->size() + num_rows_for_target_chunk;
+      for (auto target_chunk_offset = target_chunk->size(); target_chunk_offset < end_offset; ++target_chunk_offset) {
+        DebugAssert(mvcc_data->get_begin_cid(target_chunk_offset) == MAX_COMMIT_ID, "Invalid begin CID.");
+        DebugAssert(mvcc_data->get_end_cid(target_chunk_offset) == MAX_COMMIT_ID, "Invalid end CID.");
+        mvcc_data->set_tid(target_chunk_offset, transaction_id, std::memory_order_relaxed);
+      }
+    }
+
+    // Make sure the MVCC data is written before the first segment (and, thus, the chunk) is resized.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // "Grow" data segments: Segments are pre-allocated during construction. We resize() to make default-constructed
+    // cells visible so that they can be written in the next Insert step. Note that those cells are still invisible
+    // from an MVCC point of view until they are actually being written and committed.
+    // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
+    // resize that makes the new row count visible to the outside world.
+    const auto old_size = target_chunk->size();
+    const auto new_size = old_size + num_rows_for_target_chunk;
+    const auto column_count = target_chunk->column_count();
+    for (auto reverse_column_id = ColumnID{0}; reverse_column_id < column_count; ++reverse_column_id) {
+      const auto column_id = static_cast<ColumnID>(column_count - reverse_column_id - 1);
+
+      resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        const auto value_segment =
+            std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
+        Assert(value_segment, "Cannot insert into non-ValueSegments.");
+
+        // Cannot guarantee resize without reallocation when growing. We thus check that the ValueSegment has been
+        // allocated with the target table's target chunk size reserved.
+        Assert(value_segment->values().capacity() >= new_size, "ValueSegment insufficiently pre-allocated.");
+        value_segment->resize(new_size);
+      });
+
+      // Make sure the first column's resize actually happens last and does not get reordered.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
 
-    auto remaining_rows = left_input_table()->row_count();
+    if (new_size == target_size) {
+      // Allow the chunk to be marked as immutable as it has reached its target size and no incoming Insert operators
+      // will try to write to it. Pending Insert operators (including us) will call `try_set_immutable()` to make the
+      // chunk immutable once they commit/roll back.
+      target_chunk->mark_as_full();
+    }
+
+    return num_rows_for_target_chunk;
+  };
+
+  // Chunks can be marked as full before they reach the target size (see `Chunk::mark_as_full()`).
+  const auto accepts_rows = [&](const ChunkID chunk_id) {
+    if (chunk_id == INVALID_CHUNK_ID) {
+      return false;
+    }
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    return chunk && chunk->is_mutable() && chunk->size() < target_size && !chunk->is_full();
+  };
+
+  auto remaining_rows = left_input_table()->row_count();
+  if (_target_table->insert_shard_count() == 1) {
+    const auto append_lock = _target_table->acquire_append_mutex();
 
     if (_target_table->chunk_count() == 0) {
       _target_table->append_mutable_chunk();
     }
     while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
-      const auto target_size = _target_table->target_chunk_size();
-
-      // If the last chunk of the target table is either immutable or full, append a new mutable chunk.
-      if (!target_chunk->is_mutable() || target_chunk->size() == target_size) {
+      // If the tail chunk (usually the last chunk) of the target table is either immutable or full, append a new
+      // mutable chunk.
+      auto target_chunk_id = _target_table->insert_tail_chunk_id();
+      if (!accepts_rows(target_chunk_id)) {
         _target_table->append_mutable_chunk();
-        ++target_chunk_id;
-        target_chunk = _target_table->get_chunk(target_chunk_id);
+        target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
       }
 
-      // Register that Insert is pending. See `chunk.hpp`. for details.
-      const auto& mvcc_data = target_chunk->mvcc_data();
-      DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data.");
-      mvcc_data->register_insert();
-
-      const auto num_rows_for_target_chunk =
-          std::min<size_t>(_target_table->target_chunk_size() - target_chunk->size(), remaining_rows);
-
-      _target_chunk_ranges.emplace_back(
-          ChunkRange{.chunk_id = target_chunk_id,
-                     .begin_chunk_offset = target_chunk->size(),
-                     .end_chunk_offset = static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
-
-      // Mark new (but still empty) rows as being under modification by current transaction. Do so before resizing the
-      // Segments, because the resize of `Chunk::_segments.front()` is what releases the new row count.
+      remaining_rows -= reserve_rows(target_chunk_id, remaining_rows);
+    }
+  } else {
+    // With multiple insert shards, we reserve rows in the tail chunk of our thread's shard. Other shards are not
+    // blocked as we hold the append mutex in shared mode only.
+    while (remaining_rows > 0) {
       {
-        const auto transaction_id = context->transaction_id();
-        const auto end_offset = target_chunk->size() + num_rows_for_target_chunk;
-        for (auto target_chunk_offset = target_chunk->size(); target_chunk_offset < end_offset; ++target_chunk_offset) {
-          DebugAssert(mvcc_data->get_begin_cid(target_chunk_offset) == MAX_COMMIT_ID, "Invalid begin CID.");
-          DebugAssert(mvcc_data->get_end_cid(target_chunk_offset) == MAX_COMMIT_ID, "Invalid end CID.");
-          mvcc_data->set_tid(target_chunk_offset, transaction_id, std::memory_order_relaxed);
+        const auto shared_append_lock = _target_table->acquire_shared_append_mutex();
+        auto& shard = _target_table->insert_shard();
+        const auto shard_lock = std::lock_guard<std::mutex>{shard.mutex};
+        if (accepts_rows(shard.tail_chunk_id)) {
+          remaining_rows -= reserve_rows(shard.tail_chunk_id, remaining_rows);
+          continue;
         }
       }
 
-      // Make sure the MVCC data is written before the first segment (and, thus, the chunk) is resized.
-      std::atomic_thread_fence(std::memory_order_seq_cst);
-
-      // "Grow" data segments: Segments are pre-allocated during construction. We resize() to make default-constructed
-      // cells visible so that they can be written in the next Insert step. Note that those cells are still invisible
-      // from an MVCC point of view until they are actually being written and committed.
-      // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
-      // resize that makes the new row count visible to the outside world.
-      const auto old_size = target_chunk->size();
-      const auto new_size = old_size + num_rows_for_target_chunk;
-      const auto column_count = target_chunk->column_count();
-      for (auto reverse_column_id = ColumnID{0}; reverse_column_id < column_count; ++reverse_column_id) {
-        const auto column_id = static_cast<ColumnID>(column_count - reverse_column_id - 1);
-
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-
-          const auto value_segment =
-              std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
-          Assert(value_segment, "Cannot insert into non-ValueSegments.");
-
-          // Cannot guarantee resize without reallocation when growing. We thus check that the ValueSegment has been
-          // allocated with the target table's target chunk size reserved.
-          Assert(value_segment->values().capacity() >= new_size, "ValueSegment insufficiently pre-allocated.");
-          value_segment->resize(new_size);
-        });
-
-        // Make sure the first column's resize actually happens last and does not get reordered.
-        std::atomic_thread_fence(std::memory_order_seq_cst);
-      }
-
-      if (new_size == target_size) {
-        // Allow the chunk to be marked as immutable as it has reached its target size and no incoming Insert operators
-        // will try to write to it. Pending Insert operators (including us) will call `try_set_immutable()` to make the
-        // chunk immutable once they commit/roll back.
-        target_chunk->mark_as_full();
+      // The shard's tail chunk is immutable or full. Appending a new one requires the append mutex in exclusive mode.
+      // In the meantime, another thread of the same shard might have appended a tail chunk already.
+      const auto append_lock = _target_table->acquire_append_mutex();
+      auto& shard = _target_table->insert_shard();
+      if (!accepts_rows(shard.tail_chunk_id)) {
+        _target_table->append_mutable_chunk();
+        shard.tail_chunk_id = ChunkID{_target_table->chunk_count() - 1};
       }
 
-      remaining_rows -= num_rows_for_target_chunk;
+      remaining_rows -= reserve_rows(shard.tail_chunk_id, remaining_rows);
     }
   }
 
@@ -25,9 +25,10 @@ class JoinHash : public AbstractJoinOperator {
  public:
   static bool supports(const JoinConfiguration config);
 
-  // The jobs that perform the actual materialization, radix partitioning, building, and probing are added to the
-  // scheduler in case the number of elements to process is above JOB_SPAWN_THRESHOLD. If not, the job is executed
-  // directly. This threshold needs to be re-evaluated over time to find the value which gives the best performance.
+  // The jobs that perform the radix partitioning, building, and probing are added to the scheduler in case the number
+  // of elements to process is above JOB_SPAWN_THRESHOLD. If not, the job is executed directly. This threshold needs to
+  // be re-evaluated over time to find the value which gives the best performance. The materialization is split into
+  // morsels by the MorselDispatcher.
   static constexpr auto JOB_SPAWN_THRESHOLD = 500;
 
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
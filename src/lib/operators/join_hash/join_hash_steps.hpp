@@ -6,6 +6,7 @@
 #include <memory>
 #include <memory_resource>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -22,7 +23,10 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
@@ -296,47 +300,97 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   // Create histograms per chunk
   histograms.resize(chunk_count);
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(chunk_count);
+  // Physically deleted chunks are passed to the MorselDispatcher with a size of zero.
+  auto chunk_sizes = std::vector<ChunkOffset>(chunk_count, ChunkOffset{0});
+  auto chunk_node_ids = std::vector<NodeID>(chunk_count, INVALID_NODE_ID);
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
+    if (chunk_in) {
+      chunk_sizes[chunk_id] = chunk_in->size();
+      chunk_node_ids[chunk_id] = numa_node_of_chunk(*chunk_in);
+    }
+  }
+
+  const auto materialize = [&](const ChunkID chunk_id, BloomFilter& used_output_bloom_filter) {
+    // Skip chunks that were physically deleted.
     const auto chunk_in = in_table->get_chunk(chunk_id);
     if (!chunk_in) {
-      continue;
+      return;
     }
 
-    const auto num_rows = chunk_in->size();
+    const auto num_rows = chunk_sizes[chunk_id];
 
-    const auto materialize = [&, chunk_in, chunk_id, num_rows]() {
-      auto local_output_bloom_filter = BloomFilter{};
-      std::reference_wrapper<BloomFilter> used_output_bloom_filter = output_bloom_filter;
-      if (Hyrise::get().is_multi_threaded()) {
-        // We cannot write to BloomFilter concurrently, so we build a local one first.
-        local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
-        used_output_bloom_filter = local_output_bloom_filter;
-      }
+    auto& elements = radix_container[chunk_id].elements;
+    auto& null_values = radix_container[chunk_id].null_values;
 
-      // Skip chunks that were physically deleted.
-      if (!chunk_in) {
-        return;
-      }
+    elements.resize(num_rows);
+    if constexpr (keep_null_values) {
+      null_values.resize(num_rows);
+    }
 
-      auto& elements = radix_container[chunk_id].elements;
-      auto& null_values = radix_container[chunk_id].null_values;
+    auto elements_iter = elements.begin();
+    [[maybe_unused]] auto null_values_iter = null_values.begin();
 
-      elements.resize(num_rows);
-      if constexpr (keep_null_values) {
-        null_values.resize(num_rows);
-      }
+    // prepare histogram
+    auto histogram = std::vector<size_t>(num_radix_partitions);
+
+    const auto materialize_value = [&](const auto& value, const bool is_null, const ChunkOffset chunk_offset) {
+      if (!is_null || keep_null_values) {
+        // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
+        // joins an information loss is possible when joining with longs that cannot be losslessly converted to
+        // double. See #1550 for details.
+        const Hash hashed_value = hash_function(static_cast<HashedType>(value));
+
+        auto skip = false;
+        if (!is_null && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
+          // Value in not present in input bloom filter and can be skipped
+          skip = true;
+        }
+
+        if (!skip) {
+          // Fill the corresponding slot in the bloom filter
+          used_output_bloom_filter[hashed_value & BLOOM_FILTER_MASK] = true;
+
+          *elements_iter = PartitionedElement<T>{RowID{chunk_id, chunk_offset}, value};
+          ++elements_iter;
+
+          // In case we care about NULL values, store the NULL flag
+          if constexpr (keep_null_values) {
+            if (is_null) {
+              *null_values_iter = true;
+            }
+            ++null_values_iter;
+          }
 
-      auto elements_iter = elements.begin();
-      [[maybe_unused]] auto null_values_iter = null_values.begin();
+          if (radix_bits > 0) {
+            const Hash radix = hashed_value & radix_mask;
+            ++histogram[radix];
+          }
+        }
+      }
+    };
 
-      // prepare histogram
-      auto histogram = std::vector<size_t>(num_radix_partitions);
+    const auto segment = chunk_in->get_segment(column_id);
+
+    // Encoded segments of numeric columns are decoded block by block instead of value by value. Strings are not worth
+    // it, as they are copied either way.
+    auto decoded_in_blocks = false;
+    if constexpr (!std::is_same_v<T, pmr_string>) {
+      if (std::dynamic_pointer_cast<const AbstractEncodedSegment>(segment)) {
+        Assert(segment->size() == num_rows, "Non-ValueSegment changed size while being accessed.");
+        segment_decode_blocks<T>(*segment, [&](const ChunkOffset begin, const size_t count, const T* values,
+                                               const bool* nulls) {
+          for (auto index = size_t{0}; index < count; ++index) {
+            materialize_value(values[index], nulls[index], static_cast<ChunkOffset>(begin + index));
+          }
+        });
+        decoded_in_blocks = true;
+      }
+    }
 
+    if (!decoded_in_blocks) {
       auto reference_chunk_offset = ChunkOffset{0};
 
-      const auto segment = chunk_in->get_segment(column_id);
       segment_with_iterators<T>(*segment, [&](auto iter, auto end) {
         using IterableType = typename decltype(iter)::IterableType;
 
@@ -353,78 +407,53 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
         while (iter != end) {
           const auto& value = *iter;
 
-          if (!value.is_null() || keep_null_values) {
-            // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
-            // joins an information loss is possible when joining with longs that cannot be losslessly converted to
-            // double. See #1550 for details.
-            const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
-
-            auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
-              // Value in not present in input bloom filter and can be skipped
-              skip = true;
-            }
-
-            if (!skip) {
-              // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
-
-              /*
-              For ReferenceSegments we do not use the RowIDs from the referenced tables.
-              Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-              values from different inputs (important for Multi Joins).
-              */
-              if constexpr (is_reference_segment_iterable_v<IterableType>) {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-              } else {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
-              }
-              ++elements_iter;
-
-              // In case we care about NULL values, store the NULL flag
-              if constexpr (keep_null_values) {
-                if (value.is_null()) {
-                  *null_values_iter = true;
-                }
-                ++null_values_iter;
-              }
-
-              if (radix_bits > 0) {
-                const Hash radix = hashed_value & radix_mask;
-                ++histogram[radix];
-              }
-            }
-          }
-
-          // reference_chunk_offset is only used for ReferenceSegments
+          /*
+          For ReferenceSegments we do not use the RowIDs from the referenced tables.
+          Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+          values from different inputs (important for Multi Joins).
+          */
           if constexpr (is_reference_segment_iterable_v<IterableType>) {
+            materialize_value(value.value(), value.is_null(), reference_chunk_offset);
             ++reference_chunk_offset;
+          } else {
+            materialize_value(value.value(), value.is_null(), value.chunk_offset());
           }
 
           ++iter;
         }
       });
+    }
 
-      // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
-      // vector to the number of values actually written.
-      elements.resize(std::distance(elements.begin(), elements_iter));
-      null_values.resize(std::distance(null_values.begin(), null_values_iter));
+    // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
+    // vector to the number of values actually written.
+    elements.resize(std::distance(elements.begin(), elements_iter));
+    null_values.resize(std::distance(null_values.begin(), null_values_iter));
 
-      histograms[chunk_id] = std::move(histogram);
+    histograms[chunk_id] = std::move(histogram);
+  };
 
-      if (Hyrise::get().is_multi_threaded()) {
-        // Merge the local_output_bloom_filter into output_bloom_filter
-        const auto lock = std::lock_guard<std::mutex>{output_bloom_filter_mutex};
-        output_bloom_filter |= local_output_bloom_filter;
+  // Small chunks are materialized together in one job, see MorselDispatcher. Each chunk is materialized into its own
+  // partition, so chunks are not split. Jobs are scheduled on the NUMA node of their chunks.
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::JoinHash};
+  const auto morsels = morsel_dispatcher.create_morsels(chunk_sizes, nullptr, chunk_node_ids);
+  morsel_dispatcher.execute(morsels, [&](const auto& morsel) {
+    if (!Hyrise::get().is_multi_threaded()) {
+      for (auto chunk_id = morsel.chunk_id_begin; chunk_id < morsel.chunk_id_end; ++chunk_id) {
+        materialize(chunk_id, output_bloom_filter);
       }
-    };
-    if (JoinHash::JOB_SPAWN_THRESHOLD > num_rows) {
-      materialize();
-    } else {
-      jobs.emplace_back(std::make_shared<JobTask>(materialize));
+      return;
     }
-  }
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    // We cannot write to BloomFilter concurrently, so we build a local one per morsel first.
+    auto local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
+    for (auto chunk_id = morsel.chunk_id_begin; chunk_id < morsel.chunk_id_end; ++chunk_id) {
+      materialize(chunk_id, local_output_bloom_filter);
+    }
+
+    // Merge the local_output_bloom_filter into output_bloom_filter
+    const auto lock = std::lock_guard<std::mutex>{output_bloom_filter_mutex};
+    output_bloom_filter |= local_output_bloom_filter;
+  });
 
   return radix_container;
 }
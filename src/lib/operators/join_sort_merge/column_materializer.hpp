@@ -10,8 +10,9 @@
 #include <boost/sort/pdqsort/pdqsort.hpp>
 
 #include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
 #include "resolve_type.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
@@ -56,8 +57,8 @@ class ColumnMaterializer {
   explicit ColumnMaterializer(bool sort, bool materialize_null) : _sort{sort}, _materialize_null{materialize_null} {}
 
  public:
-  // For sufficiently large chunks (number of rows > JOB_SPAWN_THRESHOLD), the materialization is parallelized. Returns
-  // the materialized segments and a list of null row ids if _materialize_null is true.
+  // The materialization is parallelized with morsels of one or more chunks (see MorselDispatcher). Returns the
+  // materialized segments and a list of null row ids if _materialize_null is true.
   std::tuple<MaterializedSegmentList<T>, RowIDPosList, std::vector<T>> materialize(
       const std::shared_ptr<const Table>& input, const ColumnID column_id) {
     constexpr auto SAMPLES_PER_CHUNK = ChunkOffset{10};
@@ -69,28 +70,24 @@ class ColumnMaterializer {
     auto subsamples = std::vector<Subsample<T>>{};
     subsamples.reserve(chunk_count);
 
-    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    auto chunk_sizes = std::vector<ChunkOffset>(chunk_count);
     for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
       const auto& chunk = input->get_chunk(chunk_id);
       Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
       const auto chunk_size = chunk->size();
+      chunk_sizes[chunk_id] = chunk_size;
 
       const auto samples_to_write = std::min(SAMPLES_PER_CHUNK, chunk_size);
       subsamples.push_back(Subsample<T>(samples_to_write));
+    }
 
-      auto materialize_job = [&, chunk_id] {
+    const auto morsel_dispatcher = MorselDispatcher{OperatorType::JoinSortMerge};
+    morsel_dispatcher.execute(morsel_dispatcher.create_morsels(chunk_sizes), [&](const auto& morsel) {
+      for (auto chunk_id = morsel.chunk_id_begin; chunk_id < morsel.chunk_id_end; ++chunk_id) {
         const auto& segment = input->get_chunk(chunk_id)->get_segment(column_id);
         output[chunk_id] = _materialize_segment(segment, chunk_id, null_rows_per_chunk[chunk_id], subsamples[chunk_id]);
-      };
-
-      if (chunk_size > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
-        jobs.push_back(std::make_shared<JobTask>(materialize_job));
-      } else {
-        materialize_job();
       }
-    }
-
-    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    });
 
     auto null_row_count = size_t{0};
     for (const auto& null_rows : null_rows_per_chunk) {
@@ -13,6 +13,7 @@
 #include "column_materializer.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "utils/timer.hpp"
 
 namespace hyrise {
@@ -256,6 +256,10 @@ std::string Print::_segment_type(const std::shared_ptr<AbstractSegment>& segment
         segment_type += "LZ4";
         break;
       }
+      case EncodingType::FSST: {
+        segment_type += "FST";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
@@ -275,6 +279,10 @@ std::string Print::_segment_type(const std::shared_ptr<AbstractSegment>& segment
           segment_type += ":BitP";
           break;
         }
+        case CompressedVectorType::SimdBp128: {
+          segment_type += ":BP128";
+          break;
+        }
       }
     }
   } else {
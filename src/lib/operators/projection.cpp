@@ -19,8 +19,7 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/operator_performance_data.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/chunk.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -52,7 +51,7 @@ std::shared_ptr<AbstractOperator> Projection::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
   // Passing copied_ops is essential to allow for global subplan deduplication, including subqueries.
-  return std::make_shared<Projection>(copied_left_input, expressions_deep_copy(expressions, copied_ops));
+  return std::make_shared<Projection>(copied_left_input, expressions_copy_for_execution(expressions, copied_ops));
 }
 
 void Projection::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
@@ -109,31 +108,29 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   // described above.
   auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(chunk_count);
-
   const auto expression_count = expressions.size();
   const auto forwarded_pqp_columns = _determine_forwarded_columns(output_table_type);
+  const auto all_columns_forwarded = std::ranges::all_of(expressions, [&](const auto& expression) {
+    return forwarded_pqp_columns.contains(expression);
+  });
 
   // NULLability information is either forwarded or collected during the execution of the ExpressionEvaluator. The
   // vector stores atomic bool values. This allows parallel write operation per thread.
   auto column_is_nullable = std::vector<std::atomic_bool>(expressions.size());
 
-  auto forwarding_cost = std::chrono::nanoseconds{};
-  auto expression_evaluator_cost = std::chrono::nanoseconds{};
+  auto chunk_sizes = std::vector<ChunkOffset>(chunk_count);
 
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto input_chunk = input_table.get_chunk(chunk_id);
     Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    chunk_sizes[chunk_id] = input_chunk->size();
 
     auto output_segments = Segments{expression_count};
-    auto all_segments_forwarded = true;
 
     for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
       // In this loop, we perform all projections that only forward an input column sequential.
       const auto& expression = expressions[column_id];
       if (!forwarded_pqp_columns.contains(expression)) {
-        all_segments_forwarded = false;
         continue;
       }
 
@@ -145,49 +142,42 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       output_segments[column_id] = input_chunk->get_segment(pqp_column_expression.column_id);
       column_is_nullable[column_id] = input_table.column_is_nullable(pqp_column_expression.column_id);
     }
-    forwarding_cost += timer.lap();
 
     // `output_segments_by_chunk` now contains all forwarded segments.
     output_segments_by_chunk[chunk_id] = std::move(output_segments);
+  }
+  const auto forwarding_cost = timer.lap();
 
-    // All columns are forwarded. We do not need to evaluate newly generated columns.
-    if (all_segments_forwarded) {
-      continue;
-    }
+  // Performs the evaluation of the newly generated columns.
+  const auto perform_projection_evaluation = [this, expression_count, &output_segments_by_chunk, &column_is_nullable,
+                                              &forwarded_pqp_columns](const ChunkID chunk_id) {
+    auto evaluator = ExpressionEvaluator{left_input_table(), chunk_id};
 
-    // Defines the job that performs the evaluation if the columns are newly generated.
-    auto perform_projection_evaluation = [this, chunk_id, expression_count, &output_segments_by_chunk,
-                                          &column_is_nullable, &forwarded_pqp_columns]() {
-      auto evaluator = ExpressionEvaluator{left_input_table(), chunk_id};
-
-      for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
-        const auto& expression = expressions[column_id];
-
-        if (!forwarded_pqp_columns.contains(expression)) {
-          // Newly generated column - the expression needs to be evaluated
-          auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-          column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
-          // Storing the result in output_segments_by_chunk means that the vector for the separate chunks may contain
-          // both ReferenceSegments and ValueSegments. We deal with this later.
-          output_segments_by_chunk[chunk_id][column_id] = std::move(output_segment);
-        }
+    for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+      const auto& expression = expressions[column_id];
+
+      if (!forwarded_pqp_columns.contains(expression)) {
+        // Newly generated column - the expression needs to be evaluated
+        auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
+        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
+        // Storing the result in output_segments_by_chunk means that the vector for the separate chunks may contain
+        // both ReferenceSegments and ValueSegments. We deal with this later.
+        output_segments_by_chunk[chunk_id][column_id] = std::move(output_segment);
       }
-    };
-    // Evaluate the expression immediately if it contains less than `JOB_SPAWN_THRESHOLD` rows, otherwise wrap
-    // it into a task. The upper bound of the chunk size, which defines if it will be executed in parallel or not,
-    // still needs to be re-evaluated over time to find the value which gives the best performance.
-    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
-    if (input_chunk->size() >= JOB_SPAWN_THRESHOLD) {
-      auto job_task = std::make_shared<JobTask>(perform_projection_evaluation);
-      jobs.push_back(job_task);
-    } else {
-      perform_projection_evaluation();
-      expression_evaluator_cost += timer.lap();
     }
+  };
+
+  // Small chunks are evaluated together in one job, see MorselDispatcher. As the ExpressionEvaluator operates on
+  // entire chunks, chunks are not split.
+  if (!all_columns_forwarded) {
+    const auto morsel_dispatcher = MorselDispatcher{OperatorType::Projection};
+    morsel_dispatcher.execute(morsel_dispatcher.create_morsels(chunk_sizes), [&](const auto& morsel) {
+      for (auto chunk_id = morsel.chunk_id_begin; chunk_id < morsel.chunk_id_end; ++chunk_id) {
+        perform_projection_evaluation(chunk_id);
+      }
+    });
   }
-
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
-  expression_evaluator_cost += timer.lap();
+  const auto expression_evaluator_cost = timer.lap();
 
   auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
   step_performance_data.set_step_runtime(OperatorSteps::ForwardUnmodifiedColumns, forwarding_cost);
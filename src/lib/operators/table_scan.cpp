@@ -26,14 +26,15 @@
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/pqp_utils.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/chunk.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "table_scan/abstract_dereferenced_column_table_scan_impl.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
@@ -90,7 +91,8 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
-  const auto table_scan = std::make_shared<TableScan>(copied_left_input, _predicate->deep_copy(copied_ops));
+  const auto table_scan =
+      std::make_shared<TableScan>(copied_left_input, expression_copy_for_execution(_predicate, copied_ops));
 
   // Excluded ChunkIDs are set when an IndexScan scans those chunks in parallel using a secondary index and the result
   // of both operators is unioned. When the PQP is later copied due to a PQP cache hit, we need to set
@@ -113,128 +115,149 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   const auto chunk_count = in_table->chunk_count();
   const auto chunks_to_scan = chunk_count - excluded_chunk_ids->size();
 
-  auto excluded_chunk_ids_iter = excluded_chunk_ids->cbegin();
-
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
   output_chunks.reserve(chunks_to_scan);
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(chunks_to_scan);
+  // Excluded chunks are passed to the MorselDispatcher with a size of zero and skipped when executing the morsels.
+  auto is_excluded = std::vector<bool>(chunk_count, false);
+  for (const auto excluded_chunk_id : *excluded_chunk_ids) {
+    if (excluded_chunk_id < chunk_count) {
+      is_excluded[excluded_chunk_id] = true;
+    }
+  }
 
+  auto chunk_sizes = std::vector<ChunkOffset>(chunk_count, ChunkOffset{0});
+  auto chunk_node_ids = std::vector<NodeID>(chunk_count, INVALID_NODE_ID);
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    if (excluded_chunk_ids_iter != excluded_chunk_ids->cend() && chunk_id == *excluded_chunk_ids_iter) {
-      ++excluded_chunk_ids_iter;
+    if (is_excluded[chunk_id]) {
       continue;
     }
 
     const auto& chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    chunk_sizes[chunk_id] = chunk_in->size();
+    chunk_node_ids[chunk_id] = numa_node_of_chunk(*chunk_in);
+  }
 
-    // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) {
-        return;
-      }
+  // Scan implementations that operate on a single column can scan a row range of a data chunk. Thus, large chunks can
+  // be split into multiple jobs. Other implementations (and reference chunks, whose PosLists are shared between the
+  // output segments) are scanned as a whole.
+  auto* const dereferenced_column_impl = dynamic_cast<AbstractDereferencedColumnTableScanImpl*>(_impl.get());
+  const auto can_split_chunks = dereferenced_column_impl && in_table->type() == TableType::Data;
 
-      const auto column_count = in_table->column_count();
-      auto out_segments = Segments{};
-      out_segments.reserve(column_count);
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
-       * the matches to construct the reference segments of the output. If it is a reference segment, we need to
-       * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
-       * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
-       * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
-       * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
-       * share their position list).
-       */
-      auto keep_chunk_sort_order = true;
-      if (in_table->type() == TableType::References) {
-        if (matches_out->size() == chunk_in->size()) {
-          // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
-          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-            out_segments.emplace_back(segment_in);
-          }
-        } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
-
-          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-
-            auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-            DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
-
-            const auto pos_list_in = ref_segment_in->pos_list();
-
-            const auto table_out = ref_segment_in->referenced_table();
-            const auto column_id_out = ref_segment_in->referenced_column_id();
-
-            auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-            if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
-              } else {
-                // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
-                // reason is that several table scan implementations split the pos lists by chunks (see
-                // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
-                // this does not affect all scan implementations, we chose the safe and defensive path for now.
-                keep_chunk_sort_order = false;
-              }
-
-              auto offset = size_t{0};
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
-              }
-            }
+  const auto perform_table_scan = [&](const ChunkID chunk_id,
+                                      const std::optional<std::pair<ChunkOffset, ChunkOffset>>& chunk_offsets) {
+    const auto& chunk_in = in_table->get_chunk(chunk_id);
 
-            const auto ref_segment_out =
-                std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-            out_segments.push_back(ref_segment_out);
-          }
+    // The actual scan happens in the sub classes of BaseTableScanImpl
+    const auto matches_out = chunk_offsets ? dereferenced_column_impl->scan_chunk_range(
+                                                 chunk_id, chunk_offsets->first, chunk_offsets->second)
+                                           : _impl->scan_chunk(chunk_id);
+    if (matches_out->empty()) {
+      return;
+    }
+
+    const auto column_count = in_table->column_count();
+    auto out_segments = Segments{};
+    out_segments.reserve(column_count);
+
+    /**
+     * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
+     * the matches to construct the reference segments of the output. If it is a reference segment, we need to
+     * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
+     * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
+     * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
+     * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
+     * share their position list).
+     */
+    auto keep_chunk_sort_order = true;
+    if (in_table->type() == TableType::References) {
+      if (matches_out->size() == chunk_in->size()) {
+        // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          const auto segment_in = chunk_in->get_segment(column_id);
+          out_segments.emplace_back(segment_in);
         }
       } else {
-        matches_out->guarantee_single_chunk();
-
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+        auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
 
         for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-          const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
+          const auto segment_in = chunk_in->get_segment(column_id);
+
+          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+          DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+          const auto pos_list_in = ref_segment_in->pos_list();
+
+          const auto table_out = ref_segment_in->referenced_table();
+          const auto column_id_out = ref_segment_in->referenced_column_id();
+
+          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+          if (!filtered_pos_list) {
+            filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+            if (pos_list_in->references_single_chunk()) {
+              filtered_pos_list->guarantee_single_chunk();
+            } else {
+              // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
+              // reason is that several table scan implementations split the pos lists by chunks (see
+              // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
+              // this does not affect all scan implementations, we chose the safe and defensive path for now.
+              keep_chunk_sort_order = false;
+            }
+
+            auto offset = size_t{0};
+            for (const auto& match : *matches_out) {
+              const auto row_id = (*pos_list_in)[match.chunk_offset];
+              (*filtered_pos_list)[offset] = row_id;
+              ++offset;
+            }
+          }
+
+          const auto ref_segment_out =
+              std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
           out_segments.push_back(ref_segment_out);
         }
       }
+    } else {
+      matches_out->guarantee_single_chunk();
+
+      // If the entire chunk is matched, create an EntireChunkPosList instead
+      const auto output_pos_list = matches_out->size() == chunk_in->size()
+                                       ? static_cast<std::shared_ptr<AbstractPosList>>(
+                                             std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
+                                       : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
 
-      const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
-      chunk->set_immutable();
-      if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
-        chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
+        out_segments.push_back(ref_segment_out);
       }
-      const auto lock = std::lock_guard<std::mutex>{output_mutex};
-      output_chunks.emplace_back(chunk);
-    };
-    // Spawn job when chunk sufficiently large. The upper bound of the chunk size, still needs to be re-evaluated over
-    // time to find the value which gives the best performance.
-    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
-    if (chunk_in->size() >= JOB_SPAWN_THRESHOLD) {
-      auto job_task = std::make_shared<JobTask>(perform_table_scan);
-      jobs.push_back(job_task);
-    } else {
-      perform_table_scan();
     }
-  }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
+    chunk->set_immutable();
+    if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
+      chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+    }
+    const auto lock = std::lock_guard<std::mutex>{output_mutex};
+    output_chunks.emplace_back(chunk);
+  };
+
+  // Small chunks are coalesced into one job, large chunks are split into row ranges if possible (see MorselDispatcher).
+  // Each row range yields its own output chunk. Jobs are scheduled on the NUMA node of their chunks.
+  const auto split_chunk = [&](const ChunkID /*chunk_id*/) {
+    return can_split_chunks;
+  };
+
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::TableScan};
+  const auto morsels = morsel_dispatcher.create_morsels(chunk_sizes, split_chunk, chunk_node_ids);
+  morsel_dispatcher.execute(morsels, [&](const auto& morsel) {
+    for (auto chunk_id = morsel.chunk_id_begin; chunk_id < morsel.chunk_id_end; ++chunk_id) {
+      if (!is_excluded[chunk_id]) {
+        perform_table_scan(chunk_id, morsel.chunk_offsets);
+      }
+    }
+  });
 
   auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
   scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
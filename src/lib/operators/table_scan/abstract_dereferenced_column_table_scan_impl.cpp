@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "storage/pos_lists/chunk_range_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/split_pos_list_by_chunk_id.hpp"
@@ -31,6 +32,28 @@ std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chun
   return matches;
 }
 
+std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chunk_range(const ChunkID chunk_id,
+                                                                                       const ChunkOffset begin_offset,
+                                                                                       const ChunkOffset end_offset) {
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  const auto& segment = chunk->get_segment(_column_id);
+  DebugAssert(!std::dynamic_pointer_cast<ReferenceSegment>(segment), "Row ranges can only be scanned in data tables.");
+  DebugAssert(begin_offset < end_offset && end_offset <= chunk->size(), "Invalid row range.");
+
+  const auto position_filter = std::make_shared<ChunkRangePosList>(chunk_id, begin_offset, end_offset);
+  auto matches = std::make_shared<RowIDPosList>();
+  _scan_non_reference_segment(*segment, chunk_id, *matches, position_filter);
+  return matches;
+}
+
+ChunkOffset AbstractDereferencedColumnTableScanImpl::_first_match_offset(
+    const std::shared_ptr<const AbstractPosList>& position_filter) {
+  if (const auto* const chunk_range = dynamic_cast<const ChunkRangePosList*>(position_filter.get())) {
+    return chunk_range->begin_offset();
+  }
+  return ChunkOffset{0};
+}
+
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id, RowIDPosList& matches) {
   const auto& pos_list = segment.pos_list();
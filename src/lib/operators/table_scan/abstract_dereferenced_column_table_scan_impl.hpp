@@ -28,11 +28,23 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override;
 
+  // Scans only the rows [begin_offset, end_offset) of a chunk of a data table by passing a ChunkRangePosList as the
+  // position filter, which the segments are iterated over sequentially for. This allows the TableScan to split large
+  // chunks into multiple jobs (see MorselDispatcher). As for scan_chunk(), the returned positions are offsets within
+  // the chunk.
+  std::shared_ptr<RowIDPosList> scan_chunk_range(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                                 const ChunkOffset end_offset);
+
   const PredicateCondition predicate_condition;
 
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
 
+  // Offset of the first row of the position filter in the matches. Usually, matches are positions within the position
+  // filter, so this is 0. For ChunkRangePosLists, matches are offsets within the chunk. Used by scans that add all
+  // rows of a segment at once.
+  static ChunkOffset _first_match_offset(const std::shared_ptr<const AbstractPosList>& position_filter);
+
   // Implemented by the separate Impls. They do not need to deal with ReferenceSegments anymore, as this class
   // takes care of that. We take `matches` as an in/out parameter instead of returning it because scans on multiple
   // referenced segments of a single ReferenceSegment should result in only one PosList. Storing it as a member is
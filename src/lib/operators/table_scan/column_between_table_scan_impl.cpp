@@ -141,6 +141,7 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
       // No NULLs, all entries match.
       ++num_chunks_with_all_rows_matching;
       const auto output_size = position_filter ? position_filter->size() : segment.size();
+      const auto first_match_offset = static_cast<ChunkOffset::base_type>(_first_match_offset(position_filter));
       const auto output_start_offset = matches.size();
       matches.resize(matches.size() + output_size);
 
@@ -155,7 +156,7 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
            ++offset) {
         // `matches` might already contain entries if it is called multiple times by
         // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment.
-        matches[output_start_offset + offset] = RowID{chunk_id, ChunkOffset{offset}};
+        matches[output_start_offset + offset] = RowID{chunk_id, ChunkOffset{first_match_offset + offset}};
       }
     }
 
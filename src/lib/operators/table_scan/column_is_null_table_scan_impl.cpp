@@ -124,7 +124,8 @@ void ColumnIsNullTableScanImpl::_scan_typed_segment(const BaseSegmentType& segme
                                                     RowIDPosList& matches,
                                                     const std::shared_ptr<const AbstractPosList>& position_filter) {
   if (_matches_all(segment)) {
-    _add_all(chunk_id, matches, position_filter ? position_filter->size() : segment.size());
+    _add_all(chunk_id, matches, _first_match_offset(position_filter),
+             position_filter ? position_filter->size() : segment.size());
     ++num_chunks_with_all_rows_matching;
     return;
   }
@@ -250,9 +251,10 @@ bool ColumnIsNullTableScanImpl::_matches_none(const BaseSegmentType& segment) co
   }
 }
 
-void ColumnIsNullTableScanImpl::_add_all(const ChunkID chunk_id, RowIDPosList& matches, const size_t segment_size) {
-  const auto num_rows = segment_size;
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < num_rows; ++chunk_offset) {
+void ColumnIsNullTableScanImpl::_add_all(const ChunkID chunk_id, RowIDPosList& matches,
+                                         const ChunkOffset first_offset, const size_t segment_size) {
+  const auto end_offset = first_offset + segment_size;
+  for (auto chunk_offset = first_offset; chunk_offset < end_offset; ++chunk_offset) {
     matches.emplace_back(chunk_id, chunk_offset);
   }
 }
@@ -54,7 +54,8 @@ class ColumnIsNullTableScanImpl : public AbstractDereferencedColumnTableScanImpl
   template <typename BaseSegmentType>
   bool _matches_none(const BaseSegmentType& segment) const;
 
-  static void _add_all(const ChunkID chunk_id, RowIDPosList& matches, const size_t segment_size);
+  static void _add_all(const ChunkID chunk_id, RowIDPosList& matches, const ChunkOffset first_offset,
+                       const size_t segment_size);
 
   /**@}*/
 };
@@ -2,9 +2,11 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
@@ -13,6 +15,8 @@
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
@@ -26,7 +30,14 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const PredicateCondition init_predicate_condition,
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
-      _matcher{pattern, init_predicate_condition} {}
+      _matcher{pattern, init_predicate_condition} {
+  if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+    auto pattern_variant = LikeMatcher::pattern_string_to_pattern_variant(pattern, false);
+    if (auto* starts_with_pattern = std::get_if<LikeMatcher::StartsWithPattern>(&pattern_variant)) {
+      _prefix = std::move(starts_with_pattern->string);
+    }
+  }
+}
 
 std::string ColumnLikeTableScanImpl::description() const {
   return "ColumnLike";
@@ -41,6 +52,9 @@ void ColumnLikeTableScanImpl::_scan_non_reference_segment(
       dictionary_segment &&
       (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && _prefix) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches, position_filter);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -71,6 +85,22 @@ void ColumnLikeTableScanImpl::_scan_generic_segment(
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                                 RowIDPosList& matches,
+                                                 const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  const auto& symbol_table = segment.symbol_table();
+  const auto& prefix = *_prefix;
+  const auto invert_results = predicate_condition == PredicateCondition::NotLike;
+
+  auto iterable = FSSTCompressedValueIterable{segment};
+  iterable.with_iterators(position_filter, [&](const auto& iter, const auto& end) {
+    const auto functor = [&](const auto& position) {
+      return symbol_table.decoded_starts_with(position.value(), prefix) != invert_results;
+    };
+    _scan_with_iterators<true>(functor, iter, end, chunk_id, matches);
+  });
+}
+
 void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
                                                        RowIDPosList& matches,
                                                        const std::shared_ptr<const AbstractPosList>& position_filter) {
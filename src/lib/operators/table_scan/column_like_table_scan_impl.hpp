@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -15,6 +16,8 @@
 
 namespace hyrise {
 
+template <typename T>
+class FSSTSegment;
 class Table;
 
 /**
@@ -25,6 +28,8 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments and case-sensitive prefix patterns (e.g., 'hello%'), only the symbols that cover the prefix are
+ *   decompressed.
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -44,6 +49,8 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
   /**
    * Used for dictionary segments
@@ -53,6 +60,9 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
   std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const D& dictionary) const;
 
   const LikeMatcher _matcher;
+
+  // Set if the pattern is a case-sensitive prefix pattern (e.g., 'hello%'), which can be evaluated on FSST codes.
+  std::optional<pmr_string> _prefix;
 };
 
 }  // namespace hyrise
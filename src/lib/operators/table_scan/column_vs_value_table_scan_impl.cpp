@@ -1,8 +1,12 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -10,14 +14,18 @@
 #include "all_type_variant.hpp"
 #include "resolve_type.hpp"
 #include "sorted_segment_search.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -56,6 +64,13 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && (predicate_condition == PredicateCondition::Equals ||
+                              predicate_condition == PredicateCondition::NotEquals)) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches, position_filter);
+  } else if (!position_filter && segment.data_type() != DataType::String &&
+             dynamic_cast<const AbstractEncodedSegment*>(&segment)) {
+    _scan_decoded_blocks(segment, chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -86,6 +101,41 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_decoded_blocks(const AbstractSegment& segment, const ChunkID chunk_id,
+                                                      RowIDPosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // Strings are not decoded in blocks, see _scan_non_reference_segment.
+    if constexpr (!std::is_same_v<ColumnDataType, pmr_string>) {
+      const auto typed_value = boost::get<ColumnDataType>(value);
+      auto block_matches = std::array<uint8_t, SEGMENT_DECODE_BLOCK_SIZE>{};
+
+      with_comparator(predicate_condition, [&](auto predicate_comparator) {
+        segment_decode_blocks<ColumnDataType>(segment, [&](const ChunkOffset begin, const size_t count,
+                                                           const ColumnDataType* values, const bool* nulls) {
+          // This empty block is used to convince clang-format to keep the pragma indented.
+          // NOLINTNEXTLINE
+          {}  // clang-format off
+          #pragma omp simd
+          // clang-format on
+          for (auto index = size_t{0}; index < count; ++index) {
+            block_matches[index] = !nulls[index] && predicate_comparator(values[index], typed_value);
+          }
+
+          for (auto index = size_t{0}; index < count; ++index) {
+            if (block_matches[index]) {
+              matches.emplace_back(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(begin + index)});
+            }
+          }
+        });
+      });
+    } else {
+      Fail("String segments are scanned using iterators.");
+    }
+  });
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -134,6 +184,7 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
       // No NULLs, all rows match.
       ++num_chunks_with_all_rows_matching;
       const auto output_size = position_filter ? position_filter->size() : segment.size();
+      const auto first_match_offset = static_cast<ChunkOffset::base_type>(_first_match_offset(position_filter));
       const auto output_start_offset = matches.size();
       matches.resize(matches.size() + output_size);
 
@@ -148,7 +199,7 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
            ++offset) {
         // `matches` might already contain entries if it is called multiple times by
         // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment.
-        matches[output_start_offset + offset] = RowID{chunk_id, ChunkOffset{offset}};
+        matches[output_start_offset + offset] = RowID{chunk_id, ChunkOffset{first_match_offset + offset}};
       }
     }
 
@@ -160,6 +211,13 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  const auto& attribute_vector = *segment.attribute_vector();
+  if (!position_filter && attribute_vector.type() == CompressedVectorType::SimdBp128) {
+    _scan_simd_bp128_attribute_vector(static_cast<const SimdBp128Vector&>(attribute_vector), segment.null_value_id(),
+                                      search_value_id, chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -180,6 +238,94 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_fsst_segment(
+    const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  // FSST encoding is deterministic for a given symbol table. Thus, the search value is compressed once and compared to
+  // the codes of each row, which avoids decompressing the rows.
+  auto search_codes = std::string{};
+  segment.symbol_table().encode(boost::get<pmr_string>(value), search_codes);
+  const auto search_codes_view = std::string_view{search_codes};
+
+  auto iterable = FSSTCompressedValueIterable{segment};
+  iterable.with_iterators(position_filter, [&](auto it, const auto& end) {
+    if (predicate_condition == PredicateCondition::Equals) {
+      const auto comparator = [search_codes_view](const auto& position) {
+        return position.value() == search_codes_view;
+      };
+      _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+    } else {
+      const auto comparator = [search_codes_view](const auto& position) {
+        return position.value() != search_codes_view;
+      };
+      _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+    }
+  });
+}
+
+void ColumnVsValueTableScanImpl::_scan_simd_bp128_attribute_vector(const SimdBp128Vector& attribute_vector,
+                                                                   const ValueID null_value_id,
+                                                                   const ValueID search_value_id,
+                                                                   const ChunkID chunk_id,
+                                                                   RowIDPosList& matches) const {
+  constexpr auto BLOCK_SIZE = SimdBp128Vector::BLOCK_SIZE;
+
+  // The search value ID is at most the NULL value ID (i.e., the dictionary size). Thus, if all values of a block are
+  // smaller than the search value ID, the block does not contain NULLs and either all or none of its rows match.
+  const auto small_blocks_match = predicate_condition == PredicateCondition::NotEquals ||
+                                  predicate_condition == PredicateCondition::LessThan ||
+                                  predicate_condition == PredicateCondition::LessThanEquals;
+
+  // See _scan_dictionary_segment for the conditions that never match the NULL value ID.
+  const auto check_for_null = predicate_condition != PredicateCondition::Equals &&
+                              predicate_condition != PredicateCondition::LessThan &&
+                              predicate_condition != PredicateCondition::LessThanEquals;
+
+  // OpenMP directives do not work with strong type defs.
+  const auto raw_search_value_id = static_cast<ValueID::base_type>(search_value_id);
+  const auto raw_null_value_id = static_cast<ValueID::base_type>(null_value_id);
+
+  const auto size = attribute_vector.size();
+  const auto block_count = attribute_vector.block_count();
+  auto values = std::array<uint32_t, BLOCK_SIZE>{};
+  auto value_matches = std::array<uint8_t, BLOCK_SIZE>{};
+
+  _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      const auto block_begin = block_index * BLOCK_SIZE;
+      const auto value_count = std::min(BLOCK_SIZE, size - block_begin);
+
+      if (attribute_vector.block_max_value(block_index) < raw_search_value_id) {
+        if (small_blocks_match) {
+          for (auto offset = size_t{0}; offset < value_count; ++offset) {
+            matches.emplace_back(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(block_begin + offset)});
+          }
+        }
+        continue;
+      }
+
+      attribute_vector.decompress_block(block_index, values.data());
+
+      // This empty block is used to convince clang-format to keep the pragma indented.
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd
+      // clang-format on
+      for (auto offset = size_t{0}; offset < BLOCK_SIZE; ++offset) {
+        const auto value = values[offset];
+        value_matches[offset] =
+            predicate_comparator(value, raw_search_value_id) && (!check_for_null || value != raw_null_value_id);
+      }
+
+      for (auto offset = size_t{0}; offset < value_count; ++offset) {
+        if (value_matches[offset]) {
+          matches.emplace_back(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(block_begin + offset)});
+        }
+      }
+    }
+  });
+}
+
 void ColumnVsValueTableScanImpl::_scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id,
                                                       RowIDPosList& matches,
                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
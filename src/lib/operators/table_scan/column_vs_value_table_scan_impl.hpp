@@ -14,13 +14,22 @@
 
 namespace hyrise {
 
+template <typename T>
+class FSSTSegment;
+class SimdBp128Vector;
+
 /**
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
  * - Value segments are scanned sequentially
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   enables us to detect if all or none of the values in the segment satisfy the expression. If the attribute vector
+ *   is a SimdBp128Vector, it is unpacked block by block and blocks that cannot contain the search value ID are not
+ *   unpacked at all.
+ * - For FSST segments, (in)equality is checked on the codes, as equal strings are always compressed to equal codes.
+ * - Other encoded segments of numeric columns are decoded block by block (see segment_decode_blocks) and the predicate
+ *   is evaluated on the decoded arrays.
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -39,6 +48,9 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
+  void _scan_decoded_blocks(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches) const;
 
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode);
@@ -54,6 +66,10 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
 
   bool _value_matches_none(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
 
+  void _scan_simd_bp128_attribute_vector(const SimdBp128Vector& attribute_vector, const ValueID null_value_id,
+                                         const ValueID search_value_id, const ChunkID chunk_id,
+                                         RowIDPosList& matches) const;
+
   template <typename Functor>
   void _with_operator_for_dict_segment_scan(const Functor& func) const {
     switch (predicate_condition) {
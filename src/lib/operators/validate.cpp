@@ -1,5 +1,7 @@
 #include "validate.hpp"
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -14,10 +16,11 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"  // IWYU pragma: keep
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/job_task.hpp"
+#include "operators/get_table.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/chunk.hpp"
 #include "storage/mvcc_data.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
@@ -38,6 +41,31 @@ bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOff
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+bool is_bit_set(const std::vector<uint64_t>& bitmap, const ChunkOffset chunk_offset) {
+  return (bitmap[chunk_offset / 64] >> (chunk_offset % 64)) & 1u;
+}
+
+// Collects the stored tables that the plan below Validate reads. They are part of the read set of serializable
+// transactions even if none of their rows is visible.
+void collect_stored_tables(const std::shared_ptr<const AbstractOperator>& op,
+                           std::vector<std::shared_ptr<const Table>>& stored_tables) {
+  if (!op) {
+    return;
+  }
+
+  if (op->type() == OperatorType::GetTable) {
+    const auto& table_name = static_cast<const GetTable&>(*op).table_name();
+    const auto& storage_manager = Hyrise::get().storage_manager;
+    if (storage_manager.has_table(table_name)) {
+      stored_tables.emplace_back(storage_manager.get_table(table_name));
+    }
+    return;
+  }
+
+  collect_stored_tables(op->left_input(), stored_tables);
+  collect_stored_tables(op->right_input(), stored_tables);
+}
+
 }  // namespace
 
 bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
@@ -51,6 +79,16 @@ bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+bool Validate::_can_use_visibility_bitmap(const std::shared_ptr<const Chunk>& chunk,
+                                          const CommitID snapshot_commit_id) const {
+  if (!_can_use_chunk_shortcut || chunk->is_mutable()) {
+    return false;
+  }
+
+  const auto& mvcc_data = chunk->mvcc_data();
+  return mvcc_data->is_compacted() && snapshot_commit_id >= mvcc_data->max_begin_cid.load();
+}
+
 bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk,
                                         const CommitID snapshot_commit_id) const {
   if (!_can_use_chunk_shortcut) {
@@ -95,15 +133,10 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
   output_chunks.reserve(chunk_count);
   auto output_mutex = std::mutex{};
 
-  auto job_start_chunk_id = ChunkID{0};
-  auto job_end_chunk_id = ChunkID{0};
-  auto job_row_count = uint32_t{0};
-
   // In some cases, we can identify a chunk as being entirely visible for the current transaction. Simply said,
   // if the youngest row in a chunk is visible, all other rows are older and hence visible, too. This applies if
   // (1) the chunk is immutable, i.e., no new rows can be added while this transaction is being executed,
@@ -120,41 +153,50 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
     }
   }
 
-  while (job_end_chunk_id < chunk_count) {
-    const auto chunk = input_table->get_chunk(job_end_chunk_id);
+  auto chunk_sizes = std::vector<ChunkOffset>(chunk_count);
+  auto chunk_node_ids = std::vector<NodeID>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    chunk_sizes[chunk_id] = chunk->size();
+    chunk_node_ids[chunk_id] = numa_node_of_chunk(*chunk);
+  }
 
-    // Small chunks are bundled together to avoid unnecessary scheduling overhead.
-    // Therefore, we count the number of rows to ensure a minimum of rows per job (default chunk size).
-    job_row_count += chunk->size();
-    if (job_row_count >= Chunk::DEFAULT_SIZE || job_end_chunk_id == (chunk_count - 1)) {
-      // Single tasks are executed directly instead of scheduling a single job.
-      const auto execute_directly = job_start_chunk_id == 0 && job_end_chunk_id == (chunk_count - 1);
-
-      if (execute_directly) {
-        _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks,
-                         output_mutex);
-      } else {
-        jobs.push_back(std::make_shared<JobTask>([&, input_table, job_start_chunk_id, job_end_chunk_id] {
-          _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
-                           output_chunks, output_mutex);
-        }));
-
-        // Prepare next job
-        job_start_chunk_id = job_end_chunk_id + 1;
-        job_row_count = 0;
-      }
+  // Small chunks are bundled together to avoid unnecessary scheduling overhead (see MorselDispatcher). Large chunks of
+  // data tables are split if the MVCC data of each row has to be checked. Entirely visible chunks and chunks with a
+  // visibility bitmap are cheap to validate, and reference chunks have to be validated as a whole to share their
+  // PosLists between the output segments.
+  const auto split_chunk = [&](const ChunkID chunk_id) {
+    if (input_table->type() != TableType::Data) {
+      return false;
     }
-    job_end_chunk_id++;
-  }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    const auto chunk = input_table->get_chunk(chunk_id);
+    return !chunk->is_mutable() && !_is_entire_chunk_visible(chunk, snapshot_commit_id) &&
+           !_can_use_visibility_bitmap(chunk, snapshot_commit_id);
+  };
+
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::Validate};
+  const auto morsels = morsel_dispatcher.create_morsels(chunk_sizes, split_chunk, chunk_node_ids);
+  morsel_dispatcher.execute(morsels, [&](const auto& morsel) {
+    _validate_chunks(input_table, morsel, our_tid, snapshot_commit_id, output_chunks, output_mutex);
+  });
+
+  auto output_table =
+      std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+
+  // Serializable transactions validate at commit time that the rows they have seen did not change concurrently.
+  if (transaction_context->isolation_level() == IsolationLevel::Serializable) {
+    auto read_tables = std::vector<std::shared_ptr<const Table>>{};
+    collect_stored_tables(left_input(), read_tables);
+    transaction_context->register_read_set(read_tables, output_table);
+  }
 
-  return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+  return output_table;
 }
 
-void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id_start,
-                                const ChunkID chunk_id_end, const TransactionID our_tid,
+void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
+                                const MorselDispatcher::Morsel& morsel, const TransactionID our_tid,
                                 const CommitID snapshot_commit_id, std::vector<std::shared_ptr<Chunk>>& output_chunks,
                                 std::mutex& output_mutex) const {
   // Stores whether a chunk has been found to be entirely visible. Only used for reference tables where no single
@@ -164,7 +206,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
   auto entirely_visible_chunks = std::vector<bool>{};
   auto entirely_visible_chunks_table = std::shared_ptr<const Table>{};  // used only for sanity check
 
-  for (auto chunk_id = chunk_id_start; chunk_id <= chunk_id_end; ++chunk_id) {
+  for (auto chunk_id = morsel.chunk_id_begin; chunk_id < morsel.chunk_id_end; ++chunk_id) {
     const auto chunk_in = input_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -206,6 +248,16 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
           // We can reuse the old PosList since it is entirely visible. Not using the entirely_visible_chunks cache for
           // this shortcut to keep the code short.
           pos_list_out = pos_list_in;
+        } else if (_can_use_visibility_bitmap(referenced_chunk, snapshot_commit_id)) {
+          const auto visible_rows = mvcc_data->visible_rows(snapshot_commit_id, referenced_chunk->size());
+          auto temp_pos_list = RowIDPosList{};
+          temp_pos_list.guarantee_single_chunk();
+          for (const auto row_id : *pos_list_in) {
+            if (is_bit_set(visible_rows, row_id.chunk_offset)) {
+              temp_pos_list.emplace_back(row_id);
+            }
+          }
+          pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
         } else {
           auto temp_pos_list = RowIDPosList{};
           temp_pos_list.guarantee_single_chunk();
@@ -268,9 +320,39 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
 
       DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data.");
 
-      if (_is_entire_chunk_visible(chunk_in, snapshot_commit_id)) {
+      if (morsel.chunk_offsets) {
+        // The morsel is a row range of a split chunk. Chunks are only split if the MVCC data of each row has to be
+        // checked (see _on_execute()).
+        const auto [begin_offset, end_offset] = *morsel.chunk_offsets;
+        const auto mvcc_data = chunk_in->mvcc_data();
+        auto temp_pos_list = RowIDPosList{};
+        temp_pos_list.reserve(end_offset - begin_offset);
+        temp_pos_list.guarantee_single_chunk();
+        for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+          if (hyrise::is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_data)) {
+            temp_pos_list.emplace_back(chunk_id, chunk_offset);
+          }
+        }
+        pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+      } else if (_is_entire_chunk_visible(chunk_in, snapshot_commit_id)) {
         // Not using the entirely_visible_chunks cache here as for data tables, we only look at chunks once anyway.
         pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
+      } else if (_can_use_visibility_bitmap(chunk_in, snapshot_commit_id)) {
+        // For compacted MVCC data, we get the visible rows as a bitmap and only have to find its set bits.
+        const auto visible_rows = chunk_in->mvcc_data()->visible_rows(snapshot_commit_id, chunk_in->size());
+        auto temp_pos_list = RowIDPosList{};
+        temp_pos_list.reserve(expected_number_of_valid_rows);
+        temp_pos_list.guarantee_single_chunk();
+        const auto word_count = visible_rows.size();
+        for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+          auto word = visible_rows[word_index];
+          while (word != 0) {
+            const auto chunk_offset = static_cast<ChunkOffset::base_type>(word_index * 64 + std::countr_zero(word));
+            temp_pos_list.emplace_back(chunk_id, ChunkOffset{chunk_offset});
+            word &= word - 1;
+          }
+        }
+        pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
       } else {
         const auto mvcc_data = chunk_in->mvcc_data();
         auto temp_pos_list = RowIDPosList{};
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -16,6 +17,9 @@ namespace hyrise {
  * within the context of a given transaction
  *
  * Assumption: Validate happens before joins.
+ *
+ * For serializable transactions, Validate registers its input tables and output as the read set of the transaction,
+ * which is validated at commit time (see TransactionContext).
  */
 class Validate : public AbstractReadOnlyOperator {
   friend class OperatorsValidateTest;
@@ -30,14 +34,20 @@ class Validate : public AbstractReadOnlyOperator {
                              const CommitID begin_cid, const CommitID end_cid);
 
  private:
-  void _validate_chunks(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id_start,
-                        const ChunkID chunk_id_end, const TransactionID our_tid, const CommitID snapshot_commit_id,
+  // Validates the chunks or the row range of the morsel.
+  void _validate_chunks(const std::shared_ptr<const Table>& input_table, const MorselDispatcher::Morsel& morsel,
+                        const TransactionID our_tid, const CommitID snapshot_commit_id,
                         std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex) const;
 
   // This is a performance optimization that can only be used if a couple of conditions are met, i.e., if
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
+  // Chunks with compacted MVCC data provide their visible rows as a bitmap (see MvccData::visible_rows()). Like the
+  // shortcut above, this requires _can_use_chunk_shortcut since the bitmap does not consider rows locked by our own
+  // Deletes.
+  bool _can_use_visibility_bitmap(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
+
   bool _can_use_chunk_shortcut = true;
 
  protected:
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/admission_control.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
@@ -56,4 +57,8 @@ void AbstractScheduler::schedule_and_wait_for_tasks(const std::vector<std::share
   wait_for_tasks(tasks);
 }
 
+AdmissionControl& AbstractScheduler::admission_control() {
+  return _admission_control;
+}
+
 }  // namespace hyrise
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/admission_control.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "worker.hpp"
@@ -51,6 +52,14 @@ class TaskQueue;
  * `schedule_and_wait_for_tasks()` is preferable as it optimizes scheduling many tasks (e.g., grouping tasks, see
  * `_group_tasks()`).
  *
+ *
+ * QUERY PRIORITIES AND ADMISSION
+ *
+ * Queries belong to SchedulingGroups, e.g., one per server session. The tasks of queries of high-priority groups are
+ * scheduled with SchedulePriority::High, and so are the tasks they spawn. Workers prefer high-priority tasks over all
+ * other tasks. Additionally, the AdmissionControl can limit the number of concurrently executed queries of default
+ * priority and shares the available slots between the groups according to their weights.
+ *
  */
 
 class AbstractScheduler : public Noncopyable {
@@ -96,6 +105,12 @@ class AbstractScheduler : public Noncopyable {
    */
   void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
 
+  /**
+   * Limits the number of concurrently executed queries (see AdmissionControl). Queries are admitted by the
+   * SQLPipelineStatement.
+   */
+  AdmissionControl& admission_control();
+
  protected:
   friend class AbstractTask;
   /**
@@ -115,6 +130,9 @@ class AbstractScheduler : public Noncopyable {
    * parallelism and reduce scheduling overhead.
    */
   virtual void _group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const = 0;
+
+ private:
+  AdmissionControl _admission_control;
 };
 
 }  // namespace hyrise
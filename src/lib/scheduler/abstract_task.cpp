@@ -5,6 +5,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "hyrise.hpp"
@@ -12,6 +13,35 @@
 #include "utils/assert.hpp"
 #include "worker.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+/**
+ * Priority of the task that is currently executed on this thread. Tasks scheduled by it inherit a high priority.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables): modified whenever a task is executed.
+thread_local SchedulePriority current_task_priority = SchedulePriority::Default;
+
+// Restores the priority of the enclosing task once a (possibly nested) task finished, even if it threw an exception.
+class CurrentTaskPriorityScope : private Noncopyable {
+ public:
+  explicit CurrentTaskPriorityScope(const SchedulePriority priority)
+      : _previous_priority{std::exchange(current_task_priority, priority)} {}
+
+  ~CurrentTaskPriorityScope() {
+    current_task_priority = _previous_priority;
+  }
+
+  void operator=(const CurrentTaskPriorityScope&) = delete;
+  void operator=(CurrentTaskPriorityScope&&) = delete;
+
+ private:
+  const SchedulePriority _previous_priority;
+};
+
+}  // namespace
+
 namespace hyrise {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority{priority}, _stealable{stealable} {}
@@ -36,6 +66,15 @@ bool AbstractTask::is_stealable() const {
   return _stealable;
 }
 
+SchedulePriority AbstractTask::priority() const {
+  return _priority;
+}
+
+void AbstractTask::set_priority(const SchedulePriority priority) {
+  DebugAssert(!is_scheduled(), "Cannot change the priority of a scheduled task.");
+  _priority = priority;
+}
+
 bool AbstractTask::is_scheduled() const {
   return _state >= TaskState::Scheduled;
 }
@@ -82,6 +121,15 @@ void AbstractTask::set_node_id(NodeID node_id) {
   _node_id = node_id;
 }
 
+NodeID AbstractTask::preferred_node_id() const {
+  return _preferred_node_id;
+}
+
+void AbstractTask::set_preferred_node_id(const NodeID preferred_node_id) {
+  DebugAssert(!is_scheduled(), "Cannot change the preferred node of a scheduled task.");
+  _preferred_node_id = preferred_node_id;
+}
+
 bool AbstractTask::try_mark_as_enqueued() {
   return _try_transition_to(TaskState::Enqueued);
 }
@@ -105,12 +153,19 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
   // _task_done.
   std::atomic_thread_fence(std::memory_order_seq_cst);
 
+  // Inherit the priority of the task that spawns this task. We update the priority before the task is marked as
+  // scheduled, as it might be executed right afterwards.
+  if (current_task_priority == SchedulePriority::High) {
+    _priority = SchedulePriority::High;
+  }
+
   // Atomically marks the task as scheduled or returns if another thread has already scheduled it.
   if (!_try_transition_to(TaskState::Scheduled)) {
     return;
   }
 
-  Hyrise::get().scheduler()->_schedule(shared_from_this(), preferred_node_id, _priority);
+  const auto node_id = preferred_node_id != CURRENT_NODE_ID ? preferred_node_id : _preferred_node_id.load();
+  Hyrise::get().scheduler()->_schedule(shared_from_this(), node_id, _priority);
 }
 
 void AbstractTask::_join() {
@@ -137,7 +192,10 @@ void AbstractTask::execute() {
   // _is_scheduled and this assert (potentially in "thread" B) reads it, it is guaranteed that no writes of whoever
   // spawned the task are pushed down to a point where this thread is already running.
 
-  _on_execute();
+  {
+    const auto priority_scope = CurrentTaskPriorityScope{_priority};
+    _on_execute();
+  }
 
   for (auto& successor : _successors) {
     // macOS silently ignores non-reachable successors (see `SuccessorExpired` test). Thus, we obtain a shared pointer
@@ -113,6 +113,14 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  /**
+   * The priority with which the task is scheduled. Tasks that are scheduled while a high-priority task is executed on
+   * the same thread (e.g., JobTasks spawned by an operator of a high-priority query) are scheduled with a high priority
+   * as well. The priority can only be changed before the task is scheduled.
+   */
+  SchedulePriority priority() const;
+  void set_priority(const SchedulePriority priority);
+
   /**
    * Description for debugging purposes.
    */
@@ -145,6 +153,14 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The node whose TaskQueue the task is pushed to when it is scheduled without an explicit node (e.g., by
+   * AbstractScheduler::schedule_and_wait_for_tasks()). Chunk-parallel operators prefer the node that holds the chunk's
+   * data (see MorselDispatcher). Defaults to CURRENT_NODE_ID. Can only be changed before the task is scheduled.
+   */
+  NodeID preferred_node_id() const;
+  void set_preferred_node_id(const NodeID preferred_node_id);
+
   /**
    * Callback to be executed right after the task finished. Notice the execution of the callback might happen on ANY
    * thread.
@@ -152,7 +168,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   void set_done_callback(const std::function<void()>& done_callback);
 
   /**
-   * Schedules the task if a scheduler is available, otherwise just executes it on the current thread.
+   * Schedules the task if a scheduler is available, otherwise just executes it on the current thread. Without an
+   * explicit node, the task is scheduled for its preferred node.
    */
   void schedule(NodeID preferred_node_id = CURRENT_NODE_ID);
 
@@ -202,7 +219,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id{INVALID_NODE_ID};
-  SchedulePriority _priority;
+  std::atomic<NodeID> _preferred_node_id{CURRENT_NODE_ID};
+  std::atomic<SchedulePriority> _priority;
   std::atomic_bool _stealable;
   std::function<void()> _done_callback;
 
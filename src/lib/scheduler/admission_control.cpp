@@ -0,0 +1,100 @@
+#include "admission_control.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+
+#include "scheduling_group.hpp"
+#include "types.hpp"
+#include "worker.hpp"
+
+namespace hyrise {
+
+AdmissionControl::Ticket::Ticket(AdmissionControl& admission_control, const bool counted)
+    : _admission_control{admission_control}, _counted{counted} {}
+
+AdmissionControl::Ticket::~Ticket() {
+  if (_counted) {
+    _admission_control._release();
+  }
+}
+
+AdmissionControl::Ticket AdmissionControl::admit(SchedulingGroup& scheduling_group) {
+  if (scheduling_group.priority() == SchedulePriority::High || Worker::get_this_thread_worker()) {
+    return Ticket{*this, false};
+  }
+
+  auto lock = std::unique_lock{_mutex};
+
+  // Do not overtake queries that are already waiting.
+  if (_max_concurrent_queries == UNLIMITED || (_running_query_count < _max_concurrent_queries && _waiters.empty())) {
+    ++_running_query_count;
+    _charge(scheduling_group);
+    return Ticket{*this, true};
+  }
+
+  auto waiter = Waiter{scheduling_group};
+  _waiters.emplace_back(&waiter);
+  _condition_variable.wait(lock, [&]() {
+    return waiter.admitted;
+  });
+  return Ticket{*this, true};
+}
+
+void AdmissionControl::set_max_concurrent_queries(const size_t max_concurrent_queries) {
+  const auto lock = std::lock_guard{_mutex};
+  _max_concurrent_queries = max_concurrent_queries;
+  _admit_waiters();
+}
+
+size_t AdmissionControl::max_concurrent_queries() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _max_concurrent_queries;
+}
+
+size_t AdmissionControl::running_query_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _running_query_count;
+}
+
+size_t AdmissionControl::waiting_query_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _waiters.size();
+}
+
+void AdmissionControl::_release() {
+  const auto lock = std::lock_guard{_mutex};
+  --_running_query_count;
+  _admit_waiters();
+}
+
+void AdmissionControl::_charge(SchedulingGroup& scheduling_group) {
+  const auto start = std::max(scheduling_group._pass, _virtual_time);
+  _virtual_time = start;
+  scheduling_group._pass = start + SchedulingGroup::STRIDE_NUMERATOR / scheduling_group.weight();
+}
+
+void AdmissionControl::_admit_waiters() {
+  auto admitted_any = false;
+  while (!_waiters.empty() &&
+         (_max_concurrent_queries == UNLIMITED || _running_query_count < _max_concurrent_queries)) {
+    // Idle groups start at the current virtual time. Ties are broken by the arrival order, as min_element returns the
+    // first minimum.
+    const auto next_waiter = std::ranges::min_element(_waiters, [&](const auto* lhs, const auto* rhs) {
+      return std::max(lhs->scheduling_group._pass, _virtual_time) <
+             std::max(rhs->scheduling_group._pass, _virtual_time);
+    });
+
+    (*next_waiter)->admitted = true;
+    ++_running_query_count;
+    _charge((*next_waiter)->scheduling_group);
+    _waiters.erase(next_waiter);
+    admitted_any = true;
+  }
+
+  if (admitted_any) {
+    _condition_variable.notify_all();
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class SchedulingGroup;
+
+/**
+ * Limits the number of queries that are executed concurrently. Without a limit, every query splits its operators into
+ * many tasks and all of them compete for the workers, which increases the latency of every single query. With a
+ * limit, further queries wait in SQLPipelineStatement::get_result_table() until a running query finishes.
+ *
+ * Waiting queries are admitted fairly across SchedulingGroups using stride scheduling: the query of the group with
+ * the lowest pass is admitted next, and the group's pass is then advanced by a stride inversely proportional to its
+ * weight. A group that was idle starts at the current virtual time so that it cannot claim the slots it did not use.
+ * Queries of high-priority groups are not subject to the limit, as short transactional statements should never wait
+ * for the analytical queries that occupy the slots. Neither are queries issued by workers (e.g., by plugins), as a
+ * blocked worker could not execute the tasks of the queries that hold the slots.
+ *
+ * By default, the number of concurrent queries is not limited.
+ */
+class AdmissionControl : private Noncopyable {
+ public:
+  /**
+   * Releases the admission slot of a query when destroyed.
+   */
+  class Ticket : private Noncopyable {
+   public:
+    ~Ticket();
+
+    void operator=(const Ticket&) = delete;
+    void operator=(Ticket&&) = delete;
+
+   protected:
+    friend class AdmissionControl;
+
+    Ticket(AdmissionControl& admission_control, const bool counted);
+
+   private:
+    AdmissionControl& _admission_control;
+    const bool _counted;
+  };
+
+  static constexpr auto UNLIMITED = size_t{0};
+
+  /**
+   * Blocks until the query may be executed.
+   */
+  [[nodiscard]] Ticket admit(SchedulingGroup& scheduling_group);
+
+  /**
+   * Sets the maximum number of concurrently executed queries of default priority. UNLIMITED disables the limit.
+   * Waiting queries are admitted immediately if the limit is raised.
+   */
+  void set_max_concurrent_queries(const size_t max_concurrent_queries);
+  size_t max_concurrent_queries() const;
+
+  size_t running_query_count() const;
+  size_t waiting_query_count() const;
+
+ protected:
+  struct Waiter {
+    SchedulingGroup& scheduling_group;
+    bool admitted{false};
+  };
+
+  void _release();
+
+  // Advances the pass of the group of an admitted query. Expects _mutex to be locked.
+  void _charge(SchedulingGroup& scheduling_group);
+
+  // Admits waiting queries while slots are free. Expects _mutex to be locked.
+  void _admit_waiters();
+
+  mutable std::mutex _mutex;
+  std::condition_variable _condition_variable;
+  size_t _max_concurrent_queries{UNLIMITED};
+  size_t _running_query_count{0};
+  uint64_t _virtual_time{0};
+  std::list<Waiter*> _waiters;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,209 @@
+#include "morsel_dispatcher.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "magic_enum/magic_enum.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Moving average of the cost per row in nanoseconds for each operator type. Zero denotes that no cost has been
+// measured yet.
+using CostStatistics = std::array<std::atomic<double>, magic_enum::enum_count<OperatorType>()>;
+
+CostStatistics& cost_statistics() {
+  static auto statistics = CostStatistics{};
+  return statistics;
+}
+
+// Avoids dividing by zero for operators that skip all rows (e.g., scans of pruned chunks).
+constexpr auto MIN_COST_PER_ROW = 0.1;
+
+}  // namespace
+
+namespace hyrise {
+
+MorselDispatcher::MorselDispatcher(const OperatorType operator_type) : _operator_type{operator_type} {}
+
+std::vector<MorselDispatcher::Morsel> MorselDispatcher::create_morsels(
+    const std::vector<ChunkOffset>& chunk_sizes, const std::function<bool(ChunkID)>& split_chunk,
+    const std::vector<NodeID>& chunk_node_ids) const {
+  DebugAssert(chunk_node_ids.empty() || chunk_node_ids.size() == chunk_sizes.size(),
+              "Expected one node ID per chunk.");
+
+  auto total_row_count = size_t{0};
+  for (const auto chunk_size : chunk_sizes) {
+    total_row_count += chunk_size;
+  }
+
+  const auto target_size = target_morsel_size(total_row_count);
+  const auto is_multi_threaded = Hyrise::get().is_multi_threaded();
+  const auto may_split = split_chunk && is_multi_threaded;
+  const auto use_nodes = !chunk_node_ids.empty() && is_multi_threaded;
+  const auto chunk_count = static_cast<ChunkID::base_type>(chunk_sizes.size());
+
+  auto morsels = std::vector<Morsel>{};
+  auto current_morsel = Morsel{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_size = size_t{chunk_sizes[chunk_id]};
+    const auto node_id = use_nodes ? chunk_node_ids[chunk_id] : INVALID_NODE_ID;
+
+    if (may_split && chunk_size > target_size && split_chunk(chunk_id)) {
+      if (current_morsel.chunk_id_end > current_morsel.chunk_id_begin) {
+        morsels.emplace_back(current_morsel);
+      }
+
+      // Split the chunk into ranges of (almost) equal size.
+      const auto range_count = (chunk_size + target_size - 1) / target_size;
+      const auto range_size = (chunk_size + range_count - 1) / range_count;
+      for (auto range_begin = size_t{0}; range_begin < chunk_size; range_begin += range_size) {
+        const auto range_end = std::min(range_begin + range_size, chunk_size);
+        morsels.emplace_back(Morsel{chunk_id, ChunkID{chunk_id + 1},
+                                    std::pair{ChunkOffset{static_cast<ChunkOffset::base_type>(range_begin)},
+                                              ChunkOffset{static_cast<ChunkOffset::base_type>(range_end)}},
+                                    range_end - range_begin, node_id});
+      }
+
+      current_morsel = Morsel{ChunkID{chunk_id + 1}, ChunkID{chunk_id + 1}, std::nullopt, 0};
+      continue;
+    }
+
+    // Coalesce the chunk with the current morsel unless the morsel would exceed the target size or its rows are stored
+    // on another node.
+    if (current_morsel.row_count > 0 && chunk_size > 0 &&
+        (current_morsel.row_count + chunk_size > target_size || current_morsel.node_id != node_id)) {
+      morsels.emplace_back(current_morsel);
+      current_morsel = Morsel{chunk_id, chunk_id, std::nullopt, 0};
+    }
+
+    if (current_morsel.row_count == 0) {
+      current_morsel.node_id = node_id;
+    }
+
+    current_morsel.chunk_id_end = ChunkID{chunk_id + 1};
+    current_morsel.row_count += chunk_size;
+  }
+
+  if (current_morsel.chunk_id_end > current_morsel.chunk_id_begin) {
+    morsels.emplace_back(current_morsel);
+  }
+
+  return morsels;
+}
+
+void MorselDispatcher::execute(const std::vector<Morsel>& morsels,
+                               const std::function<void(const Morsel&)>& morsel_function) const {
+  const auto execute_morsel = [&](const Morsel& morsel) {
+    auto timer = Timer{};
+    morsel_function(morsel);
+    record_runtime(morsel.row_count, timer.lap());
+  };
+
+  // A single morsel is executed directly instead of scheduling a single job.
+  if (morsels.size() == 1) {
+    execute_morsel(morsels.front());
+    return;
+  }
+
+  // Nodes of the chunk placement might not exist in the scheduler's topology (e.g., if the topology changed since).
+  const auto node_count = Hyrise::get().scheduler()->queues().size();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(morsels.size());
+  for (const auto& morsel : morsels) {
+    const auto job = std::make_shared<JobTask>([&execute_morsel, &morsel]() {
+      execute_morsel(morsel);
+    });
+    if (morsel.node_id != INVALID_NODE_ID && morsel.node_id < node_count) {
+      job->set_preferred_node_id(morsel.node_id);
+    }
+    jobs.emplace_back(job);
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+size_t MorselDispatcher::target_morsel_size(const size_t total_row_count) const {
+  const auto cost = std::max(cost_per_row().count(), MIN_COST_PER_ROW);
+  const auto min_rows = std::max(
+      size_t{1}, static_cast<size_t>(std::chrono::duration<double, std::nano>{MIN_MORSEL_RUNTIME}.count() / cost));
+  const auto max_rows = std::max(
+      min_rows, static_cast<size_t>(std::chrono::duration<double, std::nano>{MAX_MORSEL_RUNTIME}.count() / cost));
+
+  if (!Hyrise::get().is_multi_threaded()) {
+    return max_rows;
+  }
+
+  const auto worker_count = std::max(size_t{1}, Hyrise::get().topology.num_cpus());
+  const auto& scheduler = Hyrise::get().scheduler();
+  auto queued_task_count = size_t{0};
+  for (const auto& queue : scheduler->queues()) {
+    queued_task_count += queue->estimate_load();
+  }
+
+  // Most tasks spawned by operators are pushed to the deques of the workers rather than to the TaskQueues.
+  if (const auto node_queue_scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(scheduler)) {
+    for (const auto& worker : node_queue_scheduler->workers()) {
+      queued_task_count += worker->estimate_load();
+    }
+  }
+
+  // The workers are busy with tasks of other queries. Splitting the rows further only adds scheduling overhead.
+  if (queued_task_count >= worker_count) {
+    return max_rows;
+  }
+
+  const auto morsel_count = worker_count * MORSELS_PER_WORKER;
+  return std::clamp((total_row_count + morsel_count - 1) / morsel_count, min_rows, max_rows);
+}
+
+std::chrono::duration<double, std::nano> MorselDispatcher::cost_per_row() const {
+  const auto cost = cost_statistics()[magic_enum::enum_integer(_operator_type)].load();
+  if (cost == 0.0) {
+    return DEFAULT_COST_PER_ROW;
+  }
+
+  return std::chrono::duration<double, std::nano>{cost};
+}
+
+void MorselDispatcher::record_runtime(const size_t row_count, const std::chrono::nanoseconds runtime) const {
+  if (row_count < MIN_MEASURED_ROW_COUNT) {
+    return;
+  }
+
+  // Concurrent updates might overwrite each other. As the statistics are only estimates, we accept losing a sample.
+  auto& cost = cost_statistics()[magic_enum::enum_integer(_operator_type)];
+  const auto measured_cost = std::max(static_cast<double>(runtime.count()) / static_cast<double>(row_count),
+                                      MIN_COST_PER_ROW);
+  const auto previous_cost = cost.load();
+  cost = previous_cost == 0.0 ? measured_cost
+                              : (1.0 - SMOOTHING_FACTOR) * previous_cost + SMOOTHING_FACTOR * measured_cost;
+}
+
+void MorselDispatcher::reset_cost_statistics() {
+  for (auto& cost : cost_statistics()) {
+    cost = 0.0;
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+enum class OperatorType;
+
+/**
+ * Splits the input of a parallel operator into morsels, i.e., units of work that are executed by one JobTask each.
+ * With one job per chunk above a fixed row threshold, tables with few large chunks do not keep all workers busy, and
+ * tables with many small chunks spawn far more jobs than there are workers.
+ *
+ * The dispatcher determines a target morsel size from two inputs:
+ *   - The measured cost per row of the operator type. Every executed morsel updates an exponential moving average, so
+ *     that a morsel takes between MIN_MORSEL_RUNTIME (to amortize the scheduling overhead) and MAX_MORSEL_RUNTIME (to
+ *     balance the load between the workers). Until the first measurement, DEFAULT_COST_PER_ROW is assumed.
+ *   - The current load of the scheduler. If the TaskQueues hold fewer tasks than there are workers, the rows are
+ *     spread over MORSELS_PER_WORKER morsels per worker (within the runtime bounds). If the workers are already busy
+ *     with other queries, further parallelism does not pay off and morsels are as large as possible.
+ *
+ * Consecutive chunks that are smaller than the target size are coalesced into one morsel. Chunks that are larger can
+ * be split into row ranges, but only if the operator can process parts of a chunk (see `split_chunk` in
+ * create_morsels()). Validate and TableScan split chunks of data tables (the TableScan only for predicates on a single
+ * column). Projection and the join materializers evaluate or materialize entire chunks and thus do not split them.
+ *
+ * If the chunks are placed on NUMA nodes (see numa_placement.hpp), only chunks of the same node are coalesced, and the
+ * job of a morsel is scheduled on the node of its chunks.
+ *
+ * Cost statistics are kept per OperatorType and shared by all dispatchers.
+ */
+class MorselDispatcher : private Noncopyable {
+ public:
+  /**
+   * A morsel covers the chunks [chunk_id_begin, chunk_id_end). If the morsel is a row range of a single (split) chunk,
+   * chunk_offsets holds the range [begin, end) within chunk_id_begin. node_id is the NUMA node of the morsel's chunks
+   * or INVALID_NODE_ID if they are not placed on a node.
+   */
+  struct Morsel {
+    ChunkID chunk_id_begin{0};
+    ChunkID chunk_id_end{0};
+    std::optional<std::pair<ChunkOffset, ChunkOffset>> chunk_offsets;
+
+    size_t row_count{0};
+    NodeID node_id{INVALID_NODE_ID};
+  };
+
+  static constexpr auto MIN_MORSEL_RUNTIME = std::chrono::microseconds{50};
+  static constexpr auto MAX_MORSEL_RUNTIME = std::chrono::microseconds{2'000};
+  static constexpr auto DEFAULT_COST_PER_ROW = std::chrono::duration<double, std::nano>{10.0};
+  static constexpr auto MORSELS_PER_WORKER = size_t{4};
+
+  explicit MorselDispatcher(const OperatorType operator_type);
+
+  /**
+   * Creates the morsels for chunks of the given sizes. Chunks of size 0 (e.g., excluded or physically deleted chunks)
+   * are coalesced with their neighbours and have to be skipped by the caller. If `split_chunk` is passed, chunks that
+   * exceed the target size and for which it returns true are split into row ranges. If `chunk_node_ids` is passed
+   * (see numa_node_of_chunk()), non-empty chunks of different nodes are not coalesced.
+   */
+  std::vector<Morsel> create_morsels(const std::vector<ChunkOffset>& chunk_sizes,
+                                     const std::function<bool(ChunkID)>& split_chunk = nullptr,
+                                     const std::vector<NodeID>& chunk_node_ids = {}) const;
+
+  /**
+   * Executes `morsel_function` for all morsels, spawning one JobTask per morsel if there is more than one, and waits
+   * for their completion. Jobs of morsels with a node prefer the workers of that node. The runtime of each morsel
+   * updates the cost statistics of the operator type.
+   */
+  void execute(const std::vector<Morsel>& morsels, const std::function<void(const Morsel&)>& morsel_function) const;
+
+  /**
+   * Returns the number of rows a morsel should have for the given total number of rows to process.
+   */
+  size_t target_morsel_size(const size_t total_row_count) const;
+
+  /**
+   * Returns the estimated cost per row of the operator type, i.e., the moving average of the measured costs.
+   */
+  std::chrono::duration<double, std::nano> cost_per_row() const;
+
+  /**
+   * Updates the cost statistics with the runtime of a morsel. Morsels with few rows are ignored as their runtime is
+   * dominated by noise.
+   */
+  void record_runtime(const size_t row_count, const std::chrono::nanoseconds runtime) const;
+
+  /**
+   * Resets the cost statistics of all operator types. Called by Hyrise::reset().
+   */
+  static void reset_cost_statistics();
+
+ protected:
+  static constexpr auto MIN_MEASURED_ROW_COUNT = size_t{1'000};
+
+  // Weight of a new measurement in the exponential moving average.
+  static constexpr auto SMOOTHING_FACTOR = 0.2;
+
+ private:
+  const OperatorType _operator_type;
+};
+
+}  // namespace hyrise
@@ -7,9 +7,10 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
-#include <optional>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "abstract_task.hpp"
@@ -66,6 +67,24 @@ void NodeQueueScheduler::begin() {
   }
 
   Assert(!_active_nodes.empty(), "None of the system nodes has active workers.");
+
+  for (const auto& worker : _workers) {
+    auto same_node_workers = std::vector<Worker*>{};
+    auto remote_workers = std::vector<Worker*>{};
+    for (const auto& victim : _workers) {
+      if (victim == worker) {
+        continue;
+      }
+
+      if (victim->queue() == worker->queue()) {
+        same_node_workers.emplace_back(&*victim);
+      } else {
+        remote_workers.emplace_back(&*victim);
+      }
+    }
+    worker->set_steal_victims(std::move(same_node_workers), std::move(remote_workers));
+  }
+
   _active = true;
 
   for (auto& worker : _workers) {
@@ -250,6 +269,16 @@ void NodeQueueScheduler::_schedule(std::shared_ptr<AbstractTask> task, NodeID pr
     return;
   }
 
+  // Tasks that a worker spawns for its own node (e.g., the JobTasks of an operator) are pushed to the worker's deque
+  // rather than to the shared node queue.
+  if (priority == SchedulePriority::Default) {
+    const auto worker = Worker::get_this_thread_worker();
+    if (worker && (preferred_node_id == CURRENT_NODE_ID || preferred_node_id == worker->queue()->node_id()) &&
+        worker->try_push_local(task)) {
+      return;
+    }
+  }
+
   const auto node_id_for_queue = determine_queue_id(preferred_node_id);
   DebugAssert((static_cast<size_t>(node_id_for_queue) < _queues.size()),
               "Node ID is not within range of available nodes.");
@@ -257,25 +286,30 @@ void NodeQueueScheduler::_schedule(std::shared_ptr<AbstractTask> task, NodeID pr
 }
 
 void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const {
-  // Adds predecessor/successor relationships between tasks so that only NUM_GROUPS tasks can be executed in parallel.
-  // The optimal value of NUM_GROUPS depends on the number of cores and the number of queries being executed
+  // Adds predecessor/successor relationships between tasks so that only NUM_GROUPS tasks per node can be executed in
+  // parallel. The optimal value of NUM_GROUPS depends on the number of cores and the number of queries being executed
   // concurrently. The current value has been found with a divining rod.
 
   const auto task_count = tasks.size();
 
-  // For each group, this list stores the task that will be successor of the current task. Tasks are identified by their
-  // offset in the task list. Initialize with -1 to denote an invalid offset.
-  auto grouped_task_offsets = std::vector(NUM_GROUPS, -1);
+  // A chain of tasks is likely executed by the worker that executes its first task (see Worker::execute_next). Thus,
+  // tasks are only grouped with tasks of the same preferred node (e.g., jobs processing chunks stored on this node,
+  // see MorselDispatcher). For each group of a node, we store the task that will be successor of the current task.
+  // Tasks are identified by their offset in the task list. Initialize with -1 to denote an invalid offset.
+  struct NodeGroups {
+    std::vector<int32_t> grouped_task_offsets = std::vector<int32_t>(NUM_GROUPS, -1);
+    int32_t task_count{0};
+  };
 
-  auto common_node_id = std::optional<NodeID>{};
+  auto groups_per_node = std::unordered_map<NodeID, NodeGroups>{};
 
   /**
    * Tasks are iterated in reverse order as we set tasks as predecessors of already grouped tasks.
-   * Example: assume we have a task list of 6 tasks and NUM_GROUPS is 2.
+   * Example: assume we have a task list of 6 tasks for the same node and NUM_GROUPS is 2.
    * We first process task #5 and check the offset.
-   * As 5 cannot be a predecessor to any task (the stored offset is -1), we just store the offset 5 for the group #1
-   * (5 % 2 = 1). Item #4 is processed similarly. For item #3, we find the group offset 5 and set task #3 as the
-   * predecessor of task #5.
+   * As 5 cannot be a predecessor to any task (the stored offset is -1), we just store the offset 5 for the group #0
+   * (as it is the node's first task). Item #4 is processed similarly for group #1. For item #3, we find the group
+   * offset 5 and set task #3 as the predecessor of task #5.
    * We thus form two groups (or chains of tasks): 0 -> 2 -> 4 and 1 -> 3 -> 5. We skip all tasks that already have
    * predecessors or successors, as adding relationships to these could introduce cyclic dependencies.
    */
@@ -286,24 +320,15 @@ void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<Abstract
       return;
     }
 
-    if constexpr (HYRISE_DEBUG) {
-      if (common_node_id) {
-        // This is not really a hard assertion. As the chain will likely be executed on the same worker (see
-        // Worker::execute_next), we would ignore all but the first node_id. At the time of writing, we did not do any
-        // smart node assignment. This assertion is only here so that this behavior is understood if we ever assign NUMA
-        // node IDs.
-        Assert(task->node_id() == *common_node_id, "Expected all grouped tasks to have the same node_id.");
-      } else {
-        common_node_id = task->node_id();
-      }
-    }
+    auto& node_groups = groups_per_node[task->preferred_node_id()];
+    const auto group_id = node_groups.task_count % NUM_GROUPS;
+    ++node_groups.task_count;
 
-    const auto group_id = task_offset % NUM_GROUPS;
-    const auto previous_task_offset_in_group = grouped_task_offsets[group_id];
+    const auto previous_task_offset_in_group = node_groups.grouped_task_offsets[group_id];
     if (previous_task_offset_in_group > -1) {
       task->set_as_predecessor_of(tasks[previous_task_offset_in_group]);
     }
-    grouped_task_offsets[group_id] = task_offset;
+    node_groups.grouped_task_offsets[group_id] = task_offset;
   }
 }
 
@@ -25,13 +25,20 @@ namespace hyrise {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore idle
- * CPU threads) while there are still tasks in the system that need to be processed. A worker gets idle when its local
- * TaskQueue is empty. In this case, the worker is checking non-local TaskQueues of other NUMA nodes for tasks. The
- * worker pulls a task from a remote TaskQueue and checks if this task is stealable. If not, the task is pushed to the
- * TaskQueue again.
+ * Each worker owns a WorkStealingDeque (a Chase-Lev deque). Tasks that a worker schedules for its own node with the
+ * default priority (e.g., the JobTasks spawned by an operator) and successors of finished tasks are pushed to the
+ * deque of that worker. The worker pops from its deque in LIFO order, so that it continues with the most recently
+ * spawned task while its data is still cached. The node-wide TaskQueue only receives externally submitted tasks (i.e.,
+ * tasks scheduled from non-worker threads or for other nodes), high-priority tasks, non-stealable tasks, and tasks
+ * that did not fit into a full deque. Thus, workers do not contend on the shared queue for the tasks they spawn.
+ *
+ * A worker first executes the task passed to Worker::execute_next(), then pops from its deque, and then pulls from the
+ * TaskQueue of its node. If there is nothing to do, it steals hierarchically: first from the top (i.e., the oldest
+ * tasks, FIFO) of the deques of the other workers on the same node, then from the TaskQueues of other nodes, and
+ * finally from the deques of workers on other nodes. When stealing from a remote TaskQueue, the worker checks if the
+ * task is stealable. If not, the task is pushed to the TaskQueue again.
  * In case no tasks can be processed, the worker thread is put to sleep and waits on the semaphore of its node-local
- * TaskQueue.
+ * TaskQueue. Pushing to a deque wakes up a sleeping worker of the same node, which then tries to steal the task.
  *
  * Note: currently, TaskQueues are not explicitly allocated on a NUMA node. This means most workers will frequently
  * access distant TaskQueues, which is ~1.6 times slower than accessing a local node [1]. 
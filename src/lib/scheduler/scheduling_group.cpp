@@ -0,0 +1,34 @@
+#include "scheduling_group.hpp"
+
+#include <cstdint>
+#include <string>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+SchedulingGroup::SchedulingGroup(const SchedulePriority priority, const uint32_t weight)
+    : _priority{priority}, _weight{DEFAULT_WEIGHT} {
+  set_weight(weight);
+}
+
+SchedulePriority SchedulingGroup::priority() const {
+  return _priority.load();
+}
+
+void SchedulingGroup::set_priority(const SchedulePriority priority) {
+  _priority = priority;
+}
+
+uint32_t SchedulingGroup::weight() const {
+  return _weight.load();
+}
+
+void SchedulingGroup::set_weight(const uint32_t weight) {
+  AssertInput(weight > 0 && weight <= MAX_WEIGHT,
+              "Scheduling weight must be between 1 and " + std::to_string(MAX_WEIGHT) + ".");
+  _weight = weight;
+}
+
+}  // namespace hyrise
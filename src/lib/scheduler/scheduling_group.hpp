@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * A SchedulingGroup describes how the queries of a client (e.g., a server session) or a single query are scheduled.
+ *
+ * The priority is passed on to the tasks of the group's queries. Tasks spawned while executing a high-priority task
+ * (e.g., the JobTasks of an operator) inherit its priority (see AbstractTask::schedule()). High-priority tasks are
+ * preferred by the workers over all tasks of default priority, including the tasks in the workers' own deques. Thus,
+ * short transactional statements are not starved by large analytical queries that flood the workers with tasks.
+ *
+ * The weight determines the group's share of the admission slots if the number of concurrently executed queries is
+ * limited (see AdmissionControl). A group with weight 2 gets twice as many of its waiting queries admitted as a group
+ * with weight 1. Priorities and weights can be changed at any time, e.g., by SET statements in a session.
+ */
+class SchedulingGroup : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_WEIGHT = uint32_t{1};
+  static constexpr auto MAX_WEIGHT = uint32_t{1'000};
+
+  explicit SchedulingGroup(const SchedulePriority priority = SchedulePriority::Default,
+                           const uint32_t weight = DEFAULT_WEIGHT);
+
+  SchedulePriority priority() const;
+  void set_priority(const SchedulePriority priority);
+
+  uint32_t weight() const;
+  void set_weight(const uint32_t weight);
+
+  void operator=(const SchedulingGroup&) = delete;
+  void operator=(SchedulingGroup&&) = delete;
+
+ protected:
+  friend class AdmissionControl;
+
+  // Stride scheduling (Waldspurger and Weihl, 1995): every admitted query advances the group's pass by a stride that
+  // is inversely proportional to the group's weight. The waiting query of the group with the lowest pass is admitted
+  // next. Guarded by the mutex of the AdmissionControl.
+  static constexpr auto STRIDE_NUMERATOR = uint64_t{1} << 20;
+  uint64_t _pass{0};
+
+ private:
+  std::atomic<SchedulePriority> _priority;
+  std::atomic_uint32_t _weight;
+};
+
+}  // namespace hyrise
@@ -1,6 +1,7 @@
 #include "task_queue.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -19,6 +20,10 @@ bool TaskQueue::empty() const {
   });
 }
 
+bool TaskQueue::has_high_priority_tasks() const {
+  return !_queues[static_cast<uint32_t>(SchedulePriority::High)].empty();
+}
+
 NodeID TaskQueue::node_id() const {
   return _node_id;
 }
@@ -45,7 +50,16 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
     }
   }
 
-  // We waited for the semaphore to enter pull() but did not receive a task. Ensure that queues are checked again.
+  // We waited for the semaphore to enter pull() but did not receive a task. If we were woken up to steal from other
+  // workers' deques, the signal did not belong to a task in this queue. Otherwise, ensure that the queues are checked
+  // again.
+  auto pending_wake_up_count = _pending_wake_up_count.load();
+  while (pending_wake_up_count > 0) {
+    if (_pending_wake_up_count.compare_exchange_weak(pending_wake_up_count, pending_wake_up_count - 1)) {
+      return nullptr;
+    }
+  }
+
   semaphore.signal();
   return nullptr;
 }
@@ -85,4 +99,33 @@ void TaskQueue::signal(const int32_t count) {
   semaphore.signal(count);
 }
 
+void TaskQueue::prepare_wait() {
+  ++_sleeping_worker_count;
+  // Order the increment before the worker checks the deques again. Together with the fence in
+  // wake_up_sleeping_worker(), either the worker finds the pushed task or the pushing worker sees the sleeper.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void TaskQueue::cancel_wait() {
+  // A wake-up might already have been issued for this worker. It is consumed by the next worker that pulls from this
+  // queue without finding a task (see pull()).
+  --_sleeping_worker_count;
+}
+
+void TaskQueue::wait() {
+  semaphore.wait();
+  --_sleeping_worker_count;
+}
+
+void TaskQueue::wake_up_sleeping_worker() {
+  // Order the preceding push to a deque before reading the number of sleeping workers (see prepare_wait()).
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_pending_wake_up_count.load() >= _sleeping_worker_count.load()) {
+    return;
+  }
+
+  ++_pending_wake_up_count;
+  semaphore.signal();
+}
+
 }  // namespace hyrise
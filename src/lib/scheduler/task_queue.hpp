@@ -23,7 +23,10 @@ namespace hyrise {
 class AbstractTask;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds a queue of AbstractTasks, usually one of these exists per node. Tasks that are spawned by workers are usually
+ * pushed to the workers' WorkStealingDeques instead (see NodeQueueScheduler). The TaskQueue receives externally
+ * submitted tasks (e.g., the first tasks of a query or ShutdownTasks), tasks with a high priority, and tasks that did
+ * not fit into a full deque.
  */
 class TaskQueue {
  public:
@@ -35,6 +38,12 @@ class TaskQueue {
 
   bool empty() const;
 
+  /**
+   * Returns true if tasks of high priority are waiting. Workers check this before working on the tasks in their own
+   * deques. As for empty(), the result is only an estimate if the queue is modified concurrently.
+   */
+  bool has_high_priority_tasks() const;
+
   NodeID node_id() const;
 
   void push(const std::shared_ptr<AbstractTask>& task, const SchedulePriority priority);
@@ -59,6 +68,28 @@ class TaskQueue {
 
   void signal(const int32_t count);
 
+  /**
+   * Registers the calling worker as sleeping. Afterwards, the worker must check the deques of the workers on this node
+   * once more and then either call wait() or, if it found a task, cancel_wait(). Registering before this last check
+   * ensures that a task pushed to a deque concurrently is either found by the check or wakes up the worker.
+   */
+  void prepare_wait();
+
+  void cancel_wait();
+
+  /**
+   * Puts the calling worker to sleep until a task is pushed to this queue or until wake_up_sleeping_worker() is called.
+   * Must be preceded by prepare_wait().
+   */
+  void wait();
+
+  /**
+   * Wakes up one of the workers sleeping in wait() so that it can steal tasks from the deques of other workers. Does
+   * nothing if no worker sleeps or if enough wake-ups are already pending. The woken worker does not find a task in
+   * this queue. pull() consumes the pending wake-up in that case instead of signaling the semaphore again.
+   */
+  void wake_up_sleeping_worker();
+
   /**
    * Semaphore to signal waiting workers for new tasks.
    * When macOS ships a more recent libc++, this third-party semaphore can be replaced by std::counting_semaphore (see
@@ -69,6 +100,9 @@ class TaskQueue {
  private:
   NodeID _node_id{INVALID_NODE_ID};
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  std::atomic_uint32_t _sleeping_worker_count{0};
+  std::atomic_uint32_t _pending_wake_up_count{0};
 };
 
 }  // namespace hyrise
@@ -0,0 +1,96 @@
+#include "work_stealing_deque.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "abstract_task.hpp"
+
+namespace hyrise {
+
+WorkStealingDeque::WorkStealingDeque() = default;
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // No worker accesses the deque anymore. Release the remaining tasks.
+  const auto bottom = _bottom.load();
+  for (auto index = _top.load(); index < bottom; ++index) {
+    delete _slots[index & MASK].load();  // NOLINT(cppcoreguidelines-owning-memory)
+  }
+}
+
+bool WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  if (bottom - top >= static_cast<int64_t>(CAPACITY)) {
+    return false;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory): ownership is transferred to the popping or stealing thread.
+  _slots[bottom & MASK].store(new std::shared_ptr<AbstractTask>(task), std::memory_order_release);
+  // Publish the slot to thieves: the release store of bottom pairs with the acquire load of bottom in steal(). The
+  // seq_cst fences in pop() and steal() only order the accesses to bottom and top that decide who gets the last task.
+  _bottom.store(bottom + 1, std::memory_order_release);
+  return true;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  _bottom.store(bottom, std::memory_order_relaxed);
+  // Make the reservation of the bottom slot visible before reading top. Otherwise, the owner and a thief could both
+  // take the last task.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty. Restore the bottom index.
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* slot = _slots[bottom & MASK].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // Only one task is left. Race against the thieves for it by advancing top.
+    const auto won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!won) {
+      return nullptr;
+    }
+  }
+
+  const auto owned_slot = std::unique_ptr<std::shared_ptr<AbstractTask>>{slot};
+  return std::move(*owned_slot);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  // The slot cannot be reused by the owner before top is advanced, which would make the following CAS fail. Thus, the
+  // pointer is only dereferenced if it is still valid.
+  auto* slot = _slots[top & MASK].load(std::memory_order_acquire);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  const auto owned_slot = std::unique_ptr<std::shared_ptr<AbstractTask>>{slot};
+  return std::move(*owned_slot);
+}
+
+size_t WorkStealingDeque::estimate_size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return static_cast<size_t>(std::max(bottom - top, int64_t{0}));
+}
+
+bool WorkStealingDeque::empty() const {
+  return estimate_size() == 0;
+}
+
+}  // namespace hyrise
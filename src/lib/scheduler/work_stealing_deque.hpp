@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractTask;
+
+/**
+ * Bounded work-stealing deque of Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005) with the memory
+ * orderings proposed by Lê et al. ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+ *
+ * Every Worker owns one deque. Only the owner pushes and pops tasks at the bottom (LIFO). Thus, the most recently
+ * spawned task, whose data is most likely still cached, is executed first. The owner's operations do not need atomic
+ * read-modify-write instructions unless a single task is left. Other workers steal from the top (FIFO), i.e., they take
+ * the oldest tasks, and compete with each other (and with the owner for the last task) using compare-and-swap.
+ *
+ * The capacity is fixed so that the ring buffer never has to be reallocated while thieves might read from it. If the
+ * deque is full, push() fails and the caller has to fall back to the node's TaskQueue. As std::shared_ptr cannot be
+ * read and written atomically without locks, each slot stores a heap-allocated copy of the task's shared pointer. Only
+ * the worker that successfully popped or stole a slot takes ownership of it.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  static constexpr auto CAPACITY = size_t{1024};
+
+  WorkStealingDeque();
+
+  ~WorkStealingDeque();
+
+  /**
+   * Adds a task at the bottom. Returns false if the deque is full. Must only be called by the owning worker.
+   */
+  bool push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Removes and returns the task at the bottom, i.e., the task that was pushed last. Returns nullptr if the deque is
+   * empty or if a thief took the last task. Must only be called by the owning worker.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes and returns the task at the top, i.e., the oldest task. Can be called by any thread. Returns nullptr if the
+   * deque is empty or if another thread took the task first. In the latter case, the deque might still hold tasks.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Returns the number of tasks in the deque. As the deque is concurrently modified, the size is only an estimate.
+   * Called by the owner, an estimate of CAPACITY is exact, as thieves can only decrease the size.
+   */
+  size_t estimate_size() const;
+
+  bool empty() const;
+
+  void operator=(const WorkStealingDeque&) = delete;
+  void operator=(WorkStealingDeque&&) = delete;
+
+ private:
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of two.");
+  static constexpr auto MASK = static_cast<int64_t>(CAPACITY - 1);
+
+  // Top and bottom are modified by different threads. Keep them on separate cache lines to avoid false sharing.
+  alignas(64) std::atomic_int64_t _top{0};
+  alignas(64) std::atomic_int64_t _bottom{0};
+  alignas(64) std::array<std::atomic<std::shared_ptr<AbstractTask>*>, CAPACITY> _slots{};
+};
+
+}  // namespace hyrise
@@ -74,38 +74,48 @@ void Worker::operator()() {
 }
 
 void Worker::_work(const AllowSleep allow_sleep) {
-  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the queue.
+  // If execute_next has been called, run that task first. Otherwise, try to retrieve a high-priority task from the
+  // node's queue (e.g., of a short transactional statement that should not wait for an analytical query), then the
+  // most recently spawned task from our deque, then any task from the node's queue.
   auto task = std::shared_ptr<AbstractTask>{};
   if (_next_task) {
     task = std::move(_next_task);
     _next_task = nullptr;
   } else {
-    if (_queue->semaphore.tryWait()) {
+    if (_queue->has_high_priority_tasks() && _queue->semaphore.tryWait()) {
       task = _queue->pull();
     }
+
+    if (!task) {
+      task = _deque.pop();
+    }
   }
 
-  if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    for (const auto& queue : Hyrise::get().scheduler()->queues()) {
-      if (!queue || queue == _queue) {
-        continue;
-      }
+  if (!task && _queue->semaphore.tryWait()) {
+    task = _queue->pull();
+  }
 
-      if (queue->semaphore.tryWait()) {
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          break;
-        }
-      }
-    }
+  if (!task) {
+    task = _steal();
   }
 
   // If there is no ready task neither in our queue nor in any other and we are allowed to sleep, wait on the semaphore.
+  // We are woken up when a task is pushed to our node's queue or to the deque of another worker on our node. A task
+  // pushed to a deque after the failed _steal() above but before we registered as sleeping would not wake us up.
+  // Thus, we check the deques of our node again after registering. The wake-up can also race with the other worker
+  // popping the task itself. This is fine as we simply return and check again.
   if (!task && allow_sleep == AllowSleep::Yes) {
-    _queue->semaphore.wait();
-    task = _queue->pull();
+    _queue->prepare_wait();
+    task = _steal_from(_same_node_workers);
+    if (task) {
+      _queue->cancel_wait();
+    } else {
+      _queue->wait();
+      task = _queue->pull();
+      if (!task) {
+        task = _steal();
+      }
+    }
   }
 
   if (!task) {
@@ -146,11 +156,79 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     }
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution.");
     _next_task = task;
-  } else {
+  } else if (!try_push_local(task)) {
     _queue->push(task, SchedulePriority::Default);
   }
 }
 
+bool Worker::try_push_local(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(get_this_thread_worker() && &*get_this_thread_worker() == this,
+              "Only the owning worker may push to its deque.");
+  // Tasks in the deque can be stolen by any worker. Only the owner pushes, so the deque cannot become full between
+  // this check and the push below. We must not mark the task as enqueued before, as TaskQueue::push() would otherwise
+  // drop it.
+  if (!task->is_stealable() || _deque.estimate_size() >= WorkStealingDeque::CAPACITY) {
+    return false;
+  }
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) {
+    return true;
+  }
+
+  task->set_node_id(_queue->node_id());
+  const auto pushed = _deque.push(task);
+  Assert(pushed, "Could not push task to the deque.");
+  _queue->wake_up_sleeping_worker();
+  return true;
+}
+
+void Worker::set_steal_victims(std::vector<Worker*> same_node_workers, std::vector<Worker*> remote_workers) {
+  _same_node_workers = std::move(same_node_workers);
+  _remote_workers = std::move(remote_workers);
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal() {
+  // Workers on the same node share the memory (and possibly the caches) with us.
+  if (auto task = _steal_from(_same_node_workers)) {
+    return task;
+  }
+
+  // Tasks in the queues of other nodes have been submitted externally. In contrast to tasks in deques, they might not
+  // be stealable.
+  for (const auto& queue : Hyrise::get().scheduler()->queues()) {
+    if (!queue || queue == _queue) {
+      continue;
+    }
+
+    if (queue->semaphore.tryWait()) {
+      if (auto task = queue->steal()) {
+        task->set_node_id(_queue->node_id());
+        return task;
+      }
+    }
+  }
+
+  auto task = _steal_from(_remote_workers);
+  if (task) {
+    task->set_node_id(_queue->node_id());
+  }
+  return task;
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_from(const std::vector<Worker*>& workers) {
+  // Start at a different victim each time so that idle workers do not all contend on the deque of the same worker.
+  const auto worker_count = workers.size();
+  ++_next_victim;
+  for (auto offset = size_t{0}; offset < worker_count; ++offset) {
+    if (auto task = workers[(_next_victim + offset) % worker_count]->_deque.steal()) {
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
 void Worker::start() {
   _thread = std::thread(&Worker::operator(), this);
 }
@@ -160,6 +238,10 @@ void Worker::join() {
   _thread.join();
 }
 
+size_t Worker::estimate_load() const {
+  return _deque.estimate_size();
+}
+
 uint64_t Worker::num_finished_tasks() const {
   return _num_finished_tasks;
 }
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -42,10 +43,27 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // Try to execute task immediately after this worker finishes the execution of the current task. The goal is to
   // execute the task while the caches are still fresh instead of having to wait for it to be scheduled again. A task
   // can have multiple successors and all of them could become executable at the same time. In that case, the current
-  // worker can only execute one of them immediately. The others are placed into a high priority queue on the same node
-  // so that they are worked on as soon as possible by either this or another worker.
+  // worker can only execute one of them immediately. The others are pushed to the worker's deque so that they are
+  // worked on as soon as possible by either this or another worker.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
+  /**
+   * Pushes a ready task to the worker's deque. The worker pops the task itself (LIFO) unless another worker steals it
+   * first. Returns false and leaves the task untouched if it is not stealable or if the deque is full. Must be called
+   * from the worker's thread.
+   */
+  bool try_push_local(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Sets the workers whose deques this worker steals from when it runs out of tasks (see _steal()). Called by the
+   * NodeQueueScheduler before the workers are started. The workers are only destroyed after all of them have been
+   * joined, so we store raw pointers to avoid reference cycles.
+   */
+  void set_steal_victims(std::vector<Worker*> same_node_workers, std::vector<Worker*> remote_workers);
+
+  // Returns the number of tasks in the worker's deque. As the deque is concurrently modified, this is only an estimate.
+  size_t estimate_load() const;
+
   // Returns the number of tasks the worker has processed. This method is used as part of the scheduler shutdown. Be
   // cautious when using this method in any other context (see comments in #2526).
   uint64_t num_finished_tasks() const;
@@ -62,6 +80,14 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   void _wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
 
+  /**
+   * Hierarchical work stealing: first try the deques of the workers on the same node, then the TaskQueues of other
+   * nodes, and finally the deques of the workers on other nodes. Returns nullptr if no task could be stolen.
+   */
+  std::shared_ptr<AbstractTask> _steal();
+
+  std::shared_ptr<AbstractTask> _steal_from(const std::vector<Worker*>& workers);
+
  private:
   /**
    * Pin a worker to a particular core.
@@ -70,6 +96,7 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   void _set_affinity();
 
   std::shared_ptr<AbstractTask> _next_task{};
+  WorkStealingDeque _deque;
   std::shared_ptr<TaskQueue> _queue{};
   WorkerID _id{0};
   CpuID _cpu_id{0};
@@ -80,6 +107,10 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   std::vector<uint32_t> _random{};
   size_t _next_random{0};
+
+  std::vector<Worker*> _same_node_workers{};
+  std::vector<Worker*> _remote_workers{};
+  size_t _next_victim{0};
 };
 
 }  // namespace hyrise
@@ -19,9 +19,12 @@ enum class PostgresMessageType : unsigned char {
   ErrorResponse = 'E',
   EmptyQueryResponse = 'I',
   NoDataResponse = 'n',
+  PortalSuspended = 's',
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
 
   // Selection of error and notice message fields. All possible fields are documented at:
   // https://www.postgresql.org/docs/12/protocol-error-fields.html
@@ -39,6 +42,11 @@ enum class PostgresMessageType : unsigned char {
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
 
+  // COPY sub-protocol, sent by both client and server
+  CopyData = 'd',
+  CopyDone = 'c',
+  CopyFail = 'f',
+
   // SSL willingness
   SslYes = 'S',
   SslNo = 'N',
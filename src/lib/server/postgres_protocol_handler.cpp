@@ -229,7 +229,7 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
 }
 
 template <typename SocketType>
-std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
+std::pair<std::string, uint32_t> PostgresProtocolHandler<SocketType>::read_execute_packet() {
   const auto packet_size = _read_buffer.template get_value<uint32_t>();
   auto portal = _read_buffer.get_string(packet_size - 2 * sizeof(uint32_t));
   /* https://www.postgresql.org/docs/12/protocol-flow.html:
@@ -237,8 +237,50 @@ std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
    the command is always executed to completion, and the row count is ignored.
   */
   const auto row_limit = _read_buffer.template get_value<int32_t>();
-  Assert(row_limit == 0, "Row limit of 0 (unlimited) expected.");
-  return portal;
+  AssertInput(row_limit >= 0, "Row limit of Execute message must not be negative.");
+  return {portal, static_cast<uint32_t>(row_limit)};
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_in_response(const uint16_t column_count) {
+  _send_copy_response(PostgresMessageType::CopyInResponse, column_count);
+  // The client waits for this message before it starts sending data.
+  _write_buffer.flush();
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_out_response(const uint16_t column_count) {
+  _send_copy_response(PostgresMessageType::CopyOutResponse, column_count);
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_data_packet() {
+  const auto data_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
+  return _read_buffer.get_string(data_length, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_data(const std::string& data) {
+  _write_buffer.template put_value<PostgresMessageType>(PostgresMessageType::CopyData);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(LENGTH_FIELD_SIZE + data.size()));
+  _write_buffer.put_string(data, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_fail_packet() {
+  const auto message_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
+  return _read_buffer.get_string(message_length);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::read_empty_packet() {
+  _read_buffer.template get_value<uint32_t>();
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::discard_packet() {
+  const auto packet_length = _read_buffer.template get_value<uint32_t>();
+  _read_buffer.get_string(packet_length - LENGTH_FIELD_SIZE, HasNullTerminator::No);
 }
 
 template <typename SocketType>
@@ -286,6 +328,22 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::_send_copy_response(const PostgresMessageType message_type,
+                                                              const uint16_t column_count) {
+  // The documentation of the fields in this message can be found at:
+  // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
+  _write_buffer.template put_value<PostgresMessageType>(message_type);
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(char) + sizeof(uint16_t) + column_count * sizeof(uint16_t);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
+  // Overall format: textual
+  _write_buffer.template put_value<char>(0);
+  _write_buffer.template put_value<uint16_t>(column_count);
+  for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+    _write_buffer.template put_value<uint16_t>(0u);  // Text format
+  }
+}
+
 template class PostgresProtocolHandler<Socket>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
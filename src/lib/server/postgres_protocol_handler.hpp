@@ -63,7 +63,25 @@ class PostgresProtocolHandler {
   // Series of packets for binding and executing prepared statements
   void read_describe_packet();
   PreparedStatementDetails read_bind_packet();
-  std::string read_execute_packet();
+
+  // Returns the portal name and the maximum number of rows to return (0 means no limit).
+  std::pair<std::string, uint32_t> read_execute_packet();
+
+  // Messages of the COPY sub-protocol. All columns are transferred in text format (format code 0), which includes CSV.
+  void send_copy_in_response(const uint16_t column_count);
+  void send_copy_out_response(const uint16_t column_count);
+  std::string read_copy_data_packet();
+  void send_copy_data(const std::string& data);
+
+  // Read the error message a client sends when aborting COPY FROM STDIN.
+  std::string read_copy_fail_packet();
+
+  // Read a packet that only consists of its length field (e.g., CopyDone, Flush), as well as Sync.
+  void read_empty_packet();
+
+  // Read a packet of any type and throw its content away. This is used to skip the messages of the extended query
+  // protocol that follow an error until the next Sync.
+  void discard_packet();
 
   // Send error message to client if there is an error during parsing or execution
   void send_error_message(const ErrorMessages& error_messages);
@@ -71,13 +89,15 @@ class PostgresProtocolHandler {
   // Additional (optional) message containing execution times of different components (such as translator or optimizer)
   void send_execution_info(const std::string& execution_information);
 
-  // This method is required for testing. Otherwise we cannot make the protocol handler flush its data.
+  // Flush all buffered data to the socket. Besides testing, this is used to hand out the rows of a suspended portal
+  // before the client sends the next Sync message.
   void force_flush() {
     _write_buffer.flush();
   }
 
  private:
   void _ssl_deny();
+  void _send_copy_response(const PostgresMessageType message_type, const uint16_t column_count);
   ReadBuffer<SocketType> _read_buffer;
   WriteBuffer<SocketType> _write_buffer;
 };
@@ -1,21 +1,39 @@
 #include "query_handler.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include <boost/algorithm/string.hpp>
+
 #include "sql/SQLStatement.h"
 #include "sql/TransactionStatement.h"
 
 #include "expression/abstract_expression.hpp"
+#include "expression/expression_functional.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
+#include "import_export/csv/csv_meta.hpp"
+#include "import_export/csv/csv_parser.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/static_table_node.hpp"
 #include "operators/abstract_operator.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "optimizer/optimizer.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/admission_control.hpp"
+#include "scheduler/scheduling_group.hpp"
 #include "server/postgres_message_type.hpp"
 #include "server/postgres_protocol_handler.hpp"
 #include "server/server_types.hpp"
@@ -24,13 +42,139 @@
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/prepared_plan.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// Converts rows in PostgreSQL's COPY text format to RFC 4180 CSV, which is understood by the CsvParser. NULL values
+// (\N) become unquoted empty fields. Values that are empty or contain special CSV characters are quoted. All backslash
+// escapes of the text format are decoded, including octal (\ooo) and hexadecimal (\xhh) byte values.
+std::string text_rows_to_csv(const std::string_view rows, const char delimiter) {
+  auto csv = std::string{};
+  csv.reserve(rows.size() + rows.size() / 8);
+
+  auto field = std::string{};
+  const auto append_field = [&](const std::string_view raw_field) {
+    if (raw_field == "\\N") {
+      return;
+    }
+
+    if (field.empty() || field.find_first_of(",\"\n\r") != std::string::npos) {
+      csv.push_back('"');
+      for (const auto character : field) {
+        if (character == '"') {
+          csv.push_back('"');
+        }
+        csv.push_back(character);
+      }
+      csv.push_back('"');
+      return;
+    }
+
+    csv.append(field);
+  };
+
+  const auto rows_size = rows.size();
+  auto line_begin = size_t{0};
+  while (line_begin < rows_size) {
+    auto line_end = rows.find('\n', line_begin);
+    if (line_end == std::string_view::npos) {
+      line_end = rows_size;
+    }
+    const auto line = rows.substr(line_begin, line_end - line_begin);
+    line_begin = line_end + 1;
+
+    // Legacy end-of-data marker.
+    if (line == "\\.") {
+      break;
+    }
+
+    const auto line_size = line.size();
+    auto raw_field_begin = size_t{0};
+    field.clear();
+    for (auto position = size_t{0}; position < line_size; ++position) {
+      auto character = line[position];
+      if (character == delimiter) {
+        append_field(line.substr(raw_field_begin, position - raw_field_begin));
+        csv.push_back(',');
+        field.clear();
+        raw_field_begin = position + 1;
+        continue;
+      }
+
+      if (character == '\\' && position + 1 < line_size) {
+        ++position;
+        character = line[position];
+        switch (character) {
+          case 'b':
+            character = '\b';
+            break;
+          case 'f':
+            character = '\f';
+            break;
+          case 'n':
+            character = '\n';
+            break;
+          case 'r':
+            character = '\r';
+            break;
+          case 't':
+            character = '\t';
+            break;
+          case 'v':
+            character = '\v';
+            break;
+          case 'x': {
+            // \xh or \xhh: the byte with the given hexadecimal value. Without a hex digit, x represents itself.
+            auto digit_count = 0;
+            auto value = 0;
+            while (digit_count < 2 && position + 1 < line_size &&
+                   std::isxdigit(static_cast<unsigned char>(line[position + 1]))) {
+              ++position;
+              const auto digit = static_cast<unsigned char>(line[position]);
+              value = value * 16 + (std::isdigit(digit) ? digit - '0' : std::tolower(digit) - 'a' + 10);
+              ++digit_count;
+            }
+            if (digit_count > 0) {
+              character = static_cast<char>(value);
+            }
+            break;
+          }
+          default:
+            // \o, \oo, or \ooo: the byte with the given octal value.
+            if (character >= '0' && character <= '7') {
+              auto digit_count = 1;
+              auto value = character - '0';
+              while (digit_count < 3 && position + 1 < line_size && line[position + 1] >= '0' &&
+                     line[position + 1] <= '7') {
+                ++position;
+                value = value * 8 + (line[position] - '0');
+                ++digit_count;
+              }
+              character = static_cast<char>(value);
+            }
+            // Any other escaped character (including the delimiter and the backslash) represents itself.
+            break;
+        }
+      }
+      field.push_back(character);
+    }
+    append_field(line.substr(raw_field_begin));
+    csv.push_back('\n');
+  }
+
+  return csv;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandler::execute_pipeline(
     const std::string& query, const SendExecutionInfo send_execution_info,
-    const std::shared_ptr<TransactionContext>& transaction_context) {
+    const std::shared_ptr<TransactionContext>& transaction_context,
+    const std::shared_ptr<SchedulingGroup>& scheduling_group) {
   // A simple query command invalidates unnamed statements
   // See: https://postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
   if (Hyrise::get().storage_manager.has_prepared_plan("")) {
@@ -41,7 +185,10 @@ std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandle
               "Auto-commit transaction contexts should not be passed around this far.");
 
   auto execution_info = ExecutionInformation();
-  auto sql_pipeline = SQLPipelineBuilder{query}.with_transaction_context(transaction_context).create_pipeline();
+  auto sql_pipeline = SQLPipelineBuilder{query}
+                          .with_transaction_context(transaction_context)
+                          .with_scheduling_group(scheduling_group)
+                          .create_pipeline();
 
   const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
 
@@ -118,13 +265,307 @@ std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const Prepare
   return pqp;
 }
 
+bool QueryHandler::is_batchable_prepared_plan(const std::string& statement_name) {
+  if (!Hyrise::get().storage_manager.has_prepared_plan(statement_name)) {
+    return false;
+  }
+
+  // The SQLTranslator creates INSERT INTO ... VALUES statements as Insert <- Projection <- DummyTable.
+  const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_name);
+  const auto& lqp = prepared_plan->lqp;
+  return !prepared_plan->parameter_ids.empty() && lqp->type == LQPNodeType::Insert && lqp->left_input() &&
+         lqp->left_input()->type == LQPNodeType::Projection && lqp->left_input()->left_input() &&
+         lqp->left_input()->left_input()->type == LQPNodeType::DummyTable;
+}
+
+std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan_batch(
+    const std::string& statement_name, const std::vector<std::vector<AllTypeVariant>>& parameter_sets) {
+  Assert(is_batchable_prepared_plan(statement_name), "Prepared statement cannot be executed in batches.");
+  Assert(!parameter_sets.empty(), "Expected at least one parameter set.");
+
+  const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_name);
+  const auto parameter_count = prepared_plan->parameter_ids.size();
+  const auto row_count = parameter_sets.size();
+
+  // Create a table with one column per parameter and one row per parameter set. The data type of each column is taken
+  // from the first non-NULL value. Parameters received by the server are strings and cast by the prepared plan.
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.reserve(parameter_count);
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    auto data_type = DataType::String;
+    for (const auto& parameter_set : parameter_sets) {
+      AssertInput(parameter_set.size() == parameter_count,
+                  "Incorrect number of parameters supplied - expected " + std::to_string(parameter_count) + " got " +
+                      std::to_string(parameter_set.size()));
+      if (!variant_is_null(parameter_set[parameter_idx])) {
+        data_type = data_type_from_all_type_variant(parameter_set[parameter_idx]);
+        break;
+      }
+    }
+    column_definitions.emplace_back("parameter_" + std::to_string(parameter_idx), data_type, true);
+  }
+
+  auto segments = Segments{};
+  segments.reserve(parameter_count);
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    resolve_data_type(column_definitions[parameter_idx].data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_vector<bool>(row_count);
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        const auto& parameter = parameter_sets[row_idx][parameter_idx];
+        if (variant_is_null(parameter)) {
+          null_values[row_idx] = true;
+          continue;
+        }
+        AssertInput(data_type_from_all_type_variant(parameter) == column_definitions[parameter_idx].data_type,
+                    "Parameters of a batch must have the same data type.");
+        values[row_idx] = boost::get<ColumnDataType>(parameter);
+      }
+      segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+    });
+  }
+
+  const auto parameter_table = std::make_shared<Table>(
+      column_definitions, TableType::Data, ChunkOffset{static_cast<ChunkOffset::base_type>(row_count)});
+  parameter_table->append_chunk(segments);
+
+  // Bind the placeholders to the columns of the parameter table and replace the DummyTableNode, which produces a single
+  // row, with the parameter table.
+  const auto static_table_node = StaticTableNode::make(parameter_table);
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  parameter_expressions.reserve(parameter_count);
+  for (auto parameter_idx = ColumnID{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    parameter_expressions.emplace_back(expression_functional::lqp_column_(static_table_node, parameter_idx));
+  }
+
+  auto lqp = prepared_plan->instantiate(parameter_expressions);
+  lqp->left_input()->set_left_input(static_table_node);
+
+  const auto optimizer = Optimizer::create_default_optimizer();
+  lqp = optimizer->optimize(std::move(lqp));
+
+  return LQPTranslator{}.translate_node(lqp);
+}
+
 std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(
-    const std::shared_ptr<AbstractOperator>& physical_plan) {
+    const std::shared_ptr<AbstractOperator>& physical_plan, const std::shared_ptr<SchedulingGroup>& scheduling_group) {
   const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(physical_plan);
+  const auto group = scheduling_group ? scheduling_group : std::make_shared<SchedulingGroup>();
+  for (const auto& task : tasks) {
+    task->set_priority(group->priority());
+  }
+
+  const auto admission_ticket = Hyrise::get().scheduler()->admission_control().admit(*group);
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
   return root_operator_task->get_operator()->get_output();
 }
 
+std::optional<SchedulingSetting> QueryHandler::parse_scheduling_setting(const std::string& query) {
+  // SET [SESSION] query_priority {= | TO} <value> | SET [SESSION] query_weight {= | TO} <value>
+  static const auto set_regex =
+      std::regex{R"(^\s*SET\s+(?:SESSION\s+)?(query_priority|query_weight)\s*(?:=|\s+TO)\s*'?(\w+)'?\s*;?\s*$)",
+                 std::regex::icase | std::regex::optimize};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(query, match, set_regex)) {
+    return std::nullopt;
+  }
+
+  const auto value = boost::algorithm::to_lower_copy(match.str(2));
+  auto setting = SchedulingSetting{};
+  if (boost::algorithm::iequals(match.str(1), "query_priority")) {
+    AssertInput(value == "default" || value == "high", "Query priority must be 'default' or 'high'.");
+    setting.priority = value == "high" ? SchedulePriority::High : SchedulePriority::Default;
+    return setting;
+  }
+
+  const auto is_number = !value.empty() && value.size() <= 9 && std::ranges::all_of(value, [](const auto character) {
+    return std::isdigit(static_cast<unsigned char>(character));
+  });
+  AssertInput(is_number, "Query weight must be a positive integer.");
+  setting.weight = static_cast<uint32_t>(std::stoul(value));
+  AssertInput(*setting.weight > 0 && *setting.weight <= SchedulingGroup::MAX_WEIGHT,
+              "Query weight must be between 1 and " + std::to_string(SchedulingGroup::MAX_WEIGHT) + ".");
+  return setting;
+}
+
+std::optional<IsolationLevel> QueryHandler::parse_begin_isolation_level(const std::string& query) {
+  // The SQL parser only knows BEGIN without transaction modes. Clients such as libpqxx start serializable transactions
+  // with BEGIN ISOLATION LEVEL SERIALIZABLE.
+  static const auto begin_regex = std::regex{
+      R"(^\s*(?:BEGIN(?:\s+TRANSACTION|\s+WORK)?|START\s+TRANSACTION)\s+ISOLATION\s+LEVEL\s+)"
+      R"((SERIALIZABLE|REPEATABLE\s+READ|READ\s+COMMITTED|READ\s+UNCOMMITTED)(?:\s*,?\s*READ\s+WRITE)?\s*;?\s*$)",
+      std::regex::icase | std::regex::optimize};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(query, match, begin_regex)) {
+    return std::nullopt;
+  }
+
+  return boost::algorithm::iequals(match.str(1), "serializable") ? IsolationLevel::Serializable
+                                                                  : IsolationLevel::SnapshotIsolation;
+}
+
+std::optional<CopyStatementDetails> QueryHandler::parse_copy_statement(const std::string& query) {
+  // COPY <table> FROM STDIN [options] | COPY <table> TO STDOUT [options] | COPY (<query>) TO STDOUT [options]
+  static const auto copy_regex =
+      std::regex{R"(^\s*COPY\s+(?:(\w+)|\((.+)\))\s+(FROM\s+STDIN|TO\s+STDOUT)\b(.*?);?\s*$)",
+                 std::regex::icase | std::regex::optimize};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(query, match, copy_regex)) {
+    return std::nullopt;
+  }
+
+  auto copy_statement = CopyStatementDetails{};
+  copy_statement.direction =
+      boost::algorithm::istarts_with(match.str(3), "FROM") ? CopyDirection::FromStdin : CopyDirection::ToStdout;
+  copy_statement.table_name = match.str(1);
+
+  if (copy_statement.direction == CopyDirection::FromStdin) {
+    AssertInput(!copy_statement.table_name.empty(), "COPY FROM STDIN requires a table name.");
+  } else {
+    copy_statement.query =
+        copy_statement.table_name.empty() ? match.str(2) : "SELECT * FROM " + copy_statement.table_name;
+  }
+
+  // Options can be given as "WITH (FORMAT csv, HEADER, DELIMITER ';')" or in the legacy form "WITH CSV HEADER".
+  const auto options_string = match.str(4);
+  auto options = std::vector<std::string>{};
+  auto option = std::string{};
+  auto in_quotes = false;
+  for (const auto character : options_string) {
+    if (character == '\'') {
+      in_quotes = !in_quotes;
+    } else if (!in_quotes && (std::isspace(static_cast<unsigned char>(character)) || character == ',' ||
+                              character == '(' || character == ')')) {
+      if (!option.empty()) {
+        options.emplace_back(std::move(option));
+        option.clear();
+      }
+      continue;
+    }
+    option.push_back(character);
+  }
+  if (!option.empty()) {
+    options.emplace_back(std::move(option));
+  }
+
+  auto delimiter = std::optional<char>{};
+  const auto option_count = options.size();
+  for (auto option_index = size_t{0}; option_index < option_count; ++option_index) {
+    const auto option_name = boost::algorithm::to_lower_copy(options[option_index]);
+    const auto next_option = option_index + 1 < option_count
+                                 ? boost::algorithm::to_lower_copy(options[option_index + 1])
+                                 : std::string{};
+
+    if (option_name == "with") {
+      continue;
+    }
+
+    if (option_name == "csv") {
+      copy_statement.format = CopyFormat::Csv;
+    } else if (option_name == "format") {
+      AssertInput(next_option == "csv" || next_option == "text", "Unsupported COPY format: " + next_option);
+      copy_statement.format = next_option == "csv" ? CopyFormat::Csv : CopyFormat::Text;
+      ++option_index;
+    } else if (option_name == "header") {
+      copy_statement.header = true;
+      if (next_option == "true" || next_option == "on" || next_option == "false" || next_option == "off") {
+        copy_statement.header = next_option == "true" || next_option == "on";
+        ++option_index;
+      }
+    } else if (option_name == "delimiter") {
+      const auto value_index = option_index + (next_option == "as" ? 2 : 1);
+      AssertInput(value_index < option_count, "COPY delimiter option requires a value.");
+      const auto& value = options[value_index];
+      AssertInput(value.size() == 3 && value.front() == '\'' && value.back() == '\'',
+                  "COPY delimiter must be a single character in single quotes.");
+      delimiter = value[1];
+      option_index = value_index;
+    } else {
+      FailInput("Unsupported COPY option: " + option_name);
+    }
+  }
+
+  if (delimiter) {
+    copy_statement.delimiter = *delimiter;
+  } else if (copy_statement.format == CopyFormat::Csv) {
+    copy_statement.delimiter = ',';
+  }
+
+  return copy_statement;
+}
+
+size_t QueryHandler::complete_rows_length(const std::string_view copy_data, const CopyFormat format) {
+  if (format == CopyFormat::Text) {
+    // Line breaks within values are escaped in the text format.
+    const auto last_line_break = copy_data.rfind('\n');
+    return last_line_break == std::string_view::npos ? 0 : last_line_break + 1;
+  }
+
+  // Escaped quotes in CSV are doubled. Thus, they do not affect whether we are within a quoted value.
+  auto length = size_t{0};
+  auto in_quotes = false;
+  const auto data_size = copy_data.size();
+  for (auto position = size_t{0}; position < data_size; ++position) {
+    const auto character = copy_data[position];
+    if (character == '"') {
+      in_quotes = !in_quotes;
+    } else if (character == '\n' && !in_quotes) {
+      length = position + 1;
+    }
+  }
+  return length;
+}
+
+uint64_t QueryHandler::insert_copy_data(const CopyStatementDetails& copy_statement, std::string copy_data,
+                                        const std::shared_ptr<TransactionContext>& transaction_context) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  AssertInput(storage_manager.has_table(copy_statement.table_name),
+              "Table " + copy_statement.table_name + " does not exist.");
+
+  // Similar to the Import operator, the CSV meta information is derived from the existing table.
+  const auto& column_definitions = storage_manager.get_table(copy_statement.table_name)->column_definitions();
+  const auto column_count = column_definitions.size();
+  auto csv_meta = CsvMeta{};
+  csv_meta.columns.resize(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    csv_meta.columns[column_id].name = column_definitions[column_id].name;
+    csv_meta.columns[column_id].type = data_type_to_string.left.at(column_definitions[column_id].data_type);
+    csv_meta.columns[column_id].nullable = column_definitions[column_id].nullable;
+  }
+
+  // NULL values are empty fields. The string "null" is a regular value. Like PostgreSQL, we accept quoted values for
+  // non-string columns (e.g., "42" for an integer column).
+  csv_meta.config.null_handling = NullHandling::NullStringAsValue;
+  csv_meta.config.reject_quoted_nonstrings = false;
+
+  if (copy_statement.format == CopyFormat::Text) {
+    copy_data = text_rows_to_csv(copy_data, copy_statement.delimiter);
+  } else {
+    csv_meta.config.separator = copy_statement.delimiter;
+  }
+
+  // The CsvParser splits the data into chunks and converts them in parallel.
+  const auto values_table = CsvParser::parse_content(std::move(copy_data), csv_meta);
+  const auto row_count = values_table->row_count();
+  if (row_count == 0) {
+    return 0;
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_table);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>(copy_statement.table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+
+  return row_count;
+}
+
 void QueryHandler::_handle_transaction_statement_message(ExecutionInformation& execution_info,
                                                          SQLPipeline& sql_pipeline) {
   // handle custom user feedback (command complete messages) for transaction statements
@@ -1,13 +1,17 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
+#include "scheduler/scheduling_group.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "storage/table.hpp"
 
@@ -24,19 +28,83 @@ struct ExecutionInformation {
   std::optional<std::string> custom_command_complete_message;
 };
 
+enum class CopyDirection { FromStdin, ToStdout };
+
+// Text is PostgreSQL's default COPY format (delimiter-separated, backslash escapes, \N for NULL), Csv follows RFC 4180
+// (unquoted empty fields are NULL).
+enum class CopyFormat { Text, Csv };
+
+// COPY statements that transfer data over the client connection (COPY ... FROM STDIN and COPY ... TO STDOUT). The SQL
+// parser only knows COPY with server-side files, which it translates to IMPORT/EXPORT. Hence, the server recognizes
+// these statements itself.
+struct CopyStatementDetails {
+  CopyDirection direction;
+  std::string table_name;
+  // For COPY ... TO STDOUT, the query whose result is sent to the client ("SELECT * FROM <table_name>" if a table was
+  // given).
+  std::string query;
+  CopyFormat format = CopyFormat::Text;
+  char delimiter = '\t';
+  bool header = false;
+};
+
+// SET statements that change how the queries of a session are scheduled (see SchedulingGroup), i.e.,
+// SET query_priority = {default | high} and SET query_weight = <weight>. The SQL parser does not know SET statements.
+// Hence, the server recognizes them itself.
+struct SchedulingSetting {
+  std::optional<SchedulePriority> priority;
+  std::optional<uint32_t> weight;
+};
+
 // This class manages the interaction between the server and the database component. Furthermore, most of the SQL-based
 // error handling happens in this class.
 class QueryHandler {
  public:
   static std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> execute_pipeline(
       const std::string& query, const SendExecutionInfo send_execution_info,
-      const std::shared_ptr<TransactionContext>& transaction_context);
+      const std::shared_ptr<TransactionContext>& transaction_context,
+      const std::shared_ptr<SchedulingGroup>& scheduling_group = nullptr);
 
   static void setup_prepared_plan(const std::string& statement_name, const std::string& query);
 
   static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details);
 
-  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
+  // Returns true if executions of the prepared statement can be combined by bind_prepared_plan_batch(). This is the
+  // case for INSERT INTO ... VALUES statements with placeholders.
+  static bool is_batchable_prepared_plan(const std::string& statement_name);
+
+  // Binds multiple parameter sets of the same prepared INSERT statement at once. The parameter sets become the rows of
+  // a table that replaces the single-row input of the INSERT. Thus, one Insert operator writes all rows and the
+  // prepared plan is instantiated, optimized, and translated only once per batch.
+  static std::shared_ptr<AbstractOperator> bind_prepared_plan_batch(
+      const std::string& statement_name, const std::vector<std::vector<AllTypeVariant>>& parameter_sets);
+
+  // Executes the plan with the priority of the given SchedulingGroup once it is admitted (see AdmissionControl).
+  static std::shared_ptr<const Table> execute_prepared_plan(
+      const std::shared_ptr<AbstractOperator>& physical_plan,
+      const std::shared_ptr<SchedulingGroup>& scheduling_group = nullptr);
+
+  // Returns the details of a COPY FROM STDIN or COPY TO STDOUT statement, or std::nullopt if the query is not such a
+  // statement (in which case it is passed to the SQLPipeline as usual).
+  static std::optional<CopyStatementDetails> parse_copy_statement(const std::string& query);
+
+  // Returns the setting of a SET query_priority or SET query_weight statement, or std::nullopt if the query is not
+  // such a statement.
+  static std::optional<SchedulingSetting> parse_scheduling_setting(const std::string& query);
+
+  // Returns the isolation level of a BEGIN [TRANSACTION | WORK] ISOLATION LEVEL <level> or START TRANSACTION
+  // ISOLATION LEVEL <level> statement, or std::nullopt if the query is not such a statement. As snapshot isolation
+  // prevents all anomalies that PostgreSQL's weaker levels allow, only SERIALIZABLE yields a different level.
+  static std::optional<IsolationLevel> parse_begin_isolation_level(const std::string& query);
+
+  // Returns the length of the prefix of `copy_data` that consists of complete rows only. Row delimiters within quoted
+  // CSV values are skipped.
+  static size_t complete_rows_length(std::string_view copy_data, const CopyFormat format);
+
+  // Parses complete rows received via COPY FROM STDIN into chunks using the CsvParser and inserts them into the target
+  // table within the given transaction. Returns the number of inserted rows.
+  static uint64_t insert_copy_data(const CopyStatementDetails& copy_statement, std::string copy_data,
+                                   const std::shared_ptr<TransactionContext>& transaction_context);
 
  private:
   static void _handle_transaction_statement_message(ExecutionInformation& execution_info, SQLPipeline& sql_pipeline);
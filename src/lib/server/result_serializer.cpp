@@ -1,5 +1,6 @@
 #include "result_serializer.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -11,11 +12,76 @@
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "query_handler.hpp"
+#include "ring_buffer_iterator.hpp"
 #include "storage/chunk.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Target size of the CopyData messages sent for COPY TO STDOUT.
+constexpr auto COPY_DATA_MESSAGE_SIZE = size_t{SERVER_BUFFER_SIZE};
+
+// Appends a value to a row of COPY TO STDOUT output, escaping it according to the requested format.
+void append_copy_value(std::string& row, const std::optional<pmr_string>& value,
+                       const CopyStatementDetails& copy_statement) {
+  if (copy_statement.format == CopyFormat::Text) {
+    if (!value) {
+      row.append("\\N");
+      return;
+    }
+
+    for (const auto character : *value) {
+      switch (character) {
+        case '\\':
+          row.append("\\\\");
+          break;
+        case '\n':
+          row.append("\\n");
+          break;
+        case '\r':
+          row.append("\\r");
+          break;
+        case '\t':
+          row.append("\\t");
+          break;
+        default:
+          if (character == copy_statement.delimiter) {
+            row.push_back('\\');
+          }
+          row.push_back(character);
+      }
+    }
+    return;
+  }
+
+  // CSV: NULL is an unquoted empty field, an empty string is a quoted empty field.
+  if (!value) {
+    return;
+  }
+
+  const auto needs_quotes = value->empty() || value->find_first_of("\"\n\r") != pmr_string::npos ||
+                            value->find(copy_statement.delimiter) != pmr_string::npos;
+  if (!needs_quotes) {
+    row.append(value->data(), value->size());
+    return;
+  }
+
+  row.push_back('"');
+  for (const auto character : *value) {
+    if (character == '"') {
+      row.push_back('"');
+    }
+    row.push_back(character);
+  }
+  row.push_back('"');
+}
+
+}  // namespace
+
 namespace hyrise {
 
 template <typename SocketType>
@@ -71,38 +137,129 @@ template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
     const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+  auto position = ResultPosition{};
+  send_query_response(table, postgres_protocol_handler, position);
+}
+
+template <typename SocketType>
+uint64_t ResultSerializer::send_query_response(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler, ResultPosition& position,
+    const uint64_t row_limit) {
+  const auto column_count = table->column_count();
+  auto values_as_strings = std::vector<std::optional<std::string>>(column_count);
+  auto segments = Segments(column_count);
+  auto sent_row_count = uint64_t{0};
 
   const auto chunk_count = table->chunk_count();
 
-  // Iterate over each chunk in result table
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
-    const auto chunk = table->get_chunk(chunk_id);
+  // Iterate over the remaining chunks in the result table. The result table is fully materialized by the time we get
+  // here, so this only resumes sending at `position`; it does not overlap sending with query execution.
+  while (position.chunk_id < chunk_count) {
+    const auto chunk = table->get_chunk(position.chunk_id);
     const auto chunk_size = chunk->size();
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
-    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
       segments[column_id] = chunk->get_segment(column_id);
     }
 
-    // Iterate over each row in chunk
-    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    // Iterate over each remaining row in chunk
+    for (; position.chunk_offset < chunk_size; ++position.chunk_offset) {
+      if (row_limit != 0 && sent_row_count == row_limit) {
+        return sent_row_count;
+      }
+
       auto string_length_sum = uint32_t{0};
       // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto attribute_value = (*segments[column_id])[position.chunk_offset];
         // The PostgreSQL protocol requires the conversion of values to strings
         const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
         if (string_value) {
           // Sum up string lengths for a row to save an extra loop during serialization
           string_length_sum += static_cast<uint32_t>(string_value->size());
         }
-        values_as_strings[segment_id] = string_value;
+        values_as_strings[column_id] = string_value;
       }
       postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+      ++sent_row_count;
+    }
+
+    ++position.chunk_id;
+    position.chunk_offset = ChunkOffset{0};
+  }
+
+  return sent_row_count;
+}
+
+template <typename SocketType>
+void ResultSerializer::send_copy_data(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const CopyStatementDetails& copy_statement) {
+  const auto column_count = table->column_count();
+
+  // Rows are collected into CopyData messages of about the size of the write buffer. Clients must not assume that
+  // message boundaries correspond to rows, and sending a message per row would add five bytes of header to every row.
+  auto data = std::string{};
+  data.reserve(COPY_DATA_MESSAGE_SIZE * 2);
+  const auto send_if_full = [&]() {
+    if (data.size() >= COPY_DATA_MESSAGE_SIZE) {
+      postgres_protocol_handler->send_copy_data(data);
+      data.clear();
     }
+  };
+
+  if (copy_statement.header) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (column_id > 0) {
+        data.push_back(copy_statement.delimiter);
+      }
+      append_copy_value(data, pmr_string{table->column_name(column_id)}, copy_statement);
+    }
+    data.push_back('\n');
   }
+
+  const auto chunk_count = table->chunk_count();
+  auto segments = Segments(column_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments[column_id] = chunk->get_segment(column_id);
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        if (column_id > 0) {
+          data.push_back(copy_statement.delimiter);
+        }
+        append_copy_value(data, lossy_variant_cast<pmr_string>((*segments[column_id])[chunk_offset]), copy_statement);
+      }
+      data.push_back('\n');
+      send_if_full();
+    }
+  }
+
+  if (!data.empty()) {
+    postgres_protocol_handler->send_copy_data(data);
+  }
+}
+
+bool ResultSerializer::is_completely_sent(const std::shared_ptr<const Table>& table, const ResultPosition& position) {
+  const auto chunk_count = table->chunk_count();
+  auto chunk_id = position.chunk_id;
+  auto chunk_offset = position.chunk_offset;
+
+  // Skip over exhausted or empty chunks. A position at the end of a chunk is equivalent to the beginning of the next.
+  while (chunk_id < chunk_count) {
+    if (chunk_offset < table->get_chunk(chunk_id)->size()) {
+      return false;
+    }
+    ++chunk_id;
+    chunk_offset = ChunkOffset{0};
+  }
+  return true;
 }
 
 std::string ResultSerializer::build_command_complete_message(const ExecutionInformation& execution_information,
@@ -151,4 +308,22 @@ template void ResultSerializer::send_query_response<boost::asio::posix::stream_d
     const std::shared_ptr<const Table>&,
     const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
 
+template void ResultSerializer::send_copy_data<Socket>(const std::shared_ptr<const Table>&,
+                                                       const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                       const CopyStatementDetails&);
+
+template void ResultSerializer::send_copy_data<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const CopyStatementDetails&);
+
+template uint64_t ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
+                                                                const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                                ResultPosition&, const uint64_t);
+
+template uint64_t ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&, ResultPosition&,
+    const uint64_t);
+
 }  // namespace hyrise
@@ -9,8 +9,17 @@
 
 namespace hyrise {
 
+struct CopyStatementDetails;
 struct ExecutionInformation;
 
+// Position of the next row of a result table that has not been sent to the client yet. Portals keep this position
+// when an Execute message limits the number of returned rows so that a following Execute continues where the previous
+// one stopped (portal suspension).
+struct ResultPosition {
+  ChunkID chunk_id{0};
+  ChunkOffset chunk_offset{0};
+};
+
 // The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
 class ResultSerializer {
  public:
@@ -20,12 +29,30 @@ class ResultSerializer {
       const std::shared_ptr<const Table>& table,
       const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
 
-  template <typename SocketType>
   // Cast attributes of the result table and send them row-wise
+  template <typename SocketType>
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
       const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
 
+  // Send the rows of the result table starting at `position`, chunk by chunk. At most `row_limit` rows are sent (0
+  // means no limit). `position` is advanced to the first row that has not been sent. Returns the number of rows sent.
+  template <typename SocketType>
+  static uint64_t send_query_response(
+      const std::shared_ptr<const Table>& table,
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler, ResultPosition& position,
+      const uint64_t row_limit = 0);
+
+  // Send the rows of the result table as CopyData messages in the format requested by the COPY TO STDOUT statement.
+  // Consecutive rows are combined into messages of about the size of the write buffer.
+  template <typename SocketType>
+  static void send_copy_data(const std::shared_ptr<const Table>& table,
+                             const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+                             const CopyStatementDetails& copy_statement);
+
+  // Returns true if all rows of the result table have been sent.
+  static bool is_completely_sent(const std::shared_ptr<const Table>& table, const ResultPosition& position);
+
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const ExecutionInformation& execution_information,
                                                     const uint64_t row_count);
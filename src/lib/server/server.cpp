@@ -21,8 +21,10 @@ namespace hyrise {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_context, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const size_t max_concurrent_queries)
+    : _acceptor(_io_context, boost::asio::ip::tcp::endpoint(address, port)),
+      _send_execution_info(send_execution_info),
+      _max_concurrent_queries(max_concurrent_queries) {
   std::cout << "Server started at " << server_address() << " and port " << server_port() << ".\nRun 'psql -h localhost "
             << server_address() << "' to connect to the server\n." << std::flush;
 }
@@ -32,6 +34,7 @@ void Server::run() {
 
   // Set scheduler so that the server can execute the tasks on separate threads.
   Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  Hyrise::get().scheduler()->admission_control().set_max_concurrent_queries(_max_concurrent_queries);
 
   // Set caches
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include "scheduler/admission_control.hpp"
 #include "server_types.hpp"
 #include "session.hpp"
 
@@ -31,7 +33,9 @@ namespace hyrise {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  // If max_concurrent_queries is set, queries of default priority wait until they are admitted (see AdmissionControl).
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const size_t max_concurrent_queries = AdmissionControl::UNLIMITED);
 
   // Start server to accept new sessions.
   void run();
@@ -57,6 +61,7 @@ class Server {
   boost::asio::io_context _io_context;
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
+  const size_t _max_concurrent_queries;
   std::atomic_bool _is_initialized{false};
 };
 }  // namespace hyrise
@@ -6,8 +6,10 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include "client_disconnect_exception.hpp"
+#include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 #include "postgres_message_type.hpp"
 #include "postgres_protocol_handler.hpp"
@@ -16,6 +18,7 @@
 #include "server_types.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/invalid_input_exception.hpp"
 
 namespace hyrise {
 
@@ -39,17 +42,8 @@ void Session::run() {
       _handle_request();
     } catch (const ClientDisconnectException& /* exception */) {
       return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":\n"
-                << e.what() << '\n';
-      const auto error_messages = ErrorMessages{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_messages);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
+    } catch (const std::exception& exception) {
+      _handle_error(exception, _extended_query_message);
     }
   }
 }
@@ -69,6 +63,28 @@ void Session::_establish_connection() {
 
 void Session::_handle_request() {
   const auto header = _postgres_protocol_handler->read_packet_type();
+  _extended_query_message = header != PostgresMessageType::SimpleQueryCommand;
+
+  // Batched executions must be finished before any other message is processed so that responses keep their order and
+  // following statements see the inserted rows.
+  if (header != PostgresMessageType::BindCommand && header != PostgresMessageType::ExecuteCommand &&
+      header != PostgresMessageType::DescribeCommand) {
+    try {
+      _execute_pending_batch();
+    } catch (const ClientDisconnectException& /* exception */) {
+      throw;
+    } catch (const std::exception& exception) {
+      // The batch belongs to the preceding messages of the extended query protocol. Hence, the current message is
+      // skipped below unless it is the Sync that ends the failed messages.
+      _handle_error(exception, true);
+    }
+  }
+
+  if (_skip_until_sync && header != PostgresMessageType::SyncCommand &&
+      header != PostgresMessageType::TerminateCommand) {
+    _postgres_protocol_handler->discard_packet();
+    return;
+  }
 
   switch (header) {
     case PostgresMessageType::TerminateCommand: {
@@ -76,25 +92,19 @@ void Session::_handle_request() {
       break;
     }
     case PostgresMessageType::SimpleQueryCommand: {
-      _sync_send_after_error = false;
       _handle_simple_query();
       break;
     }
     case PostgresMessageType::ParseCommand: {
-      _sync_send_after_error = false;
       _handle_parse_command();
       break;
     }
     case PostgresMessageType::SyncCommand: {
-      if (!_sync_send_after_error) {
-        _sync();
-      } else {
-        _postgres_protocol_handler->read_sync_packet();
-      }
+      _skip_until_sync = false;
+      _sync();
       break;
     }
     case PostgresMessageType::BindCommand: {
-      _sync_send_after_error = false;
       _handle_bind_command();
       break;
     }
@@ -113,16 +123,63 @@ void Session::_handle_request() {
   }
 }
 
+void Session::_handle_error(const std::exception& exception, const bool extended_query_message) {
+  std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":\n"
+            << exception.what() << '\n';
+  const auto error_messages = ErrorMessages{{PostgresMessageType::HumanReadableError, exception.what()}};
+  _postgres_protocol_handler->send_error_message(error_messages);
+
+  // A failed simple query is finished by the error message, followed by a "ReadyForQuery" message.
+  if (!extended_query_message) {
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
+  }
+
+  // Clients of the extended query protocol may send many messages before they wait for the response to the next Sync
+  // (see https://www.postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY). Just as PostgreSQL, we
+  // discard all messages up to this Sync and answer it with a "ReadyForQuery" message. The changes of the messages
+  // since the last Sync are rolled back. Inside an explicit transaction, the session's transaction is rolled back and
+  // discarded, just as SQLPipeline does when a statement fails inside BEGIN.
+  if (_transaction_context && _transaction_context->phase() == TransactionPhase::Active) {
+    _transaction_context->rollback(RollbackReason::User);
+  }
+  _transaction_context = nullptr;
+  _batched_executions.clear();
+  _skip_until_sync = true;
+}
+
 void Session::_handle_simple_query() {
   const auto& query = _postgres_protocol_handler->read_query_packet();
 
   // A simple query command invalidates unnamed portals
   _portals.erase("");
 
+  if (const auto copy_statement = QueryHandler::parse_copy_statement(query)) {
+    if (copy_statement->direction == CopyDirection::FromStdin) {
+      _handle_copy_from_stdin(*copy_statement);
+    } else {
+      _handle_copy_to_stdout(*copy_statement);
+    }
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
+  }
+
+  if (const auto isolation_level = QueryHandler::parse_begin_isolation_level(query)) {
+    _handle_begin_with_isolation_level(*isolation_level);
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
+  }
+
+  if (const auto scheduling_setting = QueryHandler::parse_scheduling_setting(query)) {
+    _handle_scheduling_setting(*scheduling_setting);
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
+  }
+
   ExecutionInformation execution_information;
 
   std::tie(execution_information, _transaction_context) =
-      QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context);
+      QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context, _scheduling_group);
 
   if (!execution_information.error_messages.empty()) {
     _postgres_protocol_handler->send_error_message(execution_information.error_messages);
@@ -145,6 +202,157 @@ void Session::_handle_simple_query() {
   _postgres_protocol_handler->send_ready_for_query();
 }
 
+void Session::_handle_begin_with_isolation_level(const IsolationLevel isolation_level) {
+  AssertInput(!_transaction_context, "Cannot begin transaction inside an active transaction.");
+  _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No, isolation_level);
+  _postgres_protocol_handler->send_command_complete("BEGIN");
+}
+
+void Session::_handle_scheduling_setting(const SchedulingSetting& scheduling_setting) {
+  if (scheduling_setting.priority) {
+    _scheduling_group->set_priority(*scheduling_setting.priority);
+  }
+
+  if (scheduling_setting.weight) {
+    _scheduling_group->set_weight(*scheduling_setting.weight);
+  }
+
+  _postgres_protocol_handler->send_command_complete("SET");
+}
+
+void Session::_handle_copy_from_stdin(const CopyStatementDetails& copy_statement) {
+  AssertInput(Hyrise::get().storage_manager.has_table(copy_statement.table_name),
+              "Table " + copy_statement.table_name + " does not exist.");
+
+  // Received data is parsed and inserted in batches so that the server does not have to buffer the complete input.
+  // Each batch is converted to chunks by the CsvParser in parallel.
+  constexpr auto COPY_BATCH_SIZE = size_t{64} * 1024 * 1024;
+
+  // Without an explicit transaction, COPY is executed as a single transaction that is committed once all data has been
+  // received.
+  const auto transaction_context = _transaction_context
+                                       ? _transaction_context
+                                       : Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto column_count = Hyrise::get().storage_manager.get_table(copy_statement.table_name)->column_count();
+  _postgres_protocol_handler->send_copy_in_response(static_cast<uint16_t>(column_count));
+
+  auto copy_data = std::string{};
+  auto skip_header = copy_statement.header;
+  auto row_count = uint64_t{0};
+  auto error = std::exception_ptr{};
+
+  const auto insert_complete_rows = [&](const bool is_last_batch) {
+    if (skip_header) {
+      const auto header_end = copy_data.find('\n');
+      if (header_end == std::string::npos && !is_last_batch) {
+        return;
+      }
+      copy_data.erase(0, header_end == std::string::npos ? copy_data.size() : header_end + 1);
+      skip_header = false;
+    }
+
+    const auto batch_length =
+        is_last_batch ? copy_data.size() : QueryHandler::complete_rows_length(copy_data, copy_statement.format);
+    if (batch_length == 0) {
+      return;
+    }
+
+    auto batch = copy_data.substr(0, batch_length);
+    copy_data.erase(0, batch_length);
+    row_count += QueryHandler::insert_copy_data(copy_statement, std::move(batch), transaction_context);
+  };
+
+  // Once an error occurred, the remaining messages of the COPY sub-protocol are consumed and discarded so that the
+  // session can continue with the next query.
+  auto copy_done = false;
+  while (!copy_done) {
+    switch (_postgres_protocol_handler->read_packet_type()) {
+      case PostgresMessageType::CopyData: {
+        auto data = _postgres_protocol_handler->read_copy_data_packet();
+        if (error) {
+          break;
+        }
+        copy_data.append(data);
+        if (copy_data.size() >= COPY_BATCH_SIZE) {
+          try {
+            insert_complete_rows(false);
+          } catch (const std::exception& /* exception */) {
+            error = std::current_exception();
+          }
+        }
+        break;
+      }
+      case PostgresMessageType::CopyDone: {
+        _postgres_protocol_handler->read_empty_packet();
+        copy_done = true;
+        break;
+      }
+      case PostgresMessageType::CopyFail: {
+        const auto message = _postgres_protocol_handler->read_copy_fail_packet();
+        if (!error) {
+          error = std::make_exception_ptr(InvalidInputException("COPY FROM STDIN failed: " + message));
+        }
+        copy_done = true;
+        break;
+      }
+      case PostgresMessageType::FlushCommand:
+      case PostgresMessageType::SyncCommand: {
+        // Flush and Sync messages are ignored during COPY FROM STDIN.
+        _postgres_protocol_handler->read_empty_packet();
+        break;
+      }
+      default:
+        Fail("Unexpected message during COPY FROM STDIN.");
+    }
+  }
+
+  if (!error) {
+    try {
+      insert_complete_rows(true);
+    } catch (const std::exception& /* exception */) {
+      error = std::current_exception();
+    }
+  }
+
+  if (error) {
+    // Batches that have already been inserted must not become visible. Inside an explicit transaction, the session's
+    // transaction is rolled back and discarded, just as SQLPipeline does when a statement fails inside BEGIN.
+    // Otherwise, the client could commit a partial COPY.
+    if (transaction_context->phase() == TransactionPhase::Active) {
+      transaction_context->rollback(RollbackReason::User);
+    }
+    _transaction_context = nullptr;
+    std::rethrow_exception(error);
+  }
+
+  if (transaction_context != _transaction_context) {
+    transaction_context->commit();
+  }
+
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(row_count));
+}
+
+void Session::_handle_copy_to_stdout(const CopyStatementDetails& copy_statement) {
+  ExecutionInformation execution_information;
+  std::tie(execution_information, _transaction_context) =
+      QueryHandler::execute_pipeline(copy_statement.query, SendExecutionInfo::No, _transaction_context,
+                                     _scheduling_group);
+
+  if (!execution_information.error_messages.empty()) {
+    _postgres_protocol_handler->send_error_message(execution_information.error_messages);
+    return;
+  }
+
+  const auto& result_table = execution_information.result_table;
+  AssertInput(result_table, "COPY TO STDOUT requires a query that returns rows.");
+
+  _postgres_protocol_handler->send_copy_out_response(static_cast<uint16_t>(result_table->column_count()));
+  ResultSerializer::send_copy_data(result_table, _postgres_protocol_handler, copy_statement);
+  _postgres_protocol_handler->send_status_message(PostgresMessageType::CopyDone);
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(result_table->row_count()));
+}
+
 void Session::_handle_parse_command() {
   const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
   QueryHandler::setup_prepared_plan(statement_name, query);
@@ -157,6 +365,20 @@ void Session::_handle_parse_command() {
 void Session::_handle_bind_command() {
   const auto parameters = _postgres_protocol_handler->read_bind_packet();
 
+  if (parameters.portal.empty() && QueryHandler::is_batchable_prepared_plan(parameters.statement_name)) {
+    if (parameters.statement_name != _batch_statement_name) {
+      _execute_pending_batch();
+      _batch_statement_name = parameters.statement_name;
+    }
+
+    // The Bind message redefines the unnamed portal.
+    _portals.erase("");
+    _batched_executions.emplace_back(BatchedExecution{parameters.parameters});
+    return;
+  }
+
+  _execute_pending_batch();
+
   // Named portals must be explicitly closed before they can be redefined by another Bind message,
   // but this is not required for the unnamed portal.
   // https://www.postgresql.org/docs/12/static/protocol-flow.html
@@ -166,19 +388,58 @@ void Session::_handle_bind_command() {
     _portals.erase(portal_it);
   }
 
-  // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
-  // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
-  // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
-
+  // If binding fails, no portal is created. The following Execute message is skipped until the next Sync.
   const auto pqp = QueryHandler::bind_prepared_plan(parameters);
 
-  _portals[parameters.portal] = pqp;
+  _portals[parameters.portal].physical_plan = pqp;
   _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
 
   // Ready for query + flush will be done after reading sync message
 }
 
+void Session::_execute_pending_batch() {
+  if (_batched_executions.empty()) {
+    return;
+  }
+
+  auto batched_executions = std::vector<BatchedExecution>{};
+  batched_executions.swap(_batched_executions);
+
+  auto parameter_sets = std::vector<std::vector<AllTypeVariant>>{};
+  parameter_sets.reserve(batched_executions.size());
+  for (auto& batched_execution : batched_executions) {
+    if (batched_execution.executed) {
+      parameter_sets.emplace_back(std::move(batched_execution.parameters));
+    }
+  }
+
+  if (!parameter_sets.empty()) {
+    const auto physical_plan = QueryHandler::bind_prepared_plan_batch(_batch_statement_name, parameter_sets);
+
+    if (!_transaction_context) {
+      _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    }
+    physical_plan->set_transaction_context_recursively(_transaction_context);
+    QueryHandler::execute_prepared_plan(physical_plan, _scheduling_group);
+  }
+
+  for (const auto& batched_execution : batched_executions) {
+    _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
+    if (batched_execution.executed) {
+      _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+      _postgres_protocol_handler->send_command_complete(
+          ResultSerializer::build_command_complete_message(OperatorType::Insert, 1));
+    }
+  }
+
+  // A trailing Bind message without Execute defines a regular unnamed portal, which a later Execute can refer to.
+  if (!batched_executions.back().executed) {
+    const auto statement_details =
+        PreparedStatementDetails{_batch_statement_name, "", std::move(batched_executions.back().parameters)};
+    _portals[""].physical_plan = QueryHandler::bind_prepared_plan(statement_details);
+  }
+}
+
 void Session::_sync() {
   _postgres_protocol_handler->read_sync_packet();
   if (_transaction_context) {
@@ -189,43 +450,62 @@ void Session::_sync() {
 }
 
 void Session::_handle_execute() {
-  const std::string& portal_name = _postgres_protocol_handler->read_execute_packet();
+  const auto [portal_name, row_limit] = _postgres_protocol_handler->read_execute_packet();
+
+  // Execute messages for the unnamed portal of a batchable statement only mark the collected parameters as executed.
+  if (portal_name.empty() && !_batched_executions.empty() && !_batched_executions.back().executed) {
+    _batched_executions.back().executed = true;
+    return;
+  }
+
+  _execute_pending_batch();
 
   auto portal_it = _portals.find(portal_name);
   AssertInput(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
-  // nothing to execute.
-  if (!portal_it->second) {
-    _portals.erase(portal_it);
-    return;
-  }
+  auto& portal = portal_it->second;
+  const auto& physical_plan = portal.physical_plan;
 
-  const auto physical_plan = portal_it->second;
+  // A suspended portal has already been executed and described. We only continue sending its result rows.
+  if (!portal.executed) {
+    if (!_transaction_context) {
+      _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    }
+    physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  if (portal_name.empty()) {
-    _portals.erase(portal_it);
-  }
+    portal.result_table = QueryHandler::execute_prepared_plan(physical_plan, _scheduling_group);
+    portal.executed = true;
 
-  if (!_transaction_context) {
-    _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    // If there is no result table, e.g. after an INSERT command, we cannot send row data
+    if (portal.result_table) {
+      ResultSerializer::send_table_description(portal.result_table, _postgres_protocol_handler);
+    } else {
+      _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+    }
   }
-  physical_plan->set_transaction_context_recursively(_transaction_context);
-
-  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan);
 
-  uint64_t row_count = 0;
-  // If there is no result table, e.g. after an INSERT command, we cannot send row data
-  if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
-    row_count = result_table->row_count();
-  } else {
-    _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+  auto row_count = uint64_t{0};
+  if (portal.result_table) {
+    row_count = ResultSerializer::send_query_response(portal.result_table, _postgres_protocol_handler,
+                                                      portal.position, row_limit);
+
+    if (!ResultSerializer::is_completely_sent(portal.result_table, portal.position)) {
+      // The client requested fewer rows than the result contains. Keep the portal (including the unnamed one) so that
+      // the next Execute message continues at the current position. Flush so that the client receives the rows sent so
+      // far without waiting for the next Sync.
+      _postgres_protocol_handler->send_status_message(PostgresMessageType::PortalSuspended);
+      _postgres_protocol_handler->force_flush();
+      return;
+    }
   }
 
   _postgres_protocol_handler->send_command_complete(
       ResultSerializer::build_command_complete_message(physical_plan->type(), row_count));
+
+  // The unnamed portal is only valid for a single (possibly suspended) execution.
+  if (portal_name.empty()) {
+    _portals.erase(portal_it);
+  }
   // Ready for query + flush will be done after reading sync message
 }
 }  // namespace hyrise
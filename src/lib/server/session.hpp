@@ -1,13 +1,18 @@
 #pragma once
 
+#include <exception>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
+#include "query_handler.hpp"
+#include "result_serializer.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/scheduling_group.hpp"
 
 namespace hyrise {
 
@@ -18,6 +23,15 @@ namespace hyrise {
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
 class Session {
  public:
+  // A portal holds a bound PQP. Once executed, it keeps the result table and the position of the next row to send so
+  // that Execute messages with a row limit can fetch the result in batches.
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::shared_ptr<const Table> result_table;
+    ResultPosition position;
+    bool executed = false;
+  };
+
   explicit Session(boost::asio::io_context& io_context, const SendExecutionInfo send_execution_info);
 
   // Start new session.
@@ -35,6 +49,18 @@ class Session {
   // Execute plain SQL statement.
   void _handle_simple_query();
 
+  // Start a transaction with the given isolation level.
+  void _handle_begin_with_isolation_level(const IsolationLevel isolation_level);
+
+  // Change the priority or weight of the session's queries.
+  void _handle_scheduling_setting(const SchedulingSetting& scheduling_setting);
+
+  // Receive rows via the COPY sub-protocol and insert them into the target table.
+  void _handle_copy_from_stdin(const CopyStatementDetails& copy_statement);
+
+  // Send the result of a table or query via the COPY sub-protocol.
+  void _handle_copy_to_stdout(const CopyStatementDetails& copy_statement);
+
   // Parse prepared statement.
   void _handle_parse_command();
 
@@ -44,18 +70,44 @@ class Session {
   // Read describe message. Row description will be send after execution.
   void _handle_describe();
 
-  // Execute prepared statement and send row description.
+  // Execute prepared statement (if not done by a previous Execute message for the same portal), send row description
+  // and send up to the requested number of rows. If rows remain, the portal is suspended.
   void _handle_execute();
 
+  // Execute the collected Bind/Execute pairs of a batchable prepared statement and send their responses.
+  void _execute_pending_batch();
+
   // Commit current transaction.
   void _sync();
 
+  // Send an error message to the client. For the extended query protocol, roll back the current transaction and skip
+  // the following messages until the next Sync.
+  void _handle_error(const std::exception& exception, const bool extended_query_message);
+
   const std::shared_ptr<Socket> _socket;
   const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
   bool _terminate_session = false;
-  bool _sync_send_after_error = false;
+  // Whether the message that is currently handled belongs to the extended query protocol (i.e., it is not a simple
+  // query). After an error in the extended query protocol, all messages until the next Sync are skipped.
+  bool _extended_query_message = false;
+  bool _skip_until_sync = false;
   std::shared_ptr<TransactionContext> _transaction_context;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
+
+  // All queries of a session form one SchedulingGroup. Its priority and weight can be changed with SET statements.
+  const std::shared_ptr<SchedulingGroup> _scheduling_group = std::make_shared<SchedulingGroup>();
+
+  // Clients often send many Bind/Execute pairs for the same prepared INSERT statement before the next Sync. If the
+  // statement can be batched (see QueryHandler::is_batchable_prepared_plan), such pairs for the unnamed portal are not
+  // executed one by one. Instead, their parameters are collected until any other message arrives. Then, all rows are
+  // inserted by a single operator, and the responses are sent in the original order.
+  struct BatchedExecution {
+    std::vector<AllTypeVariant> parameters;
+    bool executed = false;
+  };
+
+  std::string _batch_statement_name;
+  std::vector<BatchedExecution> _batched_executions;
 };
 }  // namespace hyrise
@@ -17,6 +17,8 @@
 namespace hyrise {
 
 // Holds relevant information about the execution of an SQLPipeline.
+class SchedulingGroup;
+
 struct SQLPipelineMetrics {
   std::vector<std::shared_ptr<const SQLPipelineStatementMetrics>> statement_metrics;
 
@@ -39,7 +41,8 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+              const std::shared_ptr<SchedulingGroup>& scheduling_group);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
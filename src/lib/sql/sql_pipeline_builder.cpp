@@ -5,6 +5,7 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "scheduler/scheduling_group.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "types.hpp"
@@ -42,13 +43,21 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_scheduling_group(
+    const std::shared_ptr<SchedulingGroup>& scheduling_group) {
+  _scheduling_group = scheduling_group;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() {
   return with_mvcc(UseMvcc::No);
 }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto scheduling_group = _scheduling_group ? _scheduling_group : std::make_shared<SchedulingGroup>();
+  auto pipeline =
+      SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache, scheduling_group);
   return pipeline;
 }
 
@@ -11,6 +11,7 @@
 namespace hyrise {
 
 class Optimizer;
+class SchedulingGroup;
 
 /**
  * Interface for the configured execution of SQL.
@@ -27,6 +28,7 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - The pipeline forms its own SchedulingGroup of default priority (see AdmissionControl).
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list. See
  * SQLPipeline[Statement] doc for these classes. In short, SQLPipeline is for queries with multiple statements,
@@ -41,6 +43,7 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
+  SQLPipelineBuilder& with_scheduling_group(const std::shared_ptr<SchedulingGroup>& scheduling_group);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -57,6 +60,7 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<SchedulingGroup> _scheduling_group;
 };
 
 }  // namespace hyrise
@@ -27,7 +27,9 @@
 #include "optimizer/optimizer.hpp"
 #include "optimizer/strategy/abstract_rule.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/scheduling_group.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
 #include "types.hpp"
@@ -38,18 +40,21 @@ namespace hyrise {
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                                            const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                                           const std::shared_ptr<SchedulingGroup>& scheduling_group)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
       _optimizer(optimizer),
+      _scheduling_group(scheduling_group),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(),
               "An SQLPipelineStatement should always contain a SQL statement string for caching.");
+  DebugAssert(_scheduling_group, "An SQLPipelineStatement must belong to a SchedulingGroup.");
 }
 
 void SQLPipelineStatement::set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context) {
@@ -287,6 +292,15 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   const auto& tasks = get_tasks();
 
+  // Tasks of high-priority queries are preferred by the workers. Tasks spawned by them inherit their priority.
+  const auto priority = _scheduling_group->priority();
+  for (const auto& task : tasks) {
+    task->set_priority(priority);
+  }
+
+  // Wait until the query is admitted if the number of concurrently executed queries is limited.
+  const auto admission_ticket = Hyrise::get().scheduler()->admission_control().admit(*_scheduling_group);
+
   const auto started = std::chrono::steady_clock::now();
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
@@ -297,6 +311,11 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   if (_use_mvcc == UseMvcc::Yes && _transaction_context->is_auto_commit()) {
     _transaction_context->commit();
+
+    // Serializable transactions are rolled back if their read set was invalidated by a concurrent transaction.
+    if (has_failed()) {
+      return {SQLPipelineStatus::Failure, _result_table};
+    }
   }
 
   if (_transaction_context) {
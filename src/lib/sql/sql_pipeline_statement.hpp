@@ -23,6 +23,8 @@
 namespace hyrise {
 
 // Holds relevant information about the execution of an SQLPipelineStatement.
+class SchedulingGroup;
+
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translation_duration{};
   std::chrono::nanoseconds optimization_duration{};
@@ -62,7 +64,8 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<SchedulingGroup>& scheduling_group);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
@@ -123,6 +126,7 @@ class SQLPipelineStatement : public Noncopyable {
   const UseMvcc _use_mvcc;
 
   const std::shared_ptr<Optimizer> _optimizer;
+  const std::shared_ptr<SchedulingGroup> _scheduling_group;
 
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
@@ -27,15 +27,14 @@ namespace {
 
 using namespace hyrise;  // NOLINT (build/namespaces)
 
-template <typename T>
-void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_statistics,
-                                           const pmr_vector<T>& dictionary) {
+template <typename T, typename Dictionary>
+void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_statistics, const Dictionary& dictionary) {
   if constexpr (std::is_arithmetic_v<T>) {
     segment_statistics.set_statistics_object(RangeFilter<T>::build_filter(dictionary));
   } else {
     if (!dictionary.empty()) {
       segment_statistics.set_statistics_object(
-          std::make_shared<MinMaxFilter<T>>(dictionary.front(), dictionary.back()));
+          std::make_shared<MinMaxFilter<T>>(T{dictionary.front()}, T{dictionary.back()}));
     }
   }
 
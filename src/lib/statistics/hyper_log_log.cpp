@@ -0,0 +1,59 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+void HyperLogLog::add_hash(size_t hash) {
+  // Finalizer of MurmurHash3 to distribute the bits of the hash evenly.
+  auto mixed_hash = static_cast<uint64_t>(hash);
+  mixed_hash ^= mixed_hash >> 33u;
+  mixed_hash *= 0xff51afd7ed558ccdULL;
+  mixed_hash ^= mixed_hash >> 33u;
+  mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+  mixed_hash ^= mixed_hash >> 33u;
+
+  // The first PRECISION bits select the register, the remaining bits are used to determine the rank.
+  const auto register_id = mixed_hash >> (64u - PRECISION);
+  const auto remaining_bits = mixed_hash << PRECISION;
+  const auto rank = static_cast<uint8_t>(
+      remaining_bits == 0 ? 64 - PRECISION + 1 : std::countl_zero(remaining_bits) + 1);
+
+  _registers[register_id] = std::max(_registers[register_id], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  for (auto register_id = size_t{0}; register_id < REGISTER_COUNT; ++register_id) {
+    _registers[register_id] = std::max(_registers[register_id], other._registers[register_id]);
+  }
+}
+
+DistinctCount HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+
+  auto inverse_sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -rank);
+    empty_register_count += rank == 0 ? 1 : 0;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, linear counting on the empty registers is more accurate. As we use 64-bit hashes, no
+  // correction for large cardinalities is required.
+  if (raw_estimate <= 2.5 * register_count && empty_register_count > 0) {
+    return register_count * std::log(register_count / static_cast<double>(empty_register_count));
+  }
+
+  return raw_estimate;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm",
+ * 2007) to estimate the number of distinct values in a multiset using constant memory. Adding a value multiple times
+ * does not change the sketch, and sketches of different inputs can be merged. With 2^12 one-byte registers, the
+ * standard error of the estimate is about 1.6%.
+ */
+class HyperLogLog {
+ public:
+  template <typename T>
+  void add(const T& value) {
+    add_hash(boost::hash<T>{}(value));
+  }
+
+  // The hash does not need to be well distributed (e.g., std::hash for integers is the identity), it is mixed first.
+  void add_hash(size_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  DistinctCount estimate() const;
+
+ private:
+  static constexpr auto PRECISION = uint8_t{12};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  // Each register holds the maximum position of the leftmost 1-bit observed in the hashes assigned to it.
+  std::array<uint8_t, REGISTER_COUNT> _registers{};
+};
+
+}  // namespace hyrise
@@ -0,0 +1,70 @@
+#include "segment_sketch.hpp"
+
+#include <memory>
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+void SegmentSketch::merge(const SegmentSketch& other) {
+  distinct_values.merge(other.distinct_values);
+  null_value_count += other.null_value_count;
+
+  if (variant_is_null(other.min)) {
+    return;
+  }
+
+  if (variant_is_null(min) || other.min < min) {
+    min = other.min;
+  }
+
+  if (variant_is_null(max) || max < other.max) {
+    max = other.max;
+  }
+}
+
+std::shared_ptr<ChunkSketches> generate_chunk_sketches(const Chunk& chunk) {
+  const auto column_count = chunk.column_count();
+  auto chunk_sketches = std::make_shared<ChunkSketches>(column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& segment = *chunk.get_segment(column_id);
+    auto& sketch = (*chunk_sketches)[column_id];
+
+    resolve_data_type(segment.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto min = std::optional<ColumnDataType>{};
+      auto max = std::optional<ColumnDataType>{};
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (position.is_null()) {
+          ++sketch.null_value_count;
+          return;
+        }
+
+        const auto& value = position.value();
+        sketch.distinct_values.add(value);
+        if (!min || value < *min) {
+          min = value;
+        }
+        if (!max || *max < value) {
+          max = value;
+        }
+      });
+
+      if (min) {
+        sketch.min = *min;
+        sketch.max = *max;
+      }
+    });
+  }
+
+  return chunk_sketches;
+}
+
+}  // namespace hyrise
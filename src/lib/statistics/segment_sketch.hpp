@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "statistics/hyper_log_log.hpp"
+#include "storage/chunk.hpp"
+
+namespace hyrise {
+
+/**
+ * Mergeable summary of a segment: a HyperLogLog sketch of its non-NULL values, its number of NULLs, and its minimum and
+ * maximum (NULL_VALUE if the segment contains only NULLs). The sketches of a chunk are built when the chunk is
+ * compressed (see ChunkCompressionTask). Merging the sketches of all chunks yields the distinct count, NULL ratio, and
+ * value range of a column without reading its data again (see StatisticsMaintenancePlugin).
+ */
+struct SegmentSketch {
+  void merge(const SegmentSketch& other);
+
+  HyperLogLog distinct_values;
+  uint64_t null_value_count{0};
+  AllTypeVariant min{NULL_VALUE};
+  AllTypeVariant max{NULL_VALUE};
+};
+
+/**
+ * Builds the sketches of all segments of a chunk.
+ */
+std::shared_ptr<ChunkSketches> generate_chunk_sketches(const Chunk& chunk);
+
+}  // namespace hyrise
@@ -1,8 +1,12 @@
 #include "equal_distinct_count_histogram.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -11,9 +15,11 @@
 #include <boost/unordered/unordered_flat_map.hpp>
 
 #include "all_type_variant.hpp"
+#include "statistics/hyper_log_log.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
 #include "statistics/statistics_objects/histogram_domain.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -50,19 +56,23 @@ void add_segment_to_value_distribution(const AbstractSegment& segment, ValueDist
   });
 }
 
+// Only every chunk_stride-th chunk is added to the value distribution. Returns the value distribution sorted by value
+// and the number of rows in the chunks that were read.
 template <typename T>
-std::vector<std::pair<T, HistogramCountType>> value_distribution_from_column(const Table& table,
-                                                                             const ColumnID column_id,
-                                                                             const HistogramDomain<T>& domain) {
+std::pair<std::vector<std::pair<T, HistogramCountType>>, uint64_t> value_distribution_from_column(
+    const Table& table, const ColumnID column_id, const HistogramDomain<T>& domain,
+    const ChunkID::base_type chunk_stride = 1) {
   auto value_distribution_map = ValueDistributionMap<T>{};
+  auto row_count = uint64_t{0};
   const auto chunk_count = table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; chunk_id += chunk_stride) {
     const auto chunk = table.get_chunk(chunk_id);
     if (!chunk) {
       continue;
     }
 
     add_segment_to_value_distribution<T>(*chunk->get_segment(column_id), value_distribution_map, domain);
+    row_count += chunk->size();
   }
 
   auto value_distribution =
@@ -72,8 +82,48 @@ std::vector<std::pair<T, HistogramCountType>> value_distribution_from_column(con
     return lhs.first < rhs.first;
   });
 
-  return value_distribution;
+  return {std::move(value_distribution), row_count};
 }
+
+// Adds all distinct values of a column to a HyperLogLog sketch. For dictionary-encoded segments, only the dictionary
+// needs to be read, as adding a value multiple times does not change the sketch.
+template <typename T>
+HyperLogLog distinct_count_sketch_from_column(const Table& table, const ColumnID column_id,
+                                              const HistogramDomain<T>& domain) {
+  auto sketch = HyperLogLog{};
+  const auto add_value = [&](const T& value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      sketch.add(domain.contains(value) ? value : domain.string_to_domain(value));
+    } else {
+      sketch.add(value);
+    }
+  };
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    const auto& segment = chunk->get_segment(column_id);
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      for (const auto& value : *dictionary_segment->dictionary()) {
+        add_value(T{value});
+      }
+      continue;
+    }
+
+    segment_iterate<T>(*segment, [&](const auto& iterator_value) {
+      if (!iterator_value.is_null()) {
+        add_value(iterator_value.value());
+      }
+    });
+  }
+
+  return sketch;
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -107,12 +157,51 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
   Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+  auto value_distribution = value_distribution_from_column(table, column_id, domain).first;
+  return _from_value_distribution(std::move(value_distribution), max_bin_count);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_column_sample(
+    const Table& table, const ColumnID column_id, const BinID max_bin_count, const double sampling_rate,
+    const HistogramDomain<T>& domain) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+  Assert(sampling_rate > 0.0 && sampling_rate <= 1.0, "Sampling rate must be in (0, 1].");
+
+  const auto chunk_stride = static_cast<ChunkID::base_type>(std::max(1.0, std::round(1.0 / sampling_rate)));
+  auto [value_distribution, sampled_row_count] =
+      value_distribution_from_column(table, column_id, domain, chunk_stride);
 
   if (value_distribution.empty()) {
     return nullptr;
   }
 
+  // Extrapolate the value counts from the sampled chunks to the entire table.
+  const auto height_scale = static_cast<double>(table.row_count()) / static_cast<double>(sampled_row_count);
+
+  // The number of distinct values does not grow linearly with the sample size. Thus, we estimate it for the entire
+  // column. The estimate can neither be smaller than the distinct count of the sample nor larger than the value count.
+  const auto sampled_value_count =
+      std::accumulate(value_distribution.cbegin(), value_distribution.cend(), HistogramCountType{0},
+                      [](const HistogramCountType count, const auto& value_and_count) {
+                        return count + value_and_count.second;
+                      });
+  const auto estimated_distinct_count =
+      std::clamp(std::round(distinct_count_sketch_from_column(table, column_id, domain).estimate()),
+                 static_cast<DistinctCount>(value_distribution.size()), sampled_value_count * height_scale);
+
+  return _from_value_distribution(std::move(value_distribution), max_bin_count, height_scale,
+                                  estimated_distinct_count);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::_from_value_distribution(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+    const double height_scale, const std::optional<DistinctCount> distinct_count) {
+  if (value_distribution.empty()) {
+    return nullptr;
+  }
+
   // If there are fewer distinct values than the number of desired bins use that instead.
   const auto bin_count =
       value_distribution.size() < max_bin_count ? static_cast<BinID>(value_distribution.size()) : max_bin_count;
@@ -148,14 +237,24 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
                         HistogramCountType{0},
                         [](HistogramCountType bin_height, const std::pair<T, HistogramCountType>& value_and_count) {
                           return bin_height + value_and_count.second;
-                        });
+                        }) *
+        height_scale;
 
     min_value_idx = max_value_idx + 1;
   }
 
+  if (!distinct_count) {
+    return std::make_shared<EqualDistinctCountHistogram<T>>(
+        std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+        static_cast<HistogramCountType>(distinct_count_per_bin), bin_count_with_extra_value);
+  }
+
+  // Distribute the (estimated) distinct count evenly among the bins.
+  const auto total_distinct_count = static_cast<size_t>(*distinct_count);
   return std::make_shared<EqualDistinctCountHistogram<T>>(
       std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
-      static_cast<HistogramCountType>(distinct_count_per_bin), bin_count_with_extra_value);
+      static_cast<HistogramCountType>(total_distinct_count / bin_count),
+      static_cast<BinID>(total_distinct_count % bin_count));
 }
 
 template <typename T>
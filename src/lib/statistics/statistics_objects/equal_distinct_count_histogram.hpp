@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -36,6 +37,20 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Create an EqualDistinctCountHistogram for a column of a large Table from a sample of its chunks. Only every n-th
+   * chunk (n = 1 / @param sampling_rate) is read, and the bin heights are extrapolated to the row count of the table.
+   * As the number of distinct values does not grow linearly with the sample size, the distinct count is estimated with
+   * a HyperLogLog sketch over the entire column instead. For dictionary-encoded segments, the sketch reads only the
+   * dictionaries. Values that do not occur in the sampled chunks might lie outside of the histogram's bins. Returns
+   * nullptr if the sampled chunks contain only NULLs, even if other chunks do not.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_column_sample(const Table& table,
+                                                                            const ColumnID column_id,
+                                                                            const BinID max_bin_count,
+                                                                            const double sampling_rate,
+                                                                            const HistogramDomain<T>& domain = {});
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -58,6 +73,15 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
   BinID next_bin_for_value(const T& value) const override;
 
  private:
+  /**
+   * Builds the bins from a value distribution that is sorted by value. The bin heights are multiplied with
+   * @param height_scale. If @param distinct_count is set, it is distributed among the bins instead of the number of
+   * values in the distribution.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> _from_value_distribution(
+      std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+      const double height_scale = 1.0, const std::optional<DistinctCount> distinct_count = std::nullopt);
+
   /**
    * We use multiple vectors rather than a vector of structs for ease-of-use with STL library functions.
    */
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -22,7 +23,8 @@
 
 namespace hyrise {
 
-std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
+std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table,
+                                                            const std::optional<double> histogram_sampling_rate) {
   const auto column_count = table.column_count();
   auto column_statistics = std::vector<std::shared_ptr<const BaseAttributeStatistics>>{column_count};
 
@@ -32,6 +34,15 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
    */
   const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
 
+  /**
+   * Counting every value of large tables dominates the time to load them. Thus, their histograms are built from a
+   * sample of chunks.
+   */
+  auto sampling_rate = histogram_sampling_rate;
+  if (!sampling_rate && table.row_count() >= HISTOGRAM_SAMPLING_ROW_COUNT_THRESHOLD) {
+    sampling_rate = DEFAULT_HISTOGRAM_SAMPLING_RATE;
+  }
+
   /**
    * We highly recommend setting up a multithreaded scheduler before the following procedure is executed to parallelly
    * create statistics objects for the table's columns.
@@ -48,17 +59,27 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
 
         const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
 
-        const auto histogram =
-            EqualDistinctCountHistogram<ColumnDataType>::from_column(table, column_id, histogram_bin_count);
+        auto histogram = std::shared_ptr<EqualDistinctCountHistogram<ColumnDataType>>{};
+        if (sampling_rate) {
+          histogram = EqualDistinctCountHistogram<ColumnDataType>::from_column_sample(
+              table, column_id, histogram_bin_count, *sampling_rate);
+        }
+
+        // Sampled chunks of a sparse column might contain only NULLs even though other chunks do not. In this case, we
+        // do not know whether the column is all-NULL and fall back to reading the entire column.
+        if (!histogram) {
+          histogram = EqualDistinctCountHistogram<ColumnDataType>::from_column(table, column_id, histogram_bin_count);
+        }
 
         if (histogram) {
           output_column_statistics->set_statistics_object(histogram);
 
           // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio
-          // property.
+          // property. Extrapolated bin heights of sampled histograms can slightly exceed the row count.
           const auto null_value_ratio =
-              table.row_count() == 0 ? 0.0
-                                     : 1.0 - (histogram->total_count() / static_cast<Selectivity>(table.row_count()));
+              table.row_count() == 0
+                  ? 0.0
+                  : std::max(0.0, 1.0 - (histogram->total_count() / static_cast<Selectivity>(table.row_count())));
           output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
         } else {
           // Failure to generate a histogram currently only stems from all-null segments.
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -22,9 +23,15 @@ class TableStatistics {
  public:
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * which statistics objects are created. Histograms are built from a sample of the table's chunks if
+   * @param histogram_sampling_rate is given or, by default, if the table has at least
+   * HISTOGRAM_SAMPLING_ROW_COUNT_THRESHOLD rows (see EqualDistinctCountHistogram::from_column_sample()).
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::shared_ptr<TableStatistics> from_table(
+      const Table& table, const std::optional<double> histogram_sampling_rate = std::nullopt);
+
+  static constexpr auto HISTOGRAM_SAMPLING_ROW_COUNT_THRESHOLD = uint64_t{100'000'000};
+  static constexpr auto DEFAULT_HISTOGRAM_SAMPLING_RATE = 0.1;
 
   TableStatistics(std::vector<std::shared_ptr<const BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
@@ -14,6 +14,7 @@
 #include "all_type_variant.hpp"
 #include "base_value_segment.hpp"
 #include "index/abstract_chunk_index.hpp"
+#include "statistics/segment_sketch.hpp"
 #include "storage/index/chunk_index_type.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/reference_segment.hpp"
@@ -105,6 +106,13 @@ std::shared_ptr<MvccData> Chunk::mvcc_data() const {
   return _mvcc_data;
 }
 
+bool Chunk::try_compact_mvcc_data() {
+  if (!_mvcc_data || is_mutable() || _mvcc_data->pending_inserts() != 0) {
+    return false;
+  }
+  return _mvcc_data->try_compact(size());
+}
+
 std::vector<std::shared_ptr<AbstractChunkIndex>> Chunk::get_indexes(
     const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
   auto result = std::vector<std::shared_ptr<AbstractChunkIndex>>();
@@ -196,11 +204,18 @@ void Chunk::migrate(MemoryResource& memory_resource) {
     Fail("Cannot migrate chunk with indexes.");
   }
 
-  auto new_segments = Segments(&memory_resource);
-  for (const auto& segment : _segments) {
-    new_segments.push_back(segment->copy_using_memory_resource(memory_resource));
+  const auto column_count = static_cast<ColumnID::base_type>(_segments.size());
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    replace_segment(column_id, get_segment(column_id)->copy_using_memory_resource(memory_resource));
   }
-  _segments = std::move(new_segments);
+}
+
+NodeID Chunk::node_id() const {
+  return _node_id;
+}
+
+void Chunk::set_node_id(const NodeID node_id) {
+  _node_id = node_id;
 }
 
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const {
@@ -253,6 +268,17 @@ void Chunk::set_pruning_statistics(const std::shared_ptr<ChunkPruningStatistics>
   std::atomic_store(&_pruning_statistics, pruning_statistics);
 }
 
+std::shared_ptr<const ChunkSketches> Chunk::sketches() const {
+  return std::atomic_load(&_sketches);
+}
+
+void Chunk::set_sketches(const std::shared_ptr<const ChunkSketches>& sketches) {
+  Assert(!is_mutable(), "Cannot set sketches on mutable chunks.");
+  Assert(!sketches || sketches->size() == static_cast<size_t>(column_count()),
+         "Sketches must have same number of segments as chunk.");
+  std::atomic_store(&_sketches, sketches);
+}
+
 void Chunk::increase_invalid_row_count(const ChunkOffset count, const std::memory_order memory_order) const {
   _invalid_row_count.fetch_add(count, memory_order);
 }
@@ -324,10 +350,29 @@ void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
   Assert(previous_cleanup_commit_id == UNSET_COMMIT_ID, "Cleanup CommitID can only be set once.");
 }
 
+bool Chunk::try_claim_for_cleanup() {
+  if (get_cleanup_commit_id()) {
+    return false;
+  }
+
+  auto expected = false;
+  return _is_claimed_for_cleanup.compare_exchange_strong(expected, true);
+}
+
+void Chunk::release_cleanup_claim() {
+  DebugAssert(!get_cleanup_commit_id(), "Cannot release the claim of a chunk that was already cleaned up.");
+  const auto was_claimed = _is_claimed_for_cleanup.exchange(false);
+  Assert(was_claimed, "Chunk was not claimed for cleanup.");
+}
+
 void Chunk::mark_as_full() {
   Assert(!_reached_target_size.exchange(true), "Chunk should not be marked as full multiple times.");
 }
 
+bool Chunk::is_full() const {
+  return _reached_target_size.load();
+}
+
 bool Chunk::try_set_immutable() {
   DebugAssert(_mvcc_data, "Expected to be executed with MVCC enabled.");
   // Mark the chunk as immutable if (i) it reached the target size and a new chunk was added to the table, (ii) it is
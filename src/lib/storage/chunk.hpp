@@ -24,10 +24,12 @@ namespace hyrise {
 class AbstractChunkIndex;
 class AbstractSegment;
 class BaseAttributeStatistics;
+struct SegmentSketch;
 
 using Segments = pmr_vector<std::shared_ptr<AbstractSegment>>;
 using Indexes = pmr_vector<std::shared_ptr<AbstractChunkIndex>>;
 using ChunkPruningStatistics = std::vector<std::shared_ptr<const BaseAttributeStatistics>>;
+using ChunkSketches = std::vector<SegmentSketch>;
 
 /**
  * Chunks are horizontal partitions of a table. They stores the table's data segment by segment. Optionally, mostly
@@ -84,6 +86,10 @@ class Chunk : private Noncopyable {
 
   std::shared_ptr<MvccData> mvcc_data() const;
 
+  // Compacts the MVCC data of an immutable chunk without pending Inserts (see MvccData::try_compact()). The caller has
+  // to ensure that no active transaction has a snapshot older than the chunk's `max_begin_cid`.
+  bool try_compact_mvcc_data();
+
   std::vector<std::shared_ptr<AbstractChunkIndex>> get_indexes(
       const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
   std::vector<std::shared_ptr<AbstractChunkIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
@@ -116,8 +122,21 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<AbstractChunkIndex>& index);
 
+  /**
+   * Copies the segments using the given memory resource (e.g., to move them to another NUMA node). As with
+   * replace_segment(), concurrent readers see either the old or the new segment of a column.
+   */
   void migrate(MemoryResource& memory_resource);
 
+  /**
+   * The NUMA node that holds the chunk's segments (see numa_placement.hpp). Operators prefer to process the chunk on
+   * workers of this node. INVALID_NODE_ID if the chunk has not been placed on a specific node.
+   * @{
+   */
+  NodeID node_id() const;
+  void set_node_id(const NodeID node_id);
+  /** @} */
+
   bool references_exactly_one_table() const;
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
@@ -130,6 +149,15 @@ class Chunk : private Noncopyable {
   void set_pruning_statistics(const std::shared_ptr<ChunkPruningStatistics>& pruning_statistics);
   /** @} */
 
+  /**
+   * Mergeable sketches of the chunk's segments that are used to maintain the table statistics (see
+   * segment_sketch.hpp). Like pruning statistics, they can only be set for immutable chunks.
+   * @{
+   */
+  std::shared_ptr<const ChunkSketches> sketches() const;
+  void set_sketches(const std::shared_ptr<const ChunkSketches>& sketches);
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments.
    */
@@ -180,6 +208,16 @@ class Chunk : private Noncopyable {
 
   void set_cleanup_commit_id(CommitID cleanup_commit_id);
 
+  /**
+   * Besides the MvccDeletePlugin, the ChunkMergingPlugin and the ClusteringPlugin rewrite chunks as described above.
+   * Their candidates can overlap (e.g., a sparse chunk with many dead rows). Before a rewriter starts its transaction,
+   * it claims the chunk. Only one rewriter can claim a chunk and chunks with a cleanup CommitID cannot be claimed, so
+   * the cleanup CommitID is set at most once. If the rewrite fails (e.g., due to a transaction conflict), the claim is
+   * released. Otherwise, it is kept.
+   */
+  bool try_claim_for_cleanup();
+  void release_cleanup_claim();
+
   /**
    * Makes chunks immutable, and if not already done by Insert operators, the MVCC `max_begin_cid` is set. Marking a
    * chunk as immutable is the inserter's responsibility.
@@ -191,8 +229,11 @@ class Chunk : private Noncopyable {
    * former last chunk can be marked as immutable as soon as all pending Inserts commit or roll back and try to mark the
    * chunks they interted into. If there are no pending Inserts, i.e., the chunk was filled to its target size and all
    * Inserts are committed/rolled back, the chunk is immediately marked.
+   * Background maintenance may mark a chunk as full before it reached its target size to seal it (see
+   * ChunkMergingPlugin). Insert operators do not append to chunks that are marked as full.
    */
   void mark_as_full();
+  bool is_full() const;
   bool try_set_immutable();
 
  private:
@@ -204,6 +245,7 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
   std::shared_ptr<ChunkPruningStatistics> _pruning_statistics;
+  std::shared_ptr<const ChunkSketches> _sketches;
   std::atomic_bool _is_mutable{true};
   std::atomic_bool _reached_target_size{false};
   std::vector<SortColumnDefinition> _sorted_by;
@@ -211,6 +253,9 @@ class Chunk : private Noncopyable {
 
   // Default value of zero (beginning of time) means "not set".
   std::atomic<CommitID> _cleanup_commit_id{UNSET_COMMIT_ID};
+  std::atomic_bool _is_claimed_for_cleanup{false};
+
+  std::atomic<NodeID> _node_id{INVALID_NODE_ID};
 };
 
 }  // namespace hyrise
@@ -2,6 +2,7 @@
 
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/frame_of_reference_segment/frame_of_reference_segment_iterable.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/lz4_segment/lz4_segment_iterable.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
@@ -22,12 +23,12 @@ template <typename T, bool EraseSegmentType>
 auto create_iterable_from_segment(const DictionarySegment<T>& segment) {
 #ifdef HYRISE_ERASE_DICTIONARY
   PerformanceWarning("DictionarySegmentIterable erased by compile-time setting");
-  return AnySegmentIterable<T>(DictionarySegmentIterable<T, pmr_vector<T>>(segment));
+  return AnySegmentIterable<T>(DictionarySegmentIterable<T, typename DictionarySegment<T>::Dictionary>(segment));
 #else
   if constexpr (EraseSegmentType) {
     return create_any_segment_iterable<T>(segment);
   } else {
-    return DictionarySegmentIterable<T, pmr_vector<T>>{segment};
+    return DictionarySegmentIterable<T, typename DictionarySegment<T>::Dictionary>{segment};
   }
 #endif
 }
@@ -81,4 +82,18 @@ auto create_iterable_from_segment(const LZ4Segment<T>& segment) {
   return AnySegmentIterable<T>(LZ4SegmentIterable<T>(segment));
 }
 
+template <typename T, bool EraseSegmentType>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment) {
+#ifdef HYRISE_ERASE_FSST
+  PerformanceWarning("FSSTSegmentIterable erased by compile-time setting");
+  return AnySegmentIterable<T>(FSSTSegmentIterable<T>(segment));
+#else
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return FSSTSegmentIterable<T>{segment};
+  }
+#endif
+}
+
 }  // namespace hyrise
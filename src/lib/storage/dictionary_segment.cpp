@@ -18,12 +18,11 @@
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
-#include "utils/size_estimation_utils.hpp"
 
 namespace hyrise {
 
 template <typename T>
-DictionarySegment<T>::DictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<const Dictionary>& dictionary,
                                         const std::shared_ptr<const BaseCompressedVector>& attribute_vector)
     : BaseDictionarySegment(data_type_from_type<T>()),
       _dictionary{dictionary},
@@ -49,7 +48,7 @@ AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset)
 }
 
 template <typename T>
-std::shared_ptr<const pmr_vector<T>> DictionarySegment<T>::dictionary() const {
+std::shared_ptr<const typename DictionarySegment<T>::Dictionary> DictionarySegment<T>::dictionary() const {
   // We have no idea how the dictionary will be used, so we do not increment the access counters here
   return _dictionary;
 }
@@ -63,21 +62,21 @@ template <typename T>
 std::shared_ptr<AbstractSegment> DictionarySegment<T>::copy_using_memory_resource(
     MemoryResource& memory_resource) const {
   auto new_attribute_vector = _attribute_vector->copy_using_memory_resource(memory_resource);
-  auto new_dictionary = std::make_shared<pmr_vector<T>>(*_dictionary, &memory_resource);
+  auto new_dictionary = std::make_shared<Dictionary>(*_dictionary, &memory_resource);
   auto copy = std::make_shared<DictionarySegment<T>>(std::move(new_dictionary), std::move(new_attribute_vector));
   copy->access_counter = access_counter;
   return copy;
 }
 
 template <typename T>
-size_t DictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode mode) const {
+size_t DictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
   const auto common_elements_size = sizeof(*this) + _attribute_vector->data_size();
 
   if constexpr (std::is_same_v<T, pmr_string>) {
-    return common_elements_size + string_vector_memory_usage(*_dictionary, mode);
+    // The size of the strings is known exactly, no sampling required.
+    return common_elements_size + sizeof(Dictionary) + _dictionary->data_size();
   }
-  return common_elements_size +
-         (_dictionary->size() * sizeof(typename decltype(_dictionary)::element_type::value_type));
+  return common_elements_size + (_dictionary->size() * sizeof(typename Dictionary::value_type));
 }
 
 template <typename T>
@@ -122,7 +121,7 @@ template <typename T>
 AllTypeVariant DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
   DebugAssert(value_id < _dictionary->size(), "ValueID out of bounds");
   access_counter[SegmentAccessCounter::AccessType::Dictionary] += 1;
-  return (*_dictionary)[value_id];
+  return T{(*_dictionary)[value_id]};
 }
 
 template <typename T>
@@ -2,8 +2,10 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include "base_dictionary_segment.hpp"
+#include "dictionary_segment/contiguous_string_vector.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "types.hpp"
 
@@ -14,16 +16,19 @@ class BaseCompressedVector;
 /**
  * @brief Segment implementing dictionary encoding
  *
- * Uses vector compression schemes for its attribute vector.
+ * Uses vector compression schemes for its attribute vector. The dictionary of string segments is stored in a
+ * ContiguousStringVector, which returns the values as std::string_view.
  */
 template <typename T>
 class DictionarySegment : public BaseDictionarySegment {
  public:
-  explicit DictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
+  using Dictionary = std::conditional_t<std::is_same_v<T, pmr_string>, ContiguousStringVector, pmr_vector<T>>;
+
+  explicit DictionarySegment(const std::shared_ptr<const Dictionary>& dictionary,
                              const std::shared_ptr<const BaseCompressedVector>& attribute_vector);
 
   // returns an underlying dictionary
-  std::shared_ptr<const pmr_vector<T>> dictionary() const;
+  std::shared_ptr<const Dictionary> dictionary() const;
 
   /**
    * @defgroup AbstractSegment interface
@@ -38,7 +43,7 @@ class DictionarySegment : public BaseDictionarySegment {
     if (value_id == _dictionary->size()) {
       return std::nullopt;
     }
-    return (*_dictionary)[value_id];
+    return T{(*_dictionary)[value_id]};
   }
 
   ChunkOffset size() const final;
@@ -85,7 +90,7 @@ class DictionarySegment : public BaseDictionarySegment {
   /**@}*/
 
  protected:
-  const std::shared_ptr<const pmr_vector<T>> _dictionary;
+  const std::shared_ptr<const Dictionary> _dictionary;
   const std::shared_ptr<const BaseCompressedVector> _attribute_vector;
   std::unique_ptr<BaseVectorDecompressor> _decompressor;
 };
@@ -0,0 +1,71 @@
+#include "contiguous_string_vector.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+ContiguousStringVector::ContiguousStringVector(const PolymorphicAllocator<char>& allocator)
+    : _chars{allocator}, _offsets{allocator} {}
+
+ContiguousStringVector::ContiguousStringVector(const ContiguousStringVector& other,
+                                               const PolymorphicAllocator<char>& allocator)
+    : _chars{other._chars, allocator}, _offsets{other._offsets, allocator} {}
+
+ContiguousStringVector::ContiguousStringVector(pmr_vector<char> chars, pmr_vector<size_t> offsets)
+    : _chars{std::move(chars)}, _offsets{std::move(offsets)} {
+  Assert(_offsets.empty() ? _chars.empty() : _offsets.front() == 0 && _offsets.back() == _chars.size(),
+         "Offsets do not match the given characters.");
+}
+
+std::string_view ContiguousStringVector::front() const {
+  DebugAssert(!empty(), "Cannot access the first string of an empty vector.");
+  return (*this)[0];
+}
+
+std::string_view ContiguousStringVector::back() const {
+  DebugAssert(!empty(), "Cannot access the last string of an empty vector.");
+  return (*this)[size() - 1];
+}
+
+ContiguousStringVector::Iterator ContiguousStringVector::begin() const noexcept {
+  return Iterator{*this, 0};
+}
+
+ContiguousStringVector::Iterator ContiguousStringVector::end() const noexcept {
+  return Iterator{*this, size()};
+}
+
+ContiguousStringVector::Iterator ContiguousStringVector::cbegin() const noexcept {
+  return begin();
+}
+
+ContiguousStringVector::Iterator ContiguousStringVector::cend() const noexcept {
+  return end();
+}
+
+size_t ContiguousStringVector::size() const {
+  return _offsets.empty() ? 0 : _offsets.size() - 1;
+}
+
+bool ContiguousStringVector::empty() const {
+  return size() == 0;
+}
+
+const pmr_vector<char>& ContiguousStringVector::chars() const {
+  return _chars;
+}
+
+const pmr_vector<size_t>& ContiguousStringVector::offsets() const {
+  return _offsets;
+}
+
+size_t ContiguousStringVector::data_size() const {
+  return _chars.capacity() + _offsets.capacity() * sizeof(size_t);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Immutable vector of variable-length strings that stores the characters of all strings in a single buffer. The i-th
+ * string spans the characters from offsets[i] to offsets[i + 1]. Compared to a pmr_vector<pmr_string>, there is no
+ * string object per value (32 bytes in libstdc++) and no separate heap allocation for strings that exceed the small
+ * string buffer. Thus, searching and scanning the strings does not chase pointers. Strings are returned as
+ * std::string_view, which are valid as long as the vector exists.
+ *
+ * Empty vectors do not store any offsets, so that they do not allocate memory.
+ */
+class ContiguousStringVector {
+ public:
+  class Iterator : public boost::iterator_facade<Iterator, const std::string_view, std::random_access_iterator_tag,
+                                                 const std::string_view> {
+   public:
+    Iterator() = default;
+
+    Iterator(const ContiguousStringVector& vector, const size_t index) : _vector{&vector}, _index{index} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    bool equal(const Iterator& other) const {
+      return _index == other._index;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    void advance(const std::ptrdiff_t n) {
+      _index += n;
+    }
+
+    void increment() {
+      ++_index;
+    }
+
+    void decrement() {
+      --_index;
+    }
+
+    std::string_view dereference() const {
+      return (*_vector)[_index];
+    }
+
+    const ContiguousStringVector* _vector{nullptr};
+    size_t _index{0};
+  };
+
+  using value_type = std::string_view;
+  using const_iterator = Iterator;
+
+  explicit ContiguousStringVector(const PolymorphicAllocator<char>& allocator = {});
+
+  // Copies the strings of another vector, e.g., to migrate them to another memory resource.
+  ContiguousStringVector(const ContiguousStringVector& other, const PolymorphicAllocator<char>& allocator = {});
+
+  // Creates a vector from existing data. `offsets` has to hold one more entry than there are strings (or none).
+  ContiguousStringVector(pmr_vector<char> chars, pmr_vector<size_t> offsets);
+
+  // Creates a vector of the strings in the range [first, last).
+  template <typename Iter>
+  ContiguousStringVector(Iter first, Iter last, const PolymorphicAllocator<char>& allocator = {})
+      : _chars{allocator}, _offsets{allocator} {
+    const auto value_count = static_cast<size_t>(std::distance(first, last));
+    if (value_count == 0) {
+      return;
+    }
+
+    auto char_count = size_t{0};
+    for (auto iter = first; iter != last; ++iter) {
+      char_count += std::string_view{*iter}.size();
+    }
+
+    _chars.reserve(char_count);
+    _offsets.reserve(value_count + 1);
+    _offsets.emplace_back(0);
+    for (; first != last; ++first) {
+      const auto string = std::string_view{*first};
+      _chars.insert(_chars.end(), string.cbegin(), string.cend());
+      _offsets.emplace_back(_chars.size());
+    }
+  }
+
+  std::string_view operator[](const size_t index) const {
+    // performance critical - not in cpp to help with inlining
+    const auto begin = _offsets[index];
+    return std::string_view{_chars.data() + begin, _offsets[index + 1] - begin};
+  }
+
+  std::string_view front() const;
+  std::string_view back() const;
+
+  Iterator begin() const noexcept;
+  Iterator end() const noexcept;
+  Iterator cbegin() const noexcept;
+  Iterator cend() const noexcept;
+
+  size_t size() const;
+  bool empty() const;
+
+  // Returns the characters of all strings without separators.
+  const pmr_vector<char>& chars() const;
+
+  // Returns the offsets of the strings in chars(), followed by the total number of characters.
+  const pmr_vector<size_t>& offsets() const;
+
+  // Returns the number of bytes allocated for the characters and offsets.
+  size_t data_size() const;
+
+ protected:
+  pmr_vector<char> _chars;
+  pmr_vector<size_t> _offsets;
+};
+
+}  // namespace hyrise
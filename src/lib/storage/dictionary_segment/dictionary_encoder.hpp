@@ -3,10 +3,12 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "storage/base_segment_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/dictionary_segment/contiguous_string_vector.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment.hpp"
@@ -95,6 +97,11 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
       auto fixed_string_dictionary =
           std::make_shared<FixedStringVector>(dictionary->cbegin(), dictionary->cend(), max_string_length, allocator);
       return std::make_shared<FixedStringDictionarySegment<T>>(fixed_string_dictionary, compressed_attribute_vector);
+    } else if constexpr (std::is_same_v<T, pmr_string>) {
+      // Encode a string segment with a ContiguousStringVector as dictionary
+      auto string_dictionary =
+          std::make_shared<ContiguousStringVector>(dictionary->cbegin(), dictionary->cend(), allocator);
+      return std::make_shared<DictionarySegment<T>>(string_dictionary, compressed_attribute_vector);
     } else {
       // Encode a segment with a pmr_vector<T> as dictionary
       return std::make_shared<DictionarySegment<T>>(dictionary, compressed_attribute_vector);
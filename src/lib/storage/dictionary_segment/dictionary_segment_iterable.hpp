@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -65,6 +69,31 @@ class DictionarySegmentIterable : public PointAccessibleSegmentIterable<Dictiona
     return _segment.size();
   }
 
+  // Unpacks the attribute vector range first (see CompressedVector::decompress), then looks up the dictionary.
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* nulls) const {
+    DebugAssert(begin + count <= _segment.size(), "Block exceeds the segment.");
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += count;
+    _segment.access_counter[SegmentAccessCounter::AccessType::Dictionary] += count;
+
+    resolve_compressed_vector_type(*_segment.attribute_vector(), [&](const auto& vector) {
+      const auto dictionary_begin_it = _dictionary->cbegin();
+      const auto null_value_id = static_cast<uint32_t>(_segment.null_value_id());
+
+      auto value_ids = std::array<uint32_t, SEGMENT_DECODE_BLOCK_SIZE>{};
+      for (auto batch_begin = size_t{0}; batch_begin < count; batch_begin += SEGMENT_DECODE_BLOCK_SIZE) {
+        const auto batch_size = std::min(SEGMENT_DECODE_BLOCK_SIZE, count - batch_begin);
+        vector.decompress(begin + batch_begin, batch_size, value_ids.data());
+
+        for (auto index = size_t{0}; index < batch_size; ++index) {
+          const auto value_id = value_ids[index];
+          const auto is_null = value_id == null_value_id;
+          nulls[batch_begin + index] = is_null;
+          values[batch_begin + index] = is_null ? T{} : T{*(dictionary_begin_it + value_id)};
+        }
+      }
+    });
+  }
+
  private:
   template <typename CompressedVectorIterator, typename DictionaryIteratorType>
   class Iterator
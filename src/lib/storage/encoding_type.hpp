@@ -23,7 +23,15 @@ namespace hyrise {
 
 namespace hana = boost::hana;
 
-enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference, LZ4 };
+enum class EncodingType : uint8_t {
+  Unencoded,
+  Dictionary,
+  RunLength,
+  FixedStringDictionary,
+  FrameOfReference,
+  LZ4,
+  FSST
+};
 
 std::ostream& operator<<(std::ostream& stream, const EncodingType encoding_type);
 
@@ -41,7 +49,8 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<pmr_string>),
     hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types));
+    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FSST>, hana::tuple_t<pmr_string>));
 
 /**
  * @return an integral constant implicitly convertible to bool
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -83,6 +87,51 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     return _segment.size();
   }
 
+  // Unpacks the offset values of the range first and adds the minimum of each frame afterwards.
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* nulls) const {
+    static constexpr auto block_size = size_t{FrameOfReferenceSegment<T>::block_size};
+
+    DebugAssert(begin + count <= _segment.size(), "Block exceeds the segment.");
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += count;
+
+    const auto& block_minima = _segment.block_minima();
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      auto offsets = std::array<uint32_t, SEGMENT_DECODE_BLOCK_SIZE>{};
+      for (auto batch_begin = size_t{0}; batch_begin < count; batch_begin += SEGMENT_DECODE_BLOCK_SIZE) {
+        const auto batch_size = std::min(SEGMENT_DECODE_BLOCK_SIZE, count - batch_begin);
+        offset_values.decompress(begin + batch_begin, batch_size, offsets.data());
+
+        // A batch may span multiple frames. Within a frame, all offsets are added to the same minimum.
+        auto index = size_t{0};
+        while (index < batch_size) {
+          const auto chunk_offset = begin + batch_begin + index;
+          const auto block_minimum = block_minima[chunk_offset / block_size];
+          const auto frame_value_count = std::min(batch_size - index, block_size - (chunk_offset % block_size));
+          auto* const frame_values = values + batch_begin + index;
+          const auto* const frame_offsets = offsets.data() + index;
+
+          // This empty block is used to convince clang-format to keep the pragma indented.
+          // NOLINTNEXTLINE
+          {}  // clang-format off
+          #pragma omp simd
+          // clang-format on
+          for (auto frame_index = size_t{0}; frame_index < frame_value_count; ++frame_index) {
+            frame_values[frame_index] = static_cast<T>(frame_offsets[frame_index]) + block_minimum;
+          }
+
+          index += frame_value_count;
+        }
+      }
+    });
+
+    const auto& null_values = _segment.null_values();
+    if (null_values) {
+      std::copy_n(null_values->cbegin() + static_cast<std::ptrdiff_t>(begin), count, nulls);
+    } else {
+      std::fill_n(nulls, count, false);
+    }
+  }
+
  private:
   const FrameOfReferenceSegment<T>& _segment;
 
@@ -0,0 +1,132 @@
+#include "fsst_segment.hpp"
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace hyrise {
+
+template <typename T>
+FSSTSegment<T>::FSSTSegment(FSSTSymbolTable&& symbol_table, pmr_vector<char>&& compressed_values,
+                            std::unique_ptr<const BaseCompressedVector>&& offsets,
+                            std::optional<pmr_vector<bool>>&& null_values)
+    : AbstractEncodedSegment{data_type_from_type<pmr_string>()},
+      _symbol_table{std::move(symbol_table)},
+      _compressed_values{std::move(compressed_values)},
+      _offsets{std::move(offsets)},
+      _null_values{std::move(null_values)},
+      _decompressor{_offsets->create_base_decompressor()} {
+  DebugAssert(!_null_values || _null_values->size() == _offsets->size(), "Expected one NULL flag per row.");
+}
+
+template <typename T>
+const FSSTSymbolTable& FSSTSegment<T>::symbol_table() const {
+  return _symbol_table;
+}
+
+template <typename T>
+const pmr_vector<char>& FSSTSegment<T>::compressed_values() const {
+  return _compressed_values;
+}
+
+template <typename T>
+const std::unique_ptr<const BaseCompressedVector>& FSSTSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+const std::optional<pmr_vector<bool>>& FSSTSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+std::string_view FSSTSegment<T>::compressed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "ChunkOffset out of bounds.");
+
+  const auto begin = chunk_offset == 0 ? size_t{0} : size_t{_decompressor->get(chunk_offset - 1)};
+  const auto end = size_t{_decompressor->get(chunk_offset)};
+  return std::string_view{_compressed_values.data() + begin, end - begin};
+}
+
+template <typename T>
+AllTypeVariant FSSTSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+std::optional<T> FSSTSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values && (*_null_values)[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  return _symbol_table.decode(compressed_value(chunk_offset));
+}
+
+template <typename T>
+ChunkOffset FSSTSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_offsets->size());
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> FSSTSegment<T>::copy_using_memory_resource(MemoryResource& memory_resource) const {
+  auto new_symbol_table = FSSTSymbolTable{_symbol_table, &memory_resource};
+  auto new_compressed_values = pmr_vector<char>{_compressed_values, &memory_resource};
+  auto new_offsets = _offsets->copy_using_memory_resource(memory_resource);
+  auto new_null_values =
+      _null_values ? std::optional<pmr_vector<bool>>{pmr_vector<bool>{*_null_values, &memory_resource}} : std::nullopt;
+
+  auto copy = std::make_shared<FSSTSegment<T>>(std::move(new_symbol_table), std::move(new_compressed_values),
+                                               std::move(new_offsets), std::move(new_null_values));
+
+  copy->access_counter = access_counter;
+
+  return copy;
+}
+
+template <typename T>
+size_t FSSTSegment<T>::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  // MemoryUsageCalculationMode ignored as full calculation is efficient.
+  auto null_value_vector_size = size_t{0};
+  if (_null_values) {
+    null_value_vector_size = _null_values->capacity() / CHAR_BIT;
+  }
+
+  return sizeof(*this) + _symbol_table.data_size() + _compressed_values.capacity() + _offsets->data_size() +
+         null_value_vector_size;
+}
+
+template <typename T>
+EncodingType FSSTSegment<T>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T>
+std::optional<CompressedVectorType> FSSTSegment<T>::compressed_vector_type() const {
+  return _offsets->type();
+}
+
+template class FSSTSegment<pmr_string>;
+
+}  // namespace hyrise
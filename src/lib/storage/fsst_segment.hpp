@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "abstract_encoded_segment.hpp"
+#include "fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing FSST compression for strings
+ *
+ * Each string is compressed independently with a symbol table that is built per segment (see FSSTSymbolTable). The
+ * codes of all strings are stored in a single buffer. The end offsets of the strings in this buffer are compressed
+ * using vector compression. In contrast to LZ4, a single value can be decompressed without decompressing its
+ * neighbors, which makes FSST suitable for high-cardinality string columns that are accessed via position lists.
+ *
+ * Predicates can be evaluated on the codes: equality is checked by comparing the codes of the search value with the
+ * codes of each row, prefix matches only decompress the symbols that cover the prefix.
+ */
+template <typename T>
+class FSSTSegment : public AbstractEncodedSegment {
+ public:
+  /**
+   * @param symbol_table The symbol table that the strings were compressed with.
+   * @param compressed_values The codes of all strings. NULL values do not have any codes.
+   * @param offsets The exclusive end offsets of the strings' codes in compressed_values. The string at position i
+   *                starts at the end offset of the string at position i - 1 (or at 0 for the first string). As there
+   *                is one offset per row, the number of offsets is the size of the segment.
+   * @param null_values Stores whether a row is NULL. If no value in the segment is NULL, std::nullopt is passed to
+   *                    reduce the memory footprint.
+   */
+  explicit FSSTSegment(FSSTSymbolTable&& symbol_table, pmr_vector<char>&& compressed_values,
+                       std::unique_ptr<const BaseCompressedVector>&& offsets,
+                       std::optional<pmr_vector<bool>>&& null_values);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<char>& compressed_values() const;
+  const std::unique_ptr<const BaseCompressedVector>& offsets() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  // Returns the codes of the value at the given position, which can be decompressed using the symbol table.
+  std::string_view compressed_value(const ChunkOffset chunk_offset) const;
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_memory_resource(MemoryResource& memory_resource) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ protected:
+  const FSSTSymbolTable _symbol_table;
+  const pmr_vector<char> _compressed_values;
+  const std::unique_ptr<const BaseCompressedVector> _offsets;
+  const std::optional<pmr_vector<bool>> _null_values;
+  const std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+extern template class FSSTSegment<pmr_string>;
+
+}  // namespace hyrise
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace hyrise {
+
+/**
+ * Encodes a string segment with FSST. The symbol table is built from a sample of the segment's values (see
+ * FSSTSymbolTable::build), then every value is compressed independently.
+ */
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<pmr_string> segment_iterable,
+                                                     const PolymorphicAllocator<pmr_string>& allocator) {
+    // The values are copied once, as the symbol table has to be built before the first value can be compressed.
+    auto values = std::vector<pmr_string>{};
+    auto null_values = pmr_vector<bool>{allocator};
+    auto segment_contains_null = false;
+
+    segment_iterable.with_iterators([&](auto it, auto end) {
+      const auto segment_size = std::distance(it, end);
+      values.resize(segment_size);
+      null_values.resize(segment_size);
+
+      auto row_index = size_t{0};
+      for (; it != end; ++it) {
+        const auto segment_element = *it;
+        const auto is_null = segment_element.is_null();
+        null_values[row_index] = is_null;
+        segment_contains_null |= is_null;
+        if (!is_null) {
+          values[row_index] = segment_element.value();
+        }
+        ++row_index;
+      }
+    });
+
+    const auto value_views = std::vector<std::string_view>(values.cbegin(), values.cend());
+    auto symbol_table = FSSTSymbolTable::build(value_views, allocator);
+
+    auto compressed_values = pmr_vector<char>{allocator};
+    auto offsets = pmr_vector<uint32_t>{allocator};
+    offsets.reserve(values.size());
+    for (const auto& value : value_views) {
+      symbol_table.encode(value, compressed_values);
+      Assert(compressed_values.size() <= std::numeric_limits<uint32_t>::max(),
+             "The compressed values exceed the maximum of uint32 in FSST encoding.");
+      offsets.emplace_back(static_cast<uint32_t>(compressed_values.size()));
+    }
+    compressed_values.shrink_to_fit();
+
+    const auto max_offset = offsets.empty() ? uint32_t{0} : offsets.back();
+    auto compressed_offsets = compress_vector(offsets, vector_compression_type(), allocator, {max_offset});
+
+    auto optional_null_values =
+        segment_contains_null ? std::optional<pmr_vector<bool>>{std::move(null_values)} : std::nullopt;
+
+    return std::make_shared<FSSTSegment<pmr_string>>(std::move(symbol_table), std::move(compressed_values),
+                                                     std::move(compressed_offsets), std::move(optional_null_values));
+  }
+};
+
+}  // namespace hyrise
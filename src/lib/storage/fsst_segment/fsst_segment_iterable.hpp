@@ -0,0 +1,178 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace hyrise {
+
+/**
+ * Iterable for FSSTSegments. By default, each value is decompressed when it is dereferenced. If Value is
+ * std::string_view, the iterable yields the codes of the values instead (see FSSTSegment::compressed_value). Those are
+ * used by the table scans to evaluate predicates without decompressing all strings.
+ */
+template <typename T, typename Value = T>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T, Value>> {
+ public:
+  using ValueType = Value;
+
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+    resolve_compressed_vector_type(*_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+
+      const auto* null_values = _segment.null_values() ? &*_segment.null_values() : nullptr;
+      auto begin = Iterator<OffsetDecompressor>{&_segment.symbol_table(), &_segment.compressed_values(), null_values,
+                                                offsets.create_decompressor(), ChunkOffset{0}};
+      auto end = Iterator<OffsetDecompressor>{&_segment.symbol_table(), &_segment.compressed_values(), null_values,
+                                              offsets.create_decompressor(), static_cast<ChunkOffset>(_segment.size())};
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(*_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      const auto* null_values = _segment.null_values() ? &*_segment.null_values() : nullptr;
+      auto begin = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment.symbol_table(), &_segment.compressed_values(), null_values, offsets.create_decompressor(),
+          position_filter->cbegin(), position_filter->cbegin()};
+      auto end = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment.symbol_table(), &_segment.compressed_values(), null_values, offsets.create_decompressor(),
+          position_filter->cbegin(), position_filter->cend()};
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const {
+    return _segment.size();
+  }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+  // Returns the (decompressed) value of a row. NULL values do not have any codes and are decompressed to empty
+  // strings.
+  template <typename OffsetDecompressor>
+  static Value _value(const FSSTSymbolTable& symbol_table, const pmr_vector<char>& compressed_values,
+                      OffsetDecompressor& offset_decompressor, const ChunkOffset chunk_offset) {
+    const auto begin = chunk_offset == 0 ? size_t{0} : size_t{offset_decompressor.get(chunk_offset - 1)};
+    const auto end = size_t{offset_decompressor.get(chunk_offset)};
+    const auto codes = std::string_view{compressed_values.data() + begin, end - begin};
+
+    if constexpr (std::is_same_v<Value, std::string_view>) {
+      return codes;
+    } else {
+      return symbol_table.decode(codes);
+    }
+  }
+
+ private:
+  template <typename OffsetDecompressor>
+  class Iterator : public AbstractSegmentIterator<Iterator<OffsetDecompressor>, SegmentPosition<Value>> {
+   public:
+    using ValueType = Value;
+    using IterableType = FSSTSegmentIterable<T, Value>;
+
+   public:
+    explicit Iterator(const FSSTSymbolTable* symbol_table, const pmr_vector<char>* compressed_values,
+                      const pmr_vector<bool>* null_values, OffsetDecompressor offset_decompressor,
+                      ChunkOffset chunk_offset)
+        : _symbol_table{symbol_table},
+          _compressed_values{compressed_values},
+          _null_values{null_values},
+          _offset_decompressor{std::move(offset_decompressor)},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+    }
+
+    void decrement() {
+      --_chunk_offset;
+    }
+
+    void advance(std::ptrdiff_t n) {
+      _chunk_offset += n;
+    }
+
+    bool equal(const Iterator& other) const {
+      return _chunk_offset == other._chunk_offset;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<Value> dereference() const {
+      const auto is_null = _null_values && (*_null_values)[_chunk_offset];
+      return SegmentPosition<Value>{
+          _value(*_symbol_table, *_compressed_values, _offset_decompressor, _chunk_offset), is_null, _chunk_offset};
+    }
+
+   private:
+    const FSSTSymbolTable* _symbol_table;
+    const pmr_vector<char>* _compressed_values;
+    const pmr_vector<bool>* _null_values;
+    mutable OffsetDecompressor _offset_decompressor;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<Value>, PosListIteratorType> {
+   public:
+    using ValueType = Value;
+    using IterableType = FSSTSegmentIterable<T, Value>;
+
+    PointAccessIterator(const FSSTSymbolTable* symbol_table, const pmr_vector<char>* compressed_values,
+                        const pmr_vector<bool>* null_values, OffsetDecompressor offset_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                             SegmentPosition<Value>, PosListIteratorType>{
+              std::move(position_filter_begin), std::move(position_filter_it)},
+          _symbol_table{symbol_table},
+          _compressed_values{compressed_values},
+          _null_values{null_values},
+          _offset_decompressor{std::move(offset_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<Value> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      const auto is_null = _null_values && (*_null_values)[current_offset];
+      return SegmentPosition<Value>{_value(*_symbol_table, *_compressed_values, _offset_decompressor, current_offset),
+                                    is_null, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const FSSTSymbolTable* _symbol_table;
+    const pmr_vector<char>* _compressed_values;
+    const pmr_vector<bool>* _null_values;
+    mutable OffsetDecompressor _offset_decompressor;
+  };
+};
+
+// Iterable that yields the codes of an FSSTSegment's values instead of the decompressed strings.
+using FSSTCompressedValueIterable = FSSTSegmentIterable<pmr_string, std::string_view>;
+
+}  // namespace hyrise
@@ -0,0 +1,241 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+uint8_t first_byte(const uint64_t symbol) {
+  auto byte = uint8_t{0};
+  std::memcpy(&byte, &symbol, 1);
+  return byte;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+FSSTSymbolTable::FSSTSymbolTable(const PolymorphicAllocator<char>& allocator)
+    : _symbols{allocator}, _symbol_lengths{allocator} {}
+
+FSSTSymbolTable::FSSTSymbolTable(const FSSTSymbolTable& other, const PolymorphicAllocator<char>& allocator)
+    : _symbols{other._symbols, allocator},
+      _symbol_lengths{other._symbol_lengths, allocator},
+      _first_code{other._first_code} {}
+
+FSSTSymbolTable::FSSTSymbolTable(pmr_vector<uint64_t> symbols, pmr_vector<uint8_t> symbol_lengths)
+    : _symbols{std::move(symbols)}, _symbol_lengths{std::move(symbol_lengths)} {
+  Assert(_symbols.size() == _symbol_lengths.size(), "Expected one length per symbol.");
+  Assert(_symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols.");
+  Assert(std::ranges::all_of(_symbol_lengths,
+                             [](const auto length) {
+                               return length >= 1 && length <= MAX_SYMBOL_LENGTH;
+                             }),
+         "Symbols have to be between one and eight bytes long.");
+  _build_index();
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& strings,
+                                       const PolymorphicAllocator<char>& allocator) {
+  auto total_size = size_t{0};
+  for (const auto& string : strings) {
+    total_size += string.size();
+  }
+
+  auto symbol_table = FSSTSymbolTable{allocator};
+  if (total_size == 0) {
+    return symbol_table;
+  }
+
+  // Take every n-th string, so that the sample is spread over the whole input.
+  const auto stride = std::max(size_t{1}, total_size / SAMPLE_SIZE);
+  auto sample = std::vector<std::string_view>{};
+  sample.reserve(strings.size() / stride + 1);
+  for (auto index = size_t{0}; index < strings.size(); index += stride) {
+    sample.emplace_back(strings[index]);
+  }
+
+  // All candidates are substrings of the sampled strings. Thus, they can be referenced as string_views.
+  auto gains = std::unordered_map<std::string_view, size_t>{};
+  auto candidates = std::vector<std::pair<std::string_view, size_t>>{};
+
+  for (auto generation = size_t{0}; generation < GENERATION_COUNT; ++generation) {
+    gains.clear();
+    for (const auto& string : sample) {
+      const auto size = string.size();
+      auto previous_start = size_t{0};
+      auto previous_length = size_t{0};
+      auto position = size_t{0};
+      while (position < size) {
+        const auto code = symbol_table._find_longest_symbol(string, position);
+        const auto length = code == ESCAPE_CODE ? size_t{1} : size_t{symbol_table._symbol_lengths[code]};
+
+        // The gain of a symbol is the number of bytes that it covers in the sample.
+        gains[string.substr(position, length)] += length;
+        if (length > 1) {
+          // Keep the single byte in the race, so that the following generations can still combine it differently.
+          gains[string.substr(position, 1)] += 1;
+        }
+
+        if (previous_length > 0 && previous_length < MAX_SYMBOL_LENGTH) {
+          const auto concatenation_length = std::min(previous_length + length, MAX_SYMBOL_LENGTH);
+          gains[string.substr(previous_start, concatenation_length)] += concatenation_length;
+        }
+
+        previous_start = position;
+        previous_length = length;
+        position += length;
+      }
+    }
+
+    // Pick the candidates with the highest gains. Ties are broken by the candidates themselves to make the table
+    // deterministic.
+    candidates.assign(gains.cbegin(), gains.cend());
+    const auto symbol_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(symbol_count),
+                      candidates.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.second > rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
+                      });
+    candidates.resize(symbol_count);
+
+    std::ranges::sort(candidates, [](const auto& lhs, const auto& rhs) {
+      if (lhs.first.front() != rhs.first.front()) {
+        return static_cast<uint8_t>(lhs.first.front()) < static_cast<uint8_t>(rhs.first.front());
+      }
+      if (lhs.first.size() != rhs.first.size()) {
+        return lhs.first.size() > rhs.first.size();
+      }
+      return lhs.first < rhs.first;
+    });
+
+    symbol_table._symbols.clear();
+    symbol_table._symbol_lengths.clear();
+    for (const auto& [candidate, gain] : candidates) {
+      auto symbol = uint64_t{0};
+      std::memcpy(&symbol, candidate.data(), candidate.size());
+      symbol_table._symbols.emplace_back(symbol);
+      symbol_table._symbol_lengths.emplace_back(static_cast<uint8_t>(candidate.size()));
+    }
+    symbol_table._build_index();
+  }
+
+  symbol_table._symbols.shrink_to_fit();
+  symbol_table._symbol_lengths.shrink_to_fit();
+  return symbol_table;
+}
+
+pmr_string FSSTSymbolTable::decode(const std::string_view codes) const {
+  // Each code produces at most MAX_SYMBOL_LENGTH bytes. By allocating these upfront, every symbol can be copied as a
+  // whole word, independent of its length.
+  auto string = pmr_string(codes.size() * MAX_SYMBOL_LENGTH, '\0');
+  auto size = size_t{0};
+
+  const auto code_count = codes.size();
+  for (auto index = size_t{0}; index < code_count; ++index) {
+    const auto code = static_cast<uint8_t>(codes[index]);
+    if (code == ESCAPE_CODE) {
+      ++index;
+      DebugAssert(index < code_count, "Escape code is not followed by a byte.");
+      string[size] = codes[index];
+      ++size;
+      continue;
+    }
+
+    DebugAssert(code < _symbols.size(), "Invalid code.");
+    std::memcpy(string.data() + size, &_symbols[code], sizeof(uint64_t));
+    size += _symbol_lengths[code];
+  }
+
+  string.resize(size);
+  return string;
+}
+
+bool FSSTSymbolTable::decoded_starts_with(const std::string_view codes, const std::string_view prefix) const {
+  const auto prefix_size = prefix.size();
+  const auto code_count = codes.size();
+  auto position = size_t{0};
+  for (auto index = size_t{0}; index < code_count && position < prefix_size; ++index) {
+    const auto code = static_cast<uint8_t>(codes[index]);
+    if (code == ESCAPE_CODE) {
+      ++index;
+      DebugAssert(index < code_count, "Escape code is not followed by a byte.");
+      if (codes[index] != prefix[position]) {
+        return false;
+      }
+      ++position;
+      continue;
+    }
+
+    const auto length = std::min(size_t{_symbol_lengths[code]}, prefix_size - position);
+    if (std::memcmp(&_symbols[code], prefix.data() + position, length) != 0) {
+      return false;
+    }
+    position += length;
+  }
+
+  return position == prefix_size;
+}
+
+size_t FSSTSymbolTable::symbol_count() const {
+  return _symbols.size();
+}
+
+const pmr_vector<uint64_t>& FSSTSymbolTable::symbols() const {
+  return _symbols;
+}
+
+const pmr_vector<uint8_t>& FSSTSymbolTable::symbol_lengths() const {
+  return _symbol_lengths;
+}
+
+size_t FSSTSymbolTable::data_size() const {
+  return _symbols.capacity() * sizeof(uint64_t) + _symbol_lengths.capacity();
+}
+
+void FSSTSymbolTable::_build_index() {
+  const auto symbol_count = _symbols.size();
+  for (auto code = size_t{1}; code < symbol_count; ++code) {
+    const auto previous_first_byte = first_byte(_symbols[code - 1]);
+    const auto current_first_byte = first_byte(_symbols[code]);
+    Assert(previous_first_byte < current_first_byte ||
+               (previous_first_byte == current_first_byte && _symbol_lengths[code - 1] >= _symbol_lengths[code]),
+           "Symbols have to be sorted by their first byte and their length.");
+  }
+
+  auto symbol_counts = std::array<uint16_t, 256>{};
+  for (const auto symbol : _symbols) {
+    ++symbol_counts[first_byte(symbol)];
+  }
+
+  _first_code[0] = 0;
+  for (auto byte = size_t{0}; byte < symbol_counts.size(); ++byte) {
+    _first_code[byte + 1] = static_cast<uint16_t>(_first_code[byte] + symbol_counts[byte]);
+  }
+}
+
+uint8_t FSSTSymbolTable::_find_longest_symbol(const std::string_view string, const size_t position) const {
+  const auto byte = static_cast<uint8_t>(string[position]);
+  const auto remaining_size = string.size() - position;
+  const auto last_code = _first_code[byte + 1];
+  for (auto code = _first_code[byte]; code < last_code; ++code) {
+    const auto length = _symbol_lengths[code];
+    if (length <= remaining_size && std::memcmp(&_symbols[code], string.data() + position, length) == 0) {
+      return static_cast<uint8_t>(code);
+    }
+  }
+  return ESCAPE_CODE;
+}
+
+}  // namespace hyrise
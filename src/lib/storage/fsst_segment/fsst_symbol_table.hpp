@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Symbol table of the Fast Static Symbol Table (FSST) string compression (Boncz et al., "FSST: Fast Random Access
+ * String Compression", VLDB 2020). A symbol table maps up to 255 one-byte codes to symbols of one to eight bytes.
+ * Strings are compressed by replacing the longest symbol that matches at the current position with its code. Bytes
+ * that do not start any symbol are stored as an escape code followed by the byte itself.
+ *
+ * As every string is encoded independently of all other strings, a single string can be decompressed without
+ * touching its neighbors. This makes FSST usable for random accesses (e.g., to materialize a position list) and for
+ * the dictionaries of dictionary-encoded segments, where each distinct value is compressed on its own. Furthermore,
+ * the encoding of a string is deterministic: two strings are equal if and only if their codes are equal.
+ *
+ * Codes are handled as std::string_view, so that they can be compared and hashed with the standard facilities.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // Number of sampled bytes that the symbol table is built from.
+  static constexpr auto SAMPLE_SIZE = size_t{16'384};
+
+  // Number of iterations in which the symbols are refined.
+  static constexpr auto GENERATION_COUNT = size_t{5};
+
+  // Creates an empty symbol table, which escapes every byte.
+  explicit FSSTSymbolTable(const PolymorphicAllocator<char>& allocator = {});
+
+  // Copies the symbols of another table, e.g., to migrate them to another memory resource.
+  FSSTSymbolTable(const FSSTSymbolTable& other, const PolymorphicAllocator<char>& allocator);
+
+  // Creates a table from existing symbols. Each symbol is stored as up to eight bytes in an uint64_t. The symbols have
+  // to be sorted by their first byte and, for the same first byte, by their length in descending order.
+  FSSTSymbolTable(pmr_vector<uint64_t> symbols, pmr_vector<uint8_t> symbol_lengths);
+
+  /**
+   * Builds a symbol table for the given strings. If they exceed SAMPLE_SIZE, a sample of evenly spread strings is used.
+   * In each generation, the sample is encoded with the current table. Then, the symbols and the concatenations of
+   * adjacent symbols that save the most bytes (i.e., occurrences * length) form the table of the next generation.
+   */
+  static FSSTSymbolTable build(const std::vector<std::string_view>& strings,
+                               const PolymorphicAllocator<char>& allocator = {});
+
+  // Appends the codes of the given string to `codes` (e.g., a pmr_vector<char> or a std::string).
+  template <typename Codes>
+  void encode(const std::string_view string, Codes& codes) const {
+    const auto size = string.size();
+    auto position = size_t{0};
+    while (position < size) {
+      const auto code = _find_longest_symbol(string, position);
+      codes.push_back(static_cast<char>(code));
+      if (code == ESCAPE_CODE) {
+        codes.push_back(string[position]);
+        ++position;
+      } else {
+        position += _symbol_lengths[code];
+      }
+    }
+  }
+
+  // Decompresses a single string.
+  pmr_string decode(const std::string_view codes) const;
+
+  // Returns whether the string encoded by the codes starts with `prefix`. Only the symbols that cover the prefix are
+  // decompressed.
+  bool decoded_starts_with(const std::string_view codes, const std::string_view prefix) const;
+
+  size_t symbol_count() const;
+  const pmr_vector<uint64_t>& symbols() const;
+  const pmr_vector<uint8_t>& symbol_lengths() const;
+
+  // Returns the number of bytes allocated for the symbols.
+  size_t data_size() const;
+
+ protected:
+  // Sets _first_code, which stores the range of codes whose symbols start with a given byte.
+  void _build_index();
+
+  // Returns the code of the longest symbol that starts at `string[position]`, or ESCAPE_CODE if there is none.
+  uint8_t _find_longest_symbol(const std::string_view string, const size_t position) const;
+
+  pmr_vector<uint64_t> _symbols;
+  pmr_vector<uint8_t> _symbol_lengths;
+
+  // The codes of the symbols starting with byte b are in [_first_code[b], _first_code[b + 1]).
+  std::array<uint16_t, 257> _first_code{};
+};
+
+}  // namespace hyrise
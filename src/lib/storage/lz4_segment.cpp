@@ -1,8 +1,10 @@
 #include "lz4_segment.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -436,6 +438,42 @@ T LZ4Segment<T>::decompress(const ChunkOffset& chunk_offset) const {
   return decompress(chunk_offset, std::nullopt, decompressed_block).first;
 }
 
+template <typename T>
+void LZ4Segment<T>::decompress(const ChunkOffset begin, const size_t count, T* values) const {
+  DebugAssert(begin + count <= _num_elements, "Range exceeds the segment.");
+
+  // Values are not split across blocks, so every block but the last one holds the same number of values.
+  const auto values_per_block = _block_size / sizeof(T);
+  auto decompressed_block = std::vector<char>(_block_size);
+
+  auto index = size_t{0};
+  while (index < count) {
+    const auto chunk_offset = begin + index;
+    const auto block_index = chunk_offset / values_per_block;
+    const auto offset_in_block = chunk_offset % values_per_block;
+    const auto value_count = std::min(values_per_block - offset_in_block, count - index);
+
+    _decompress_block_to_bytes(block_index, decompressed_block);
+    std::memcpy(values + index, decompressed_block.data() + (offset_in_block * sizeof(T)), value_count * sizeof(T));
+    index += value_count;
+  }
+}
+
+template <>
+void LZ4Segment<pmr_string>::decompress(const ChunkOffset begin, const size_t count, pmr_string* values) const {
+  DebugAssert(begin + count <= _num_elements, "Range exceeds the segment.");
+
+  // Strings may span multiple blocks. We decompress them one by one, but keep the last block cached.
+  auto cached_block = std::vector<char>{};
+  auto cached_block_index = std::optional<size_t>{};
+  for (auto index = size_t{0}; index < count; ++index) {
+    auto [value, block_index] =
+        decompress(static_cast<ChunkOffset>(begin + index), cached_block_index, cached_block);  // NOLINT
+    values[index] = std::move(value);
+    cached_block_index = block_index;
+  }
+}
+
 template <typename T>
 std::shared_ptr<AbstractSegment> LZ4Segment<T>::copy_using_memory_resource(MemoryResource& memory_resource) const {
   auto new_lz4_blocks = pmr_vector<pmr_vector<char>>{&memory_resource};
@@ -155,6 +155,16 @@ class LZ4Segment : public AbstractEncodedSegment {
   std::pair<T, size_t> decompress(const ChunkOffset& chunk_offset, const std::optional<size_t> cached_block_index,
                                   std::vector<char>& cached_block) const;
 
+  /**
+   * Decompresses the values [begin, begin + count) into `values`. Each block that overlaps with the range is
+   * decompressed only once and its values are copied en bloc.
+   *
+   * @param begin The chunk offset of the first value.
+   * @param count The number of values.
+   * @param values Array with room for `count` values.
+   */
+  void decompress(const ChunkOffset begin, const size_t count, T* values) const;
+
   std::shared_ptr<AbstractSegment> copy_using_memory_resource(MemoryResource& memory_resource) const final;
 
   size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
@@ -225,6 +235,8 @@ std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffs
                                                                  const std::optional<size_t> cached_block_index,
                                                                  std::vector<char>&) const;
 template <>
+void LZ4Segment<pmr_string>::decompress(const ChunkOffset begin, const size_t count, pmr_string* values) const;
+template <>
 std::optional<CompressedVectorType> LZ4Segment<pmr_string>::compressed_vector_type() const;
 
 EXPLICITLY_DECLARE_DATA_TYPES(LZ4Segment);
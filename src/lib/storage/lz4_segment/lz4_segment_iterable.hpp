@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -87,6 +89,19 @@ class LZ4SegmentIterable : public PointAccessibleSegmentIterable<LZ4SegmentItera
     return _segment.size();
   }
 
+  // Only decompresses the LZ4 blocks that overlap with the range (see LZ4Segment::decompress).
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* nulls) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += count;
+    _segment.decompress(begin, count, values);
+
+    const auto& null_values = _segment.null_values();
+    if (null_values) {
+      std::copy_n(null_values->cbegin() + static_cast<std::ptrdiff_t>(begin), count, nulls);
+    } else {
+      std::fill_n(nulls, count, false);
+    }
+  }
+
  private:
   const LZ4Segment<T>& _segment;
   mutable std::vector<char> cached_block;
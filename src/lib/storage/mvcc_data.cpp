@@ -1,14 +1,35 @@
 #include "mvcc_data.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <ostream>
+#include <shared_mutex>
+#include <vector>
 
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/copyable_atomic.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+constexpr auto BITS_PER_WORD = size_t{64};
+
+size_t bitmap_word_count(const ChunkOffset row_count) {
+  return (static_cast<size_t>(row_count) + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+uint64_t bitmap_mask(const ChunkOffset offset) {
+  return uint64_t{1} << (static_cast<size_t>(offset) % BITS_PER_WORD);
+}
+
+}  // namespace
+
 namespace hyrise {
 
 MvccData::MvccData(const size_t size, CommitID begin_commit_id) {
@@ -26,6 +47,17 @@ std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
   }
   stream << '\n';
 
+  const auto lock = std::shared_lock<std::shared_mutex>{mvcc_data._compaction_mutex};
+  if (mvcc_data._layout.load() == MvccData::Layout::Compacted) {
+    stream << "BeginCID of all rows: " << mvcc_data._compacted_begin_cid << '\n';
+    stream << "EndCIDs of invalidated rows: ";
+    for (const auto& [offset, end_cid] : mvcc_data._invalidated_row_end_cids) {
+      stream << offset << ": " << end_cid << ", ";
+    }
+    stream << '\n';
+    return stream;
+  }
+
   stream << "BeginCIDs: ";
   for (const auto& begin_cid : mvcc_data._begin_cids) {
     stream << begin_cid << ", ";
@@ -42,24 +74,54 @@ std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
 }
 
 CommitID MvccData::get_begin_cid(const ChunkOffset offset) const {
-  DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  if (_layout.load() == Layout::Compacted) {
+    return _compacted_begin_cid;
+  }
   return _begin_cids[offset];
 }
 
 void MvccData::set_begin_cid(const ChunkOffset offset, const CommitID commit_id, const std::memory_order memory_order) {
   DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(_layout.load() == Layout::RowVersions, "Cannot set begin CIDs of compacted MVCC data.");
   _begin_cids[offset] = commit_id;
   _begin_cids[offset].store(commit_id, memory_order);
 }
 
 CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
-  DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  return _end_cids[offset];
+  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  if (_layout.load() != Layout::Compacted) {
+    return _end_cids[offset];
+  }
+
+  const auto lock = std::shared_lock<std::shared_mutex>{_compaction_mutex};
+  if ((_invalidated_rows[offset / BITS_PER_WORD] & bitmap_mask(offset)) == 0) {
+    return MAX_COMMIT_ID;
+  }
+
+  const auto iter = std::ranges::lower_bound(_invalidated_row_end_cids, offset, {},
+                                             &std::pair<ChunkOffset, CommitID>::first);
+  if (iter == _invalidated_row_end_cids.end() || iter->first != offset) {
+    DebugAssert(_collected_end_cid != UNSET_COMMIT_ID, "Invalidated row has no end CID.");
+    return _collected_end_cid;
+  }
+  return iter->second;
 }
 
 void MvccData::set_end_cid(const ChunkOffset offset, const CommitID commit_id, const std::memory_order memory_order) {
-  DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  _end_cids[offset].store(commit_id, memory_order);
+  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  // As long as the row versions might be read, we write to them first. If the layout was still RowVersions after the
+  // write, a concurrent compaction (which switches the layout before copying the end CIDs) will see the end CID.
+  // Otherwise, we write it to the compact representation, too.
+  if (_layout.load() != Layout::Compacted) {
+    _end_cids[offset].store(commit_id, memory_order);
+    if (_layout.load() == Layout::RowVersions) {
+      return;
+    }
+  }
+
+  const auto lock = std::unique_lock<std::shared_mutex>{_compaction_mutex};
+  _set_invalidated_row(offset, commit_id);
 }
 
 TransactionID MvccData::get_tid(const ChunkOffset offset) const {
@@ -81,13 +143,158 @@ bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expe
 }
 
 size_t MvccData::memory_usage() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_compaction_mutex};
   auto bytes = sizeof(*this);
   bytes += _tids.capacity() * sizeof(decltype(_tids)::value_type);
   bytes += _begin_cids.capacity() * sizeof(decltype(_begin_cids)::value_type);
   bytes += _end_cids.capacity() * sizeof(decltype(_end_cids)::value_type);
+  bytes += _invalidated_rows.capacity() * sizeof(decltype(_invalidated_rows)::value_type);
+  bytes += _invalidated_row_end_cids.capacity() * sizeof(decltype(_invalidated_row_end_cids)::value_type);
   return bytes;
 }
 
+bool MvccData::try_compact(const ChunkOffset row_count) {
+  DebugAssert(row_count <= _tids.size(), "row_count out of bounds; MvccData insufficently preallocated?");
+  const auto lock = std::unique_lock<std::shared_mutex>{_compaction_mutex};
+  const auto compacted_begin_cid = max_begin_cid.load();
+  if (_layout.load() != Layout::RowVersions || compacted_begin_cid == MAX_COMMIT_ID) {
+    return false;
+  }
+
+  // From now on, committing Deletes write their end CIDs to the compact representation as well. They wait for the lock
+  // until we are done.
+  _layout = Layout::Compacting;
+  _invalidated_rows.assign(bitmap_word_count(row_count), 0);
+  _invalidated_row_end_cids.clear();
+
+  for (auto offset = ChunkOffset{0}; offset < row_count; ++offset) {
+    if (_begin_cids[offset].load() == MAX_COMMIT_ID) {
+      if (_tids[offset].load() != INVALID_TRANSACTION_ID) {
+        // The row has been inserted but not yet committed.
+        _invalidated_rows.clear();
+        _invalidated_row_end_cids.clear();
+        _layout = Layout::RowVersions;
+        return false;
+      }
+
+      // The insert of the row was rolled back. The row is visible for no one.
+      _set_invalidated_row(offset, UNSET_COMMIT_ID);
+      continue;
+    }
+
+    const auto end_cid = _end_cids[offset].load();
+    if (end_cid != MAX_COMMIT_ID) {
+      _set_invalidated_row(offset, end_cid);
+    }
+  }
+
+  _compacted_begin_cid = compacted_begin_cid;
+  _layout = Layout::Compacted;
+  return true;
+}
+
+bool MvccData::is_compacted() const {
+  return _layout.load() == Layout::Compacted;
+}
+
+void MvccData::release_row_versions() {
+  Assert(is_compacted(), "Only the row versions of compacted MVCC data can be released.");
+  const auto lock = std::unique_lock<std::shared_mutex>{_compaction_mutex};
+  _begin_cids.clear();
+  _begin_cids.shrink_to_fit();
+  _end_cids.clear();
+  _end_cids.shrink_to_fit();
+  _row_versions_released = true;
+}
+
+bool MvccData::has_row_versions() const {
+  return !_row_versions_released.load();
+}
+
+std::vector<uint64_t> MvccData::visible_rows(const CommitID snapshot_commit_id, const ChunkOffset row_count) const {
+  DebugAssert(is_compacted(), "Visibility bitmaps are only available for compacted MVCC data.");
+  const auto word_count = bitmap_word_count(row_count);
+  auto visible_rows = std::vector<uint64_t>(word_count);
+
+  const auto lock = std::shared_lock<std::shared_mutex>{_compaction_mutex};
+  DebugAssert(word_count <= _invalidated_rows.size(), "row_count exceeds the compacted rows.");
+  // Compaction expects no such snapshot to be active anymore. Without the begin CIDs, we cannot tell which rows are
+  // visible for it.
+  Assert(snapshot_commit_id >= _compacted_begin_cid, "Snapshot is older than the compacted MVCC data.");
+  DebugAssert(snapshot_commit_id >= _collected_end_cid, "Snapshot is older than the garbage collection horizon.");
+
+  // Word-wise negation, which the compiler vectorizes.
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    visible_rows[word_index] = ~_invalidated_rows[word_index];
+  }
+
+  // Rows that were invalidated after the snapshot are still visible.
+  for (const auto& [offset, end_cid] : _invalidated_row_end_cids) {
+    if (snapshot_commit_id < end_cid && offset < row_count) {
+      visible_rows[offset / BITS_PER_WORD] |= bitmap_mask(offset);
+    }
+  }
+
+  if (row_count % BITS_PER_WORD != 0) {
+    visible_rows.back() &= bitmap_mask(row_count) - 1;
+  }
+
+  return visible_rows;
+}
+
+ChunkOffset MvccData::dead_row_count(const CommitID horizon_commit_id, const ChunkOffset row_count) const {
+  auto dead_row_count = ChunkOffset{0};
+  if (_layout.load() == Layout::Compacted) {
+    const auto lock = std::shared_lock<std::shared_mutex>{_compaction_mutex};
+    // All invalidated rows are dead unless their end CID is newer than the horizon.
+    for (const auto word : _invalidated_rows) {
+      dead_row_count += std::popcount(word);
+    }
+    for (const auto& [offset, end_cid] : _invalidated_row_end_cids) {
+      if (end_cid > horizon_commit_id) {
+        --dead_row_count;
+      }
+    }
+    return dead_row_count;
+  }
+
+  DebugAssert(row_count <= _tids.size(), "row_count out of bounds; MvccData insufficently preallocated?");
+  for (auto offset = ChunkOffset{0}; offset < row_count; ++offset) {
+    const auto is_rolled_back_insert =
+        _begin_cids[offset].load() == MAX_COMMIT_ID && _tids[offset].load() == INVALID_TRANSACTION_ID;
+    if (_end_cids[offset].load() <= horizon_commit_id || is_rolled_back_insert) {
+      ++dead_row_count;
+    }
+  }
+  return dead_row_count;
+}
+
+size_t MvccData::collect_garbage(const CommitID horizon_commit_id) {
+  Assert(is_compacted(), "Only the end CIDs of compacted MVCC data can be garbage collected.");
+  const auto lock = std::unique_lock<std::shared_mutex>{_compaction_mutex};
+  const auto collected_count = std::erase_if(_invalidated_row_end_cids, [&](const auto& invalidated_row) {
+    return invalidated_row.second <= horizon_commit_id;
+  });
+
+  if (collected_count > 0) {
+    _invalidated_row_end_cids.shrink_to_fit();
+    _collected_end_cid = std::max(_collected_end_cid, horizon_commit_id);
+  }
+  return collected_count;
+}
+
+void MvccData::_set_invalidated_row(const ChunkOffset offset, const CommitID end_commit_id) {
+  DebugAssert(offset / BITS_PER_WORD < _invalidated_rows.size(), "Row has not been compacted.");
+  const auto iter = std::ranges::lower_bound(_invalidated_row_end_cids, offset, {},
+                                             &std::pair<ChunkOffset, CommitID>::first);
+  if (iter != _invalidated_row_end_cids.end() && iter->first == offset) {
+    iter->second = end_commit_id;
+  } else {
+    _invalidated_row_end_cids.emplace(iter, offset, end_commit_id);
+  }
+  _invalidated_rows[offset / BITS_PER_WORD] |= bitmap_mask(offset);
+}
+
 void MvccData::register_insert() {
   ++_pending_inserts;
 }
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <limits>
 #include <shared_mutex>
+#include <utility>
+#include <vector>
 
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
@@ -11,6 +14,21 @@ namespace hyrise {
 
 /**
  * Stores visibility information for multiversion concurrency control.
+ *
+ * By default, the begin CID, end CID, and TID of each row are stored (row versions). Once all rows of an immutable
+ * chunk have been committed before the lowest active snapshot, every current and future transaction sees all of its
+ * inserts and the begin CIDs carry no information anymore. Furthermore, most rows of old chunks have never been
+ * deleted. Such MVCC data can be compacted: the invalidated rows are stored as a bitmap with one bit per row, and
+ * their end CIDs in a list sorted by chunk offset. The TIDs are kept since the Delete operator uses them as row locks.
+ *
+ * Compaction happens in two steps. try_compact() switches all readers and writers to the compact representation.
+ * Threads that loaded the layout before may still read the row versions, which remain valid for their snapshot. Once
+ * all transactions that were active during the compaction have finished, release_row_versions() frees the begin and
+ * end CID vectors.
+ *
+ * Rows invalidated before the lowest active snapshot are dead: no current or future transaction can see them.
+ * dead_row_count() tells the MvccDeletePlugin whether rewriting the chunk without them pays off. For compacted MVCC
+ * data, collect_garbage() additionally drops the end CIDs of dead rows, for which the bit in the bitmap suffices.
  */
 struct MvccData {
   friend class Chunk;
@@ -42,6 +60,40 @@ struct MvccData {
 
   size_t memory_usage() const;
 
+  /**
+   * Switches to the compact representation if all `row_count` rows are either committed or rolled back. Expects the
+   * chunk to be immutable and `max_begin_cid` to be older than any active snapshot, which is checked by the caller.
+   * Returns false if the data is already compacted or a row is still locked by an uncommitted insert.
+   */
+  bool try_compact(const ChunkOffset row_count);
+  bool is_compacted() const;
+
+  // Frees the begin and end CID vectors of compacted MVCC data. Must only be called when no transaction that was
+  // active during the compaction is left.
+  void release_row_versions();
+  bool has_row_versions() const;
+
+  /**
+   * For compacted MVCC data: returns a bitmap with one bit per row (least significant bit first), in which the rows
+   * that are visible for the given snapshot are set. As with the chunk shortcut in Validate, rows locked by the
+   * transaction's own Delete operators are not considered.
+   */
+  std::vector<uint64_t> visible_rows(const CommitID snapshot_commit_id, const ChunkOffset row_count) const;
+
+  /**
+   * Returns the number of rows among the first `row_count` rows that are invisible to all snapshots from
+   * `horizon_commit_id` on, i.e., rows that were deleted up to that CommitID or whose insert was rolled back. Expects
+   * the chunk to be immutable.
+   */
+  ChunkOffset dead_row_count(const CommitID horizon_commit_id, const ChunkOffset row_count) const;
+
+  /**
+   * For compacted MVCC data: frees the end CIDs of rows that were invalidated up to `horizon_commit_id`. Afterwards,
+   * snapshots older than the horizon cannot be served anymore, so it must not be newer than the lowest active
+   * snapshot. Returns the number of freed end CIDs.
+   */
+  size_t collect_garbage(const CommitID horizon_commit_id);
+
   // Register and deregister Insert operators that write to the chunk. We use this information to notice when all
   // Inserts are either committed or rolled back and if we can mark a chunk as immutable. For more details, see
   // `chunk.hpp`. `deregister_insert()` returns the number of Insert operators that are still active.
@@ -50,12 +102,28 @@ struct MvccData {
   uint32_t pending_inserts() const;
 
  private:
+  enum class Layout : uint8_t { RowVersions, Compacting, Compacted };
+
+  // Marks the row as invalidated in the compact representation. Requires `_compaction_mutex` to be locked.
+  void _set_invalidated_row(const ChunkOffset offset, const CommitID end_commit_id);
+
   // These vectors are pre-allocated. Do not resize them as someone might be reading them concurrently.
   pmr_vector<copyable_atomic<CommitID>> _begin_cids;  // < CommitID when record was added
   pmr_vector<copyable_atomic<CommitID>> _end_cids;    // < CommitID when record was deleted
   pmr_vector<copyable_atomic<TransactionID>> _tids;   // < 0 unless locked by a transaction
 
   std::atomic_uint32_t _pending_inserts{0};
+
+  // Compact representation. Writes during compaction (i.e., Deletes that commit concurrently) go to both
+  // representations. See set_end_cid().
+  std::atomic<Layout> _layout{Layout::RowVersions};
+  std::atomic_bool _row_versions_released{false};
+  CommitID _compacted_begin_cid{MAX_COMMIT_ID};
+  // Reported as end CID for invalidated rows whose end CID has been freed by collect_garbage().
+  CommitID _collected_end_cid{UNSET_COMMIT_ID};
+  pmr_vector<uint64_t> _invalidated_rows;
+  pmr_vector<std::pair<ChunkOffset, CommitID>> _invalidated_row_end_cids;
+  mutable std::shared_mutex _compaction_mutex;
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
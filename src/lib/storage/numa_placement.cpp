@@ -0,0 +1,86 @@
+#include "numa_placement.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "memory/numa_memory_resource.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+NodeID numa_node_for_chunk(const ChunkID chunk_id) {
+  auto node_ids = std::vector<NodeID>{};
+  const auto& nodes = Hyrise::get().topology.nodes();
+  const auto node_count = static_cast<NodeID::base_type>(nodes.size());
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    if (!nodes[node_id].cpus.empty()) {
+      node_ids.emplace_back(node_id);
+    }
+  }
+
+  if (node_ids.size() < 2) {
+    return INVALID_NODE_ID;
+  }
+
+  return node_ids[chunk_id % node_ids.size()];
+}
+
+void place_chunk_on_numa_node(Table& table, const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  if (!chunk) {
+    return;
+  }
+
+  Assert(!chunk->is_mutable(), "Mutable chunks cannot be placed on a NUMA node.");
+  const auto node_id = numa_node_for_chunk(chunk_id);
+  if (node_id == INVALID_NODE_ID || chunk->node_id() == node_id) {
+    return;
+  }
+
+  if (NumaMemoryResource::is_numa_available() && table.chunk_indexes_statistics().empty()) {
+    chunk->migrate(NumaMemoryResource::get(node_id));
+  }
+  chunk->set_node_id(node_id);
+}
+
+void place_table_on_numa_nodes(Table& table) {
+  if (table.type() != TableType::Data) {
+    return;
+  }
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk && !chunk->is_mutable()) {
+      place_chunk_on_numa_node(table, chunk_id);
+    }
+  }
+}
+
+NodeID numa_node_of_chunk(const Chunk& chunk) {
+  const auto node_id = chunk.node_id();
+  if (node_id != INVALID_NODE_ID || chunk.column_count() == 0) {
+    return node_id;
+  }
+
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+  if (!reference_segment) {
+    return INVALID_NODE_ID;
+  }
+
+  const auto& pos_list = reference_segment->pos_list();
+  if (pos_list->empty() || !pos_list->references_single_chunk()) {
+    return INVALID_NODE_ID;
+  }
+
+  const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list->common_chunk_id());
+  return referenced_chunk ? referenced_chunk->node_id() : INVALID_NODE_ID;
+}
+
+}  // namespace hyrise
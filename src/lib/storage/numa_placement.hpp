@@ -0,0 +1,45 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+
+/**
+ * NUMA-aware placement of stored chunks. When tables are loaded or chunks are compressed, the immutable chunks of a
+ * table are distributed round-robin across the nodes of the topology that have workers. Their segments are migrated
+ * to memory of that node (see NumaMemoryResource), and the node is recorded in the chunk. Chunk-parallel operators
+ * (e.g., TableScan, Validate, and the materialization of the JoinHash) schedule the jobs for a chunk on its node (see
+ * MorselDispatcher), so that workers mostly read node-local memory. Idle workers of other nodes can still steal these
+ * jobs.
+ *
+ * With a single node, chunks are not placed. On systems without NUMA support (e.g., with fake NUMA topologies), chunks
+ * are assigned to nodes, but their segments are not migrated.
+ */
+
+/**
+ * Returns the node for the chunk with the given ID or INVALID_NODE_ID if the topology has a single node.
+ */
+NodeID numa_node_for_chunk(const ChunkID chunk_id);
+
+/**
+ * Places the immutable chunk of the table on the node returned by numa_node_for_chunk(). Chunks that are already placed
+ * on that node are skipped. As chunk indexes refer to the segments they index, chunks of tables with chunk indexes are
+ * only assigned to the node, but not migrated.
+ */
+void place_chunk_on_numa_node(Table& table, const ChunkID chunk_id);
+
+/**
+ * Places all immutable chunks of the table.
+ */
+void place_table_on_numa_nodes(Table& table);
+
+/**
+ * Returns the node of the chunk's data. For chunks of ReferenceSegments that reference a single chunk, this is the
+ * node of the referenced chunk. Otherwise, INVALID_NODE_ID is returned.
+ */
+NodeID numa_node_of_chunk(const Chunk& chunk);
+
+}  // namespace hyrise
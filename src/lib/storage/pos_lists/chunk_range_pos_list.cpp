@@ -0,0 +1,54 @@
+#include "chunk_range_pos_list.hpp"
+
+#include <cstddef>
+
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+bool ChunkRangePosList::references_single_chunk() const {
+  return true;
+}
+
+ChunkID ChunkRangePosList::common_chunk_id() const {
+  return _common_chunk_id;
+}
+
+bool ChunkRangePosList::empty() const {
+  return size() == 0;
+}
+
+size_t ChunkRangePosList::size() const {
+  return _end_offset - _begin_offset;
+}
+
+size_t ChunkRangePosList::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  return sizeof *this;
+}
+
+ChunkOffset ChunkRangePosList::begin_offset() const {
+  return _begin_offset;
+}
+
+ChunkOffset ChunkRangePosList::end_offset() const {
+  return _end_offset;
+}
+
+AbstractPosList::PosListIterator<ChunkRangePosList, RowID> ChunkRangePosList::begin() const {
+  return {this, ChunkOffset{0}};
+}
+
+AbstractPosList::PosListIterator<ChunkRangePosList, RowID> ChunkRangePosList::end() const {
+  return {this, static_cast<ChunkOffset>(size())};
+}
+
+AbstractPosList::PosListIterator<ChunkRangePosList, RowID> ChunkRangePosList::cbegin() const {
+  return begin();
+}
+
+AbstractPosList::PosListIterator<ChunkRangePosList, RowID> ChunkRangePosList::cend() const {
+  return end();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "abstract_pos_list.hpp"
+#include "storage/chunk.hpp"
+
+namespace hyrise {
+
+/**
+ * Matches the contiguous range [begin_offset, end_offset) of a chunk. It is used as a position filter to scan only a
+ * part of a large chunk (see AbstractDereferencedColumnTableScanImpl::scan_chunk_range).
+ *
+ * Unlike other position filters, it is not resolved by point accesses: PointAccessibleSegmentIterables iterate over
+ * the range with their sequential iterators. Thus, the iterators report the offsets within the chunk rather than the
+ * positions within the filter.
+ */
+class ChunkRangePosList : public AbstractPosList {
+ public:
+  ChunkRangePosList(const ChunkID common_chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset)
+      : _common_chunk_id(common_chunk_id), _begin_offset(begin_offset), _end_offset(end_offset) {
+    DebugAssert(_common_chunk_id != INVALID_CHUNK_ID, "Cannot create ChunkRangePosList for INVALID_CHUNK_ID.");
+    DebugAssert(_begin_offset <= _end_offset, "Invalid chunk range.");
+  }
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  // Implemented in hpp for performance reasons (to allow inlining).
+  RowID operator[](const size_t index) const final {
+    DebugAssert(index < size(), "Invalid position accessed.");
+    return RowID{_common_chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(_begin_offset + index)}};
+  }
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  ChunkOffset begin_offset() const;
+  ChunkOffset end_offset() const;
+
+  PosListIterator<ChunkRangePosList, RowID> begin() const;
+  PosListIterator<ChunkRangePosList, RowID> end() const;
+  PosListIterator<ChunkRangePosList, RowID> cbegin() const;
+  PosListIterator<ChunkRangePosList, RowID> cend() const;
+
+ private:
+  const ChunkID _common_chunk_id;
+  const ChunkOffset _begin_offset;
+  const ChunkOffset _end_offset;
+};
+
+}  // namespace hyrise
@@ -80,6 +80,12 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
           }
 #endif
 
+#ifdef HYRISE_ERASE_FSST
+          if constexpr (std::is_same_v<SegmentType, FSSTSegment<T>>) {
+            return;
+          }
+#endif
+
           // Always erase LZ4Segment accessors
           if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) {
             return;
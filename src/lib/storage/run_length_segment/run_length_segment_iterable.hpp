@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -46,6 +48,28 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
     return _segment.size();
   }
 
+  // Searches the run of `begin` once and fills the arrays run by run.
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* nulls) const {
+    DebugAssert(begin + count <= _segment.size(), "Block exceeds the segment.");
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += count;
+
+    const auto& run_values = *_segment.values();
+    const auto& run_null_values = *_segment.null_values();
+    const auto& end_positions = *_segment.end_positions();
+
+    const auto end_position_it = std::lower_bound(end_positions.cbegin(), end_positions.cend(), begin);
+    auto run_index = static_cast<size_t>(std::distance(end_positions.cbegin(), end_position_it));
+    auto index = size_t{0};
+    while (index < count) {
+      // End positions are inclusive.
+      const auto run_end = std::min(static_cast<size_t>(end_positions[run_index]) + 1 - begin, count);
+      std::fill(values + index, values + run_end, run_values[run_index]);
+      std::fill(nulls + index, nulls + run_end, static_cast<bool>(run_null_values[run_index]));
+      index = run_end;
+      ++run_index;
+    }
+  }
+
  private:
   const RunLengthSegment<T>& _segment;
 
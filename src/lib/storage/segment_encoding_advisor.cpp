@@ -0,0 +1,447 @@
+#include "segment_encoding_advisor.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Bytes that LZ4 needs to encode a value that already occurred within its block (token and match offset).
+constexpr auto LZ4_MATCH_SIZE = size_t{3};
+
+// Factor by which FSST shrinks the characters of typical text columns (e.g., URLs or descriptions), and the size of a
+// fully populated symbol table (255 symbols of up to eight bytes and their lengths).
+constexpr auto FSST_COMPRESSION_FACTOR = 2.0;
+constexpr auto FSST_SYMBOL_TABLE_SIZE = size_t{255 * 9};
+
+// Decoding costs per row in byte equivalents. They approximate the work beyond reading the encoded bytes, which is
+// already reflected in the estimated segment size.
+constexpr auto FIXED_WIDTH_INTEGER_DECODING_COST = 0.5;
+constexpr auto BIT_PACKING_DECODING_COST = 1.0;
+constexpr auto SIMD_BP128_SEQUENTIAL_DECODING_COST = 0.25;
+constexpr auto FIXED_STRING_DECODING_COST = 0.5;
+constexpr auto RUN_LENGTH_SEQUENTIAL_DECODING_COST = 0.25;
+constexpr auto LZ4_SEQUENTIAL_DECODING_COST = 4.0;
+
+// Accessing a single row of an LZ4 segment requires decompressing the row's block.
+constexpr auto LZ4_RANDOM_ACCESS_DECODING_COST = 256.0;
+
+// FSST decompresses a string symbol by symbol, so that its decoding cost grows with the length of the string.
+constexpr auto FSST_DECODING_COST_PER_BYTE = 0.6;
+
+size_t data_type_size(const DataType data_type) {
+  auto size = size_t{0};
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    size = sizeof(ColumnDataType);
+  });
+  return size;
+}
+
+size_t compressed_vector_size(const size_t size, const uint32_t max_value,
+                              const std::optional<VectorCompressionType> vector_compression_type) {
+  if (vector_compression_type == VectorCompressionType::BitPacking) {
+    const auto bit_width = std::max(size_t{1}, static_cast<size_t>(std::bit_width(max_value)));
+    return (size * bit_width + 7) / 8;
+  }
+
+  if (vector_compression_type == VectorCompressionType::SimdBp128) {
+    // Without statistics per block, every block is assumed to need the bit width of the maximum value. Blocks are
+    // padded to 128 values and additionally store their bit width and start offset.
+    const auto bit_width = static_cast<size_t>(std::bit_width(max_value));
+    const auto block_count = (size + 127) / 128;
+    return block_count * (128 * bit_width / 8 + sizeof(uint8_t) + sizeof(uint32_t));
+  }
+
+  if (max_value <= std::numeric_limits<uint8_t>::max()) {
+    return size;
+  }
+
+  if (max_value <= std::numeric_limits<uint16_t>::max()) {
+    return size * sizeof(uint16_t);
+  }
+
+  return size * sizeof(uint32_t);
+}
+
+uint32_t saturating_cast(const size_t value) {
+  return static_cast<uint32_t>(std::min(value, size_t{std::numeric_limits<uint32_t>::max()}));
+}
+
+bool uses_vector_compression(const EncodingType encoding_type) {
+  return encoding_type != EncodingType::Unencoded && create_encoder(encoding_type)->uses_vector_compression();
+}
+
+// Hash sets used to count the distinct values of a segment, one per data type. advise_chunk_encoding_spec() reuses
+// them for all segments of a chunk, so that their buckets are only allocated once.
+using DistinctValueSets = std::tuple<std::unordered_set<int32_t>, std::unordered_set<int64_t>,
+                                     std::unordered_set<float>, std::unordered_set<double>,
+                                     std::unordered_set<pmr_string>>;
+
+SegmentEncodingStatistics collect_statistics(const std::shared_ptr<const AbstractSegment>& segment,
+                                             const DataType data_type, const bool segment_values_are_unique,
+                                             DistinctValueSets& distinct_value_sets) {
+  Assert(!std::dynamic_pointer_cast<const ReferenceSegment>(segment), "Reference segments cannot be encoded.");
+
+  auto statistics = SegmentEncodingStatistics{};
+  statistics.data_type = data_type;
+  statistics.row_count = segment->size();
+
+  const auto& access_counter = segment->access_counter;
+  statistics.sequential_access_count = access_counter[SegmentAccessCounter::AccessType::Sequential] +
+                                       access_counter[SegmentAccessCounter::AccessType::Monotonic];
+  statistics.random_access_count = access_counter[SegmentAccessCounter::AccessType::Point] +
+                                   access_counter[SegmentAccessCounter::AccessType::Random];
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Strings up to the capacity of the small string buffer are stored inline.
+    [[maybe_unused]] const auto small_string_capacity = pmr_string{}.capacity();
+    const auto heap_bytes = [&](const auto& value) {
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        return value.size() > small_string_capacity ? value.size() + 1 : size_t{0};
+      } else {
+        return size_t{0};
+      }
+    };
+
+    auto& distinct_values = std::get<std::unordered_set<ColumnDataType>>(distinct_value_sets);
+    distinct_values.clear();
+    auto previous_value = ColumnDataType{};
+    auto previous_is_null = false;
+
+    [[maybe_unused]] auto frame_minimum = int64_t{0};
+    [[maybe_unused]] auto frame_maximum = int64_t{0};
+    [[maybe_unused]] auto max_frame_offset = int64_t{0};
+    [[maybe_unused]] auto frame_has_values = false;
+
+    auto chunk_offset = ChunkOffset{0};
+    const auto add_row = [&](const bool is_null, const ColumnDataType& value) {
+      if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
+        if (chunk_offset % FrameOfReferenceSegment<int32_t>::block_size == 0) {
+          frame_has_values = false;
+        }
+      }
+
+      if (is_null) {
+        ++statistics.null_count;
+        if (chunk_offset == ChunkOffset{0} || !previous_is_null) {
+          ++statistics.run_count;
+        }
+        previous_is_null = true;
+        ++chunk_offset;
+        return;
+      }
+
+      if (chunk_offset == ChunkOffset{0} || previous_is_null || value != previous_value) {
+        ++statistics.run_count;
+        previous_value = value;
+      }
+      previous_is_null = false;
+
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        statistics.string_bytes += value.size();
+        statistics.string_heap_bytes += heap_bytes(value);
+        statistics.max_string_length = std::max(statistics.max_string_length, value.size());
+      }
+
+      if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
+        if (!frame_has_values) {
+          frame_minimum = value;
+          frame_maximum = value;
+          frame_has_values = true;
+        }
+        frame_minimum = std::min(frame_minimum, int64_t{value});
+        frame_maximum = std::max(frame_maximum, int64_t{value});
+        max_frame_offset = std::max(max_frame_offset, frame_maximum - frame_minimum);
+      }
+
+      if (!segment_values_are_unique && distinct_values.insert(value).second) {
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          statistics.distinct_string_bytes += value.size();
+          statistics.distinct_string_heap_bytes += heap_bytes(value);
+        }
+      }
+
+      ++chunk_offset;
+    };
+
+    // The iterators record every read in the segment's access counters. The advisor must not add its own reads to the
+    // access history it bases its decision on. Thus, the vectors of ValueSegments (i.e., of segments that are encoded
+    // for the first time) are read directly.
+    if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+      const auto& values = value_segment->values();
+      const auto is_nullable = value_segment->is_nullable();
+      for (auto offset = ChunkOffset{0}; offset < statistics.row_count; ++offset) {
+        add_row(is_nullable && value_segment->null_values()[offset], values[offset]);
+      }
+    } else {
+      // Encoded segments have no common raw accessor. Instead, the sequential access that the iteration records (and
+      // the dictionary accesses of dictionary segments) are removed afterwards.
+      segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+        add_row(position.is_null(), position.is_null() ? ColumnDataType{} : position.value());
+      });
+      const auto read_row_count = uint64_t{statistics.row_count};
+      segment->access_counter[SegmentAccessCounter::AccessType::Sequential] -= read_row_count;
+      if (std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+        segment->access_counter[SegmentAccessCounter::AccessType::Dictionary] -= read_row_count;
+      }
+    }
+
+    statistics.distinct_count = distinct_values.size();
+    if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
+      statistics.max_frame_offset = saturating_cast(static_cast<size_t>(max_frame_offset));
+    }
+  });
+
+  if (segment_values_are_unique) {
+    statistics.distinct_count = statistics.row_count - statistics.null_count;
+    statistics.distinct_string_bytes = statistics.string_bytes;
+    statistics.distinct_string_heap_bytes = statistics.string_heap_bytes;
+  }
+
+  return statistics;
+}
+
+SegmentEncodingSpec advise_spec(const std::shared_ptr<const AbstractSegment>& segment, const DataType data_type,
+                                const bool segment_values_are_unique, DistinctValueSets& distinct_value_sets) {
+  if (segment->size() < MIN_ADVISED_SEGMENT_SIZE) {
+    return auto_select_segment_encoding_spec(data_type, segment_values_are_unique);
+  }
+
+  const auto statistics = collect_statistics(segment, data_type, segment_values_are_unique, distinct_value_sets);
+  return advise_segment_encoding_spec(statistics, segment_values_are_unique);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+SegmentEncodingStatistics collect_segment_encoding_statistics(const std::shared_ptr<const AbstractSegment>& segment,
+                                                              const DataType data_type,
+                                                              const bool segment_values_are_unique) {
+  auto distinct_value_sets = DistinctValueSets{};
+  return collect_statistics(segment, data_type, segment_values_are_unique, distinct_value_sets);
+}
+
+size_t estimate_encoded_segment_size(const SegmentEncodingStatistics& statistics,
+                                     const SegmentEncodingSpec& encoding_spec) {
+  const auto row_count = static_cast<size_t>(statistics.row_count);
+  const auto null_count = static_cast<size_t>(statistics.null_count);
+  const auto value_size = data_type_size(statistics.data_type);
+  const auto null_vector_size = null_count > 0 ? (row_count + 7) / 8 : size_t{0};
+  const auto vector_compression_type = encoding_spec.vector_compression_type;
+
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      return row_count * value_size + statistics.string_heap_bytes + null_vector_size;
+
+    case EncodingType::Dictionary:
+      // The attribute vector stores the NULL value id, which equals the dictionary size.
+      return statistics.distinct_count * value_size + statistics.distinct_string_heap_bytes +
+             compressed_vector_size(row_count, saturating_cast(statistics.distinct_count), vector_compression_type);
+
+    case EncodingType::FixedStringDictionary:
+      return statistics.distinct_count * statistics.max_string_length +
+             compressed_vector_size(row_count, saturating_cast(statistics.distinct_count), vector_compression_type);
+
+    case EncodingType::RunLength: {
+      const auto run_count = statistics.run_count;
+      const auto run_heap_bytes = row_count > 0 ? statistics.string_heap_bytes * run_count / row_count : size_t{0};
+      return run_count * (value_size + sizeof(ChunkOffset)) + (run_count + 7) / 8 + run_heap_bytes;
+    }
+
+    case EncodingType::FrameOfReference: {
+      Assert(statistics.max_frame_offset, "FrameOfReference requires the frame offsets of an int column.");
+      const auto block_size = size_t{FrameOfReferenceSegment<int32_t>::block_size};
+      const auto block_count = (row_count + block_size - 1) / block_size;
+      return block_count * value_size +
+             compressed_vector_size(row_count, *statistics.max_frame_offset, vector_compression_type) +
+             null_vector_size;
+    }
+
+    case EncodingType::LZ4: {
+      const auto value_count = row_count - null_count;
+      const auto repetition_count = value_count - std::min(value_count, statistics.distinct_count);
+      if (statistics.data_type == DataType::String) {
+        // Besides the compressed characters, the segment stores an offset for each string.
+        const auto compressed_size = std::min(statistics.string_bytes,
+                                              statistics.distinct_string_bytes + repetition_count * LZ4_MATCH_SIZE);
+        return compressed_size +
+               compressed_vector_size(row_count, saturating_cast(statistics.string_bytes), vector_compression_type) +
+               null_vector_size;
+      }
+
+      const auto compressed_size =
+          std::min(row_count * value_size, statistics.distinct_count * value_size + repetition_count * LZ4_MATCH_SIZE);
+      return compressed_size + null_vector_size;
+    }
+
+    case EncodingType::FSST: {
+      // Every string is compressed on its own and stored with its end offset.
+      const auto compressed_size =
+          static_cast<size_t>(static_cast<double>(statistics.string_bytes) / FSST_COMPRESSION_FACTOR);
+      const auto symbol_table_size = statistics.string_bytes > 0 ? FSST_SYMBOL_TABLE_SIZE : size_t{0};
+      return compressed_size + symbol_table_size +
+             compressed_vector_size(row_count, saturating_cast(compressed_size), vector_compression_type) +
+             null_vector_size;
+    }
+  }
+  Fail("Invalid enum value.");
+}
+
+double estimate_segment_decoding_cost(const SegmentEncodingStatistics& statistics,
+                                      const SegmentEncodingSpec& encoding_spec) {
+  const auto row_count = static_cast<double>(statistics.row_count);
+  const auto access_count = statistics.sequential_access_count + statistics.random_access_count;
+  const auto random_access_share =
+      access_count > 0 ? static_cast<double>(statistics.random_access_count) / static_cast<double>(access_count) : 0.0;
+  auto vector_decoding_cost = FIXED_WIDTH_INTEGER_DECODING_COST;
+  if (encoding_spec.vector_compression_type == VectorCompressionType::BitPacking) {
+    vector_decoding_cost = BIT_PACKING_DECODING_COST;
+  } else if (encoding_spec.vector_compression_type == VectorCompressionType::SimdBp128) {
+    // Sequential accesses unpack whole blocks, point accesses unpack single values like BitPacking.
+    vector_decoding_cost = (1.0 - random_access_share) * SIMD_BP128_SEQUENTIAL_DECODING_COST +
+                           random_access_share * BIT_PACKING_DECODING_COST;
+  }
+
+  auto cost_per_row = 0.0;
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      break;
+    case EncodingType::Dictionary:
+    case EncodingType::FrameOfReference:
+      cost_per_row = vector_decoding_cost;
+      break;
+    case EncodingType::FixedStringDictionary:
+      cost_per_row = vector_decoding_cost + FIXED_STRING_DECODING_COST;
+      break;
+    case EncodingType::RunLength: {
+      // Random accesses binary search the end positions of the runs.
+      const auto random_access_cost = std::log2(static_cast<double>(statistics.run_count) + 1.0);
+      cost_per_row = (1.0 - random_access_share) * RUN_LENGTH_SEQUENTIAL_DECODING_COST +
+                     random_access_share * random_access_cost;
+      break;
+    }
+    case EncodingType::LZ4:
+      cost_per_row = (1.0 - random_access_share) * LZ4_SEQUENTIAL_DECODING_COST +
+                     random_access_share * LZ4_RANDOM_ACCESS_DECODING_COST;
+      break;
+    case EncodingType::FSST: {
+      // Each row reads its start and end offset. As the strings are compressed independently, point accesses are as
+      // cheap as sequential ones.
+      const auto value_count = static_cast<size_t>(statistics.row_count) - static_cast<size_t>(statistics.null_count);
+      const auto average_string_length =
+          value_count > 0 ? static_cast<double>(statistics.string_bytes) / static_cast<double>(value_count) : 0.0;
+      cost_per_row = 2.0 * vector_decoding_cost + FSST_DECODING_COST_PER_BYTE * average_string_length;
+      break;
+    }
+  }
+
+  return row_count * cost_per_row;
+}
+
+SegmentEncodingSpec advise_segment_encoding_spec(const std::shared_ptr<const AbstractSegment>& segment,
+                                                 const DataType data_type, const bool segment_values_are_unique) {
+  auto distinct_value_sets = DistinctValueSets{};
+  return advise_spec(segment, data_type, segment_values_are_unique, distinct_value_sets);
+}
+
+SegmentEncodingSpec advise_segment_encoding_spec(const SegmentEncodingStatistics& statistics,
+                                                 const bool segment_values_are_unique) {
+  const auto data_type = statistics.data_type;
+
+  // The candidates are evaluated in order and only replaced by strictly better ones. Thus, the default encoding is
+  // kept if no other encoding promises an improvement.
+  auto candidates = std::vector<SegmentEncodingSpec>{};
+  const auto add_candidates = [&](const EncodingType encoding_type) {
+    if (!uses_vector_compression(encoding_type)) {
+      candidates.emplace_back(encoding_type);
+      return;
+    }
+
+    // SimdBp128 is not proposed: its advantage is the bit width per block, which the segment-wide statistics cannot
+    // estimate (see compressed_vector_size).
+    candidates.emplace_back(encoding_type, VectorCompressionType::FixedWidthInteger);
+    candidates.emplace_back(encoding_type, VectorCompressionType::BitPacking);
+  };
+
+  add_candidates(auto_select_segment_encoding_spec(data_type, segment_values_are_unique).encoding_type);
+  for (const auto encoding_type : encoding_types) {
+    if (encoding_supports_data_type(encoding_type, data_type)) {
+      add_candidates(encoding_type);
+    }
+  }
+
+  const auto row_count = static_cast<double>(std::max(statistics.row_count, ChunkOffset{1}));
+  const auto accesses_per_row =
+      static_cast<double>(statistics.sequential_access_count + statistics.random_access_count) / row_count;
+  const auto decoding_cost_weight = 1.0 + accesses_per_row;
+
+  auto best_spec = candidates.front();
+  auto best_cost = std::numeric_limits<double>::max();
+  for (const auto& candidate : candidates) {
+    const auto cost = static_cast<double>(estimate_encoded_segment_size(statistics, candidate)) +
+                      decoding_cost_weight * estimate_segment_decoding_cost(statistics, candidate);
+    if (cost < best_cost) {
+      best_spec = candidate;
+      best_cost = cost;
+    }
+  }
+
+  return best_spec;
+}
+
+ChunkEncodingSpec advise_chunk_encoding_spec(const std::shared_ptr<const Chunk>& chunk,
+                                             const std::vector<DataType>& column_data_types,
+                                             const std::vector<ColumnID>& unique_columns) {
+  const auto column_count = chunk->column_count();
+  Assert(column_data_types.size() == static_cast<size_t>(column_count),
+         "Number of column types must match the chunk’s column count.");
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(column_count);
+  auto distinct_value_sets = DistinctValueSets{};
+  auto unique_columns_iter = unique_columns.begin();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment_values_are_unique =
+        unique_columns_iter != unique_columns.end() && *unique_columns_iter == column_id;
+    if (segment_values_are_unique) {
+      ++unique_columns_iter;
+    }
+    chunk_encoding_spec.push_back(advise_spec(chunk->get_segment(column_id), column_data_types[column_id],
+                                              segment_values_are_unique, distinct_value_sets));
+  }
+  return chunk_encoding_spec;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+class Chunk;
+
+/**
+ * Properties of a segment's values that determine how well the different encodings compress it and how expensive it
+ * is to decode. They are gathered in a single pass over the segment (see collect_segment_encoding_statistics()).
+ */
+struct SegmentEncodingStatistics {
+  DataType data_type{DataType::Null};
+  ChunkOffset row_count{0};
+  ChunkOffset null_count{0};
+
+  // Number of distinct non-NULL values.
+  size_t distinct_count{0};
+
+  // Number of maximal runs of equal values. NULLs form runs of their own.
+  size_t run_count{0};
+
+  // Largest difference between a value and the minimum of its frame (FrameOfReferenceSegment::block_size). Only set
+  // for int columns, as FrameOfReference does not support other data types.
+  std::optional<uint32_t> max_frame_offset;
+
+  // For string columns: the summed lengths of all (distinct) non-NULL strings, the part of it that does not fit into
+  // the small string buffer and has to be allocated separately, and the length of the longest string.
+  size_t string_bytes{0};
+  size_t distinct_string_bytes{0};
+  size_t string_heap_bytes{0};
+  size_t distinct_string_heap_bytes{0};
+  size_t max_string_length{0};
+
+  // Access history of the segment (see SegmentAccessCounter). Point and random accesses are cheap for the fixed-width
+  // encodings, but require a search (RunLength) or a block decompression (LZ4) otherwise.
+  uint64_t sequential_access_count{0};
+  uint64_t random_access_count{0};
+};
+
+/**
+ * Gathers the SegmentEncodingStatistics of an arbitrarily encoded (but not referencing) segment. If the values are
+ * known to be unique (e.g., due to a key constraint), the distinct values are not collected.
+ */
+SegmentEncodingStatistics collect_segment_encoding_statistics(const std::shared_ptr<const AbstractSegment>& segment,
+                                                              const DataType data_type,
+                                                              const bool segment_values_are_unique = false);
+
+/**
+ * Estimates the size in bytes of the segment described by the statistics when encoded with the given spec. If the spec
+ * does not name a vector compression, the encoder's default (FixedWidthInteger) is assumed. LZ4 is estimated
+ * coarsely: every distinct value is stored once as a literal, every repetition is replaced by a short match token.
+ * FSST is assumed to compress the characters of every string by a constant factor.
+ */
+size_t estimate_encoded_segment_size(const SegmentEncodingStatistics& statistics,
+                                     const SegmentEncodingSpec& encoding_spec);
+
+/**
+ * Estimates the cost of reading the segment once with the given spec, in byte equivalents so that it can be added to
+ * the estimated size. The cost is weighted by the recorded access pattern: segments that have mostly been accessed
+ * via position lists pay for the random access costs of RunLength and LZ4.
+ */
+double estimate_segment_decoding_cost(const SegmentEncodingStatistics& statistics,
+                                      const SegmentEncodingSpec& encoding_spec);
+
+/**
+ * Picks the SegmentEncodingSpec (encoding type and vector compression) with the lowest combined memory and scan cost:
+ *
+ *   estimated size + (1 + recorded accesses per row) * decoding cost
+ *
+ * Segments that have been scanned repeatedly favor fast decoding, cold segments favor a small footprint. Ties go to
+ * the encoding that auto_select_segment_encoding_spec() would have chosen. Segments with fewer than
+ * MIN_ADVISED_SEGMENT_SIZE rows are not inspected, as their fixed per-segment overheads dominate any estimate.
+ */
+SegmentEncodingSpec advise_segment_encoding_spec(const std::shared_ptr<const AbstractSegment>& segment,
+                                                 const DataType data_type,
+                                                 const bool segment_values_are_unique = false);
+SegmentEncodingSpec advise_segment_encoding_spec(const SegmentEncodingStatistics& statistics,
+                                                 const bool segment_values_are_unique = false);
+
+/**
+ * Applies advise_segment_encoding_spec() to each segment of an immutable chunk. unique_columns has to be sorted, as
+ * returned by unique_columns().
+ */
+ChunkEncodingSpec advise_chunk_encoding_spec(const std::shared_ptr<const Chunk>& chunk,
+                                             const std::vector<DataType>& column_data_types,
+                                             const std::vector<ColumnID>& unique_columns);
+
+constexpr auto MIN_ADVISED_SEGMENT_SIZE = ChunkOffset{1'000};
+
+}  // namespace hyrise
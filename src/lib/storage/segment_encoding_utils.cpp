@@ -12,6 +12,7 @@
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/frame_of_reference_segment/frame_of_reference_encoder.hpp"
+#include "storage/fsst_segment/fsst_encoder.hpp"
 #include "storage/lz4_segment/lz4_encoder.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment/run_length_encoder.hpp"
@@ -34,7 +35,8 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseSegment
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
     {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
-    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()}};
+    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()},
+    {EncodingType::FSST, std::make_shared<FSSTEncoder>()}};
 
 }  // namespace
 
@@ -75,6 +77,8 @@ VectorCompressionType parent_vector_compression_type(const CompressedVectorType
       break;
     case CompressedVectorType::BitPacking:
       return VectorCompressionType::BitPacking;
+    case CompressedVectorType::SimdBp128:
+      return VectorCompressionType::SimdBp128;
   }
   Fail("Invalid enum value.");
 }
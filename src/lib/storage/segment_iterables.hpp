@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 #include <utility>
 
 #include "resolve_type.hpp"
+#include "storage/pos_lists/chunk_range_pos_list.hpp"
 #include "storage/segment_iterables/abstract_segment_iterators.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -56,6 +58,10 @@ namespace hyrise {
  * });
  *
  */
+// Number of values that are decoded at once by segment_decode_blocks (see segment_iterate.hpp). The decoded values of a
+// block should fit into the L1 cache. Implementations of decode_block use it to size their intermediate buffers.
+constexpr auto SEGMENT_DECODE_BLOCK_SIZE = size_t{2'048};
+
 template <typename Derived>
 class SegmentIterable {
  public:
@@ -126,6 +132,27 @@ class SegmentIterable {
     });
   }
 
+  /**
+   * Decode the values and NULL flags of the chunk offsets [begin, begin + count) into plain arrays. Iterables of
+   * encoded segments override this to decode a whole range at once (e.g., by unpacking the attribute vector of a
+   * dictionary segment before looking up the dictionary) instead of decoding value by value. Loops over the decoded
+   * arrays can then be vectorized by the compiler.
+   * @param values   Array with room for `count` values. The values written for NULLs are unspecified.
+   * @param nulls    Array with room for `count` NULL flags.
+   */
+  template <typename T>
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* nulls) const {
+    with_iterators([&](auto it, [[maybe_unused]] const auto end) {
+      DebugAssert(static_cast<size_t>(end - it) >= begin + count, "Block exceeds the iterable.");
+      it += begin;
+      for (auto index = size_t{0}; index < count; ++index, ++it) {
+        const auto& position = *it;
+        values[index] = position.value();
+        nulls[index] = position.is_null();
+      }
+    });
+  }
+
   /** @} */
 
  private:
@@ -160,6 +187,15 @@ class PointAccessibleSegmentIterable : public SegmentIterable<Derived> {
       // immutable. For mutable chunks, EntireChunkPosList's `_common_chunk_size` member is used to limit the position
       // list in case of concurrently growing ValueSegments.
       _self()._on_with_iterators(functor);
+    } else if (const auto* const chunk_range = dynamic_cast<const ChunkRangePosList*>(position_filter.get())) {
+      // Contiguous ranges are scanned with the sequential iterators, which are much cheaper than point accesses for
+      // most encodings. The iterators report the offsets within the chunk (see ChunkRangePosList).
+      _self()._on_with_iterators([&functor, chunk_range](auto begin, const auto& /*end*/) {
+        auto range_end = begin;
+        begin += static_cast<std::ptrdiff_t>(chunk_range->begin_offset());
+        range_end += static_cast<std::ptrdiff_t>(chunk_range->end_offset());
+        functor(begin, range_end);
+      });
     } else {
       DebugAssert(position_filter->references_single_chunk(), "Expected PosList to reference single chunk.");
 
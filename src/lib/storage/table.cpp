@@ -9,6 +9,7 @@
 #include <mutex>
 #include <optional>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -307,6 +308,24 @@ void Table::remove_chunk(ChunkID chunk_id) {
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>{});
 }
 
+bool Table::try_claim_chunks_for_cleanup(const std::vector<ChunkID>& chunk_ids) {
+  for (auto index = size_t{0}; index < chunk_ids.size(); ++index) {
+    const auto chunk = get_chunk(chunk_ids[index]);
+    if (!chunk || !chunk->try_claim_for_cleanup()) {
+      release_cleanup_claims({chunk_ids.begin(), chunk_ids.begin() + static_cast<std::ptrdiff_t>(index)});
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Table::release_cleanup_claims(const std::vector<ChunkID>& chunk_ids) {
+  for (const auto chunk_id : chunk_ids) {
+    get_chunk(chunk_id)->release_cleanup_claim();
+  }
+}
+
 void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data,  // NOLINT
                          PolymorphicAllocator<Chunk> alloc) {
   Assert(_type != TableType::Data || static_cast<bool>(mvcc_data) == (_use_mvcc == UseMvcc::Yes),
@@ -401,16 +420,105 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
   return rows;
 }
 
-std::unique_lock<std::mutex> Table::acquire_append_mutex() {
-  return std::unique_lock<std::mutex>(_append_mutex);
+std::unique_lock<std::shared_mutex> Table::acquire_append_mutex() {
+  return std::unique_lock<std::shared_mutex>(_append_mutex);
+}
+
+std::shared_lock<std::shared_mutex> Table::acquire_shared_append_mutex() {
+  return std::shared_lock<std::shared_mutex>(_append_mutex);
+}
+
+void Table::set_insert_shard_count(const uint32_t shard_count) {
+  Assert(_use_mvcc == UseMvcc::Yes, "Insert shards require a table with MVCC data.");
+  Assert(shard_count > 0, "Tables need at least one insert shard.");
+
+  const auto append_lock = acquire_append_mutex();
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    Assert(!chunk || !chunk->is_mutable(), "Insert shards can only be changed while the table has no mutable chunks.");
+  }
+
+  // A single shard is the default: Inserts use the last chunk.
+  _insert_shards.clear();
+  if (shard_count == 1) {
+    return;
+  }
+
+  _insert_shards.reserve(shard_count);
+  for (auto shard_id = uint32_t{0}; shard_id < shard_count; ++shard_id) {
+    _insert_shards.emplace_back(std::make_unique<InsertShard>());
+  }
+}
+
+uint32_t Table::insert_shard_count() const {
+  return _insert_shards.empty() ? 1 : static_cast<uint32_t>(_insert_shards.size());
+}
+
+Table::InsertShard& Table::insert_shard() {
+  DebugAssert(!_insert_shards.empty(), "Table has no insert shards.");
+  // Each thread is assigned an index once. Thus, threads are spread evenly across the shards.
+  static auto next_thread_index = std::atomic_size_t{0};
+  thread_local const auto thread_index = next_thread_index++;
+  return *_insert_shards[thread_index % _insert_shards.size()];
+}
+
+ChunkID Table::insert_tail_chunk_id() const {
+  DebugAssert(_insert_shards.empty(), "Tables with multiple insert shards have one tail chunk per shard.");
+  if (_kept_insert_tail_chunk_id != INVALID_CHUNK_ID) {
+    const auto chunk = get_chunk(_kept_insert_tail_chunk_id);
+    if (chunk && chunk->is_mutable() && !chunk->is_full()) {
+      return _kept_insert_tail_chunk_id;
+    }
+  }
+
+  return _chunks.empty() ? INVALID_CHUNK_ID : ChunkID{chunk_count() - 1};
+}
+
+void Table::keep_insert_tail() {
+  if (!_insert_shards.empty() || _chunks.empty()) {
+    return;
+  }
+
+  const auto tail_chunk_id = insert_tail_chunk_id();
+  if (get_chunk(tail_chunk_id)->is_mutable()) {
+    _kept_insert_tail_chunk_id = tail_chunk_id;
+  }
+}
+
+std::vector<ChunkID> Table::insert_tail_chunk_ids() const {
+  auto tail_chunk_ids = std::vector<ChunkID>{};
+  if (_insert_shards.empty()) {
+    // A full kept tail stays mutable until its pending Inserts finish, while new Inserts continue in the last chunk.
+    if (_kept_insert_tail_chunk_id != INVALID_CHUNK_ID && get_chunk(_kept_insert_tail_chunk_id)->is_mutable()) {
+      tail_chunk_ids.emplace_back(_kept_insert_tail_chunk_id);
+    }
+    if (!_chunks.empty() && last_chunk()->is_mutable() && ChunkID{chunk_count() - 1} != _kept_insert_tail_chunk_id) {
+      tail_chunk_ids.emplace_back(ChunkID{chunk_count() - 1});
+    }
+    return tail_chunk_ids;
+  }
+
+  for (const auto& shard : _insert_shards) {
+    if (shard->tail_chunk_id == INVALID_CHUNK_ID) {
+      continue;
+    }
+
+    const auto chunk = get_chunk(shard->tail_chunk_id);
+    if (chunk && chunk->is_mutable()) {
+      tail_chunk_ids.emplace_back(shard->tail_chunk_id);
+    }
+  }
+  std::ranges::sort(tail_chunk_ids);
+  return tail_chunk_ids;
 }
 
 std::shared_ptr<TableStatistics> Table::table_statistics() const {
-  return _table_statistics;
+  return std::atomic_load(&_table_statistics);
 }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  std::atomic_store(&_table_statistics, table_statistics);
 }
 
 std::vector<ChunkIndexStatistics> Table::chunk_indexes_statistics() const {
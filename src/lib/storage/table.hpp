@@ -6,6 +6,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -117,6 +118,13 @@ class Table : private Noncopyable {
    */
   void remove_chunk(ChunkID chunk_id);
 
+  /**
+   * Claims all given chunks for a rewrite by background maintenance (see Chunk::try_claim_for_cleanup()). If any of
+   * them is already claimed or was removed, no chunk is claimed and false is returned.
+   */
+  bool try_claim_chunks_for_cleanup(const std::vector<ChunkID>& chunk_ids);
+  void release_cleanup_claims(const std::vector<ChunkID>& chunk_ids);
+
   /**
    * Creates a new Chunk from a set of segments and appends it to this table.
    * When implementing operators, prefer building the Chunks upfront and adding them to the output table on
@@ -185,11 +193,54 @@ class Table : private Noncopyable {
   std::vector<std::vector<AllTypeVariant>> get_rows() const;
   /** @} */
 
-  std::unique_lock<std::mutex> acquire_append_mutex();
+  /**
+   * @defgroup Appending to tables with MVCC data
+   *
+   * By default, Insert operators reserve rows in the last chunk of a table while holding the append mutex, so
+   * concurrent Inserts into the same table serialize. With more than one insert shard, each shard has its own mutable
+   * tail chunk and mutex. Threads are assigned to shards round-robin (e.g., one shard per worker of the scheduler), so
+   * Inserts from different threads usually reserve rows in different chunks without blocking each other. While doing
+   * so, they hold the append mutex in shared mode. Appending new chunks (e.g., by AppendChunks) and sealing the tail
+   * chunks requires the append mutex in exclusive mode.
+   * @{
+   */
+  std::unique_lock<std::shared_mutex> acquire_append_mutex();
+  std::shared_lock<std::shared_mutex> acquire_shared_append_mutex();
+
+  struct InsertShard {
+    std::mutex mutex;
+
+    // Mutable chunk the shard's Inserts reserve rows in. Only changed while holding the append mutex exclusively.
+    ChunkID tail_chunk_id{INVALID_CHUNK_ID};
+  };
+
+  // The shard count can only be changed while the table has no mutable chunks and no Inserts are running.
+  void set_insert_shard_count(const uint32_t shard_count);
+  uint32_t insert_shard_count() const;
+
+  // Returns the insert shard of the calling thread. Requires more than one shard.
+  InsertShard& insert_shard();
+
+  // Returns the chunk that Inserts reserve rows in if the table has a single insert shard. Usually, this is the last
+  // chunk. If chunks were appended after a kept tail (see keep_insert_tail()), the kept tail is returned until it is
+  // full or immutable. Returns INVALID_CHUNK_ID for tables without chunks. Requires the append mutex.
+  ChunkID insert_tail_chunk_id() const;
+
+  // With a single insert shard, keeps the current tail as the chunk that Inserts reserve rows in when chunks that do
+  // not accept Inserts (e.g., by AppendChunks) are appended after it. Without, subsequent Inserts would continue in a
+  // new chunk and leave the partially filled tail behind. Requires the append mutex in exclusive mode.
+  void keep_insert_tail();
+
+  // Returns the IDs of the mutable chunks that Inserts reserve rows in, i.e., the mutable insert tail of a single shard
+  // (the last chunk or a kept tail) or, with multiple insert shards, the mutable tail chunks of all shards. Requires
+  // the append mutex.
+  std::vector<ChunkID> insert_tail_chunk_ids() const;
+  /** @} */
 
   /**
    * Tables, typically those stored in the StorageManager, can be associated with statistics to perform Cardinality
-   * estimation during optimization.
+   * estimation during optimization. Statistics can be replaced while queries are optimized (e.g., by the
+   * StatisticsMaintenancePlugin), so they are accessed atomically.
    * @{
    */
   std::shared_ptr<TableStatistics> table_statistics() const;
@@ -293,7 +344,9 @@ class Table : private Noncopyable {
 
   std::vector<ColumnID> _value_clustered_by;
   std::shared_ptr<TableStatistics> _table_statistics;
-  std::mutex _append_mutex;
+  std::shared_mutex _append_mutex;
+  std::vector<std::unique_ptr<InsertShard>> _insert_shards;
+  ChunkID _kept_insert_tail_chunk_id{INVALID_CHUNK_ID};
   std::vector<ChunkIndexStatistics> _chunk_indexes_statistics;
   std::vector<TableIndexStatistics> _table_indexes_statistics;
   pmr_vector<std::shared_ptr<PartialHashIndex>> _table_indexes;
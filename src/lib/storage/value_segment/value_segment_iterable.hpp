@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -56,6 +58,19 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
     return _segment.size();
   }
 
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* nulls) const {
+    DebugAssert(begin + count <= _segment.size(), "Block exceeds the segment.");
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += count;
+
+    const auto offset = static_cast<std::ptrdiff_t>(begin);
+    std::copy_n(_segment.values().cbegin() + offset, count, values);
+    if (_segment.is_nullable()) {
+      std::copy_n(_segment.null_values().cbegin() + offset, count, nulls);
+    } else {
+      std::fill_n(nulls, count, false);
+    }
+  }
+
  private:
   const ValueSegment<T>& _segment;
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 #include <boost/iterator/iterator_facade.hpp>
@@ -7,6 +10,7 @@
 #include "base_vector_decompressor.hpp"
 #include "compressed_vector_type.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace hyrise {
 
@@ -100,6 +104,17 @@ class CompressedVector : public BaseCompressedVector {
     return end();
   }
 
+  /**
+   * @brief Decompresses the values [begin, begin + count) into `out`
+   *
+   * Vectors whose layout allows to decompress ranges faster than via the iterators (e.g., SimdBp128Vector) hide this
+   * method with their own implementation.
+   */
+  void decompress(const size_t begin, const size_t count, uint32_t* out) const {
+    DebugAssert(begin + count <= _self().on_size(), "Range out of bounds.");
+    std::copy_n(cbegin() + static_cast<std::ptrdiff_t>(begin), count, out);
+  }
+
   /**@}*/
 
  public:
@@ -12,6 +12,7 @@ inline bool is_fixed_width_integer(CompressedVectorType type) {
     case CompressedVectorType::FixedWidthInteger1Byte:
       return true;
     case CompressedVectorType::BitPacking:
+    case CompressedVectorType::SimdBp128:
       return false;
   }
 
@@ -29,6 +30,7 @@ inline size_t byte_width_for_fixed_width_integer_type(CompressedVectorType type)
     case CompressedVectorType::FixedWidthInteger1Byte:
       return 1u;
     case CompressedVectorType::BitPacking:
+    case CompressedVectorType::SimdBp128:
       return 0u;
   }
 
@@ -6,6 +6,7 @@
 #include "bitpacking/bitpacking_vector.hpp"
 #include "compressed_vector_type.hpp"
 #include "fixed_width_integer/fixed_width_integer_vector.hpp"
+#include "simd_bp128/simd_bp128_vector.hpp"
 
 namespace hyrise {
 
@@ -0,0 +1,63 @@
+#include "simd_bp128_compressor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "simd_bp128_packing.hpp"
+#include "simd_bp128_vector.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_compressor.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+std::unique_ptr<const BaseCompressedVector> SimdBp128Compressor::compress(
+    const pmr_vector<uint32_t>& vector, const PolymorphicAllocator<size_t>& alloc,
+    const UncompressedVectorInfo& /*meta_info*/) {
+  constexpr auto BLOCK_SIZE = SimdBp128Packing::BLOCK_SIZE;
+
+  const auto size = vector.size();
+  const auto block_count = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+  auto bit_widths = pmr_vector<uint8_t>(block_count, alloc);
+
+  // The bit widths are determined first, so that the packed data is allocated only once.
+  auto word_count = size_t{0};
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_end = std::min(size, block_begin + BLOCK_SIZE);
+    const auto max_value = *std::max_element(vector.cbegin() + static_cast<std::ptrdiff_t>(block_begin),
+                                             vector.cbegin() + static_cast<std::ptrdiff_t>(block_end));
+    bit_widths[block_index] = static_cast<uint8_t>(std::bit_width(max_value));
+    word_count += SimdBp128Packing::block_word_count(bit_widths[block_index]);
+  }
+
+  auto data = pmr_vector<uint32_t>(word_count, alloc);
+  auto buffer = std::array<uint32_t, BLOCK_SIZE>{};
+  auto word_offset = size_t{0};
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto value_count = std::min(BLOCK_SIZE, size - block_begin);
+
+    // The last block is padded with zeros.
+    std::copy_n(vector.cbegin() + static_cast<std::ptrdiff_t>(block_begin), value_count, buffer.begin());
+    std::fill(buffer.begin() + static_cast<std::ptrdiff_t>(value_count), buffer.end(), uint32_t{0});
+
+    SimdBp128Packing::pack_block(buffer.data(), data.data() + word_offset, bit_widths[block_index]);
+    word_offset += SimdBp128Packing::block_word_count(bit_widths[block_index]);
+  }
+
+  return std::make_unique<SimdBp128Vector>(std::move(data), std::move(bit_widths), size);
+}
+
+std::unique_ptr<BaseVectorCompressor> SimdBp128Compressor::create_new() const {
+  return std::make_unique<SimdBp128Compressor>();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "simd_bp128_packing.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class SimdBp128Decompressor : public BaseVectorDecompressor {
+ public:
+  SimdBp128Decompressor(const pmr_vector<uint32_t>& data, const pmr_vector<uint8_t>& bit_widths,
+                        const pmr_vector<uint32_t>& block_offsets, const size_t size)
+      : _data{&data}, _bit_widths{&bit_widths}, _block_offsets{&block_offsets}, _size{size} {}
+
+  SimdBp128Decompressor(const SimdBp128Decompressor& other) = default;
+  SimdBp128Decompressor(SimdBp128Decompressor&& other) = default;
+
+  // BaseVectorDecompressor is not assignable, so the defaulted operators would be deleted.
+  SimdBp128Decompressor& operator=(const SimdBp128Decompressor& other) {
+    _data = other._data;
+    _bit_widths = other._bit_widths;
+    _block_offsets = other._block_offsets;
+    _size = other._size;
+    return *this;
+  }
+
+  SimdBp128Decompressor& operator=(SimdBp128Decompressor&& other) {
+    return *this = other;
+  }
+
+  ~SimdBp128Decompressor() override = default;
+
+  // Unpacks only the requested value, not its block.
+  uint32_t get(size_t i) final {
+    const auto block_index = i / SimdBp128Packing::BLOCK_SIZE;
+    return SimdBp128Packing::unpack_value(_data->data() + (*_block_offsets)[block_index], (*_bit_widths)[block_index],
+                                          i % SimdBp128Packing::BLOCK_SIZE);
+  }
+
+  size_t size() const final {
+    return _size;
+  }
+
+ private:
+  const pmr_vector<uint32_t>* _data;
+  const pmr_vector<uint8_t>* _bit_widths;
+  const pmr_vector<uint32_t>* _block_offsets;
+  size_t _size;
+};
+
+}  // namespace hyrise
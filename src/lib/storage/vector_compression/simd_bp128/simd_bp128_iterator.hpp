@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "simd_bp128_packing.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Iterator over a SimdBp128Vector. When a value of a block is dereferenced for the first time, the whole block is
+ * unpacked into a buffer. Subsequent values of the same block are read from this buffer.
+ */
+class SimdBp128Iterator : public BaseCompressedVectorIterator<SimdBp128Iterator> {
+ public:
+  SimdBp128Iterator(const pmr_vector<uint32_t>& data, const pmr_vector<uint8_t>& bit_widths,
+                    const pmr_vector<uint32_t>& block_offsets, const size_t absolute_index = 0)
+      : _data{&data}, _bit_widths{&bit_widths}, _block_offsets{&block_offsets}, _absolute_index{absolute_index} {}
+
+ private:
+  friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+  void increment() {
+    ++_absolute_index;
+  }
+
+  void decrement() {
+    --_absolute_index;
+  }
+
+  void advance(std::ptrdiff_t n) {
+    _absolute_index += n;
+  }
+
+  bool equal(const SimdBp128Iterator& other) const {
+    return _absolute_index == other._absolute_index;
+  }
+
+  std::ptrdiff_t distance_to(const SimdBp128Iterator& other) const {
+    return static_cast<std::ptrdiff_t>(other._absolute_index) - static_cast<std::ptrdiff_t>(_absolute_index);
+  }
+
+  uint32_t dereference() const {
+    const auto block_index = _absolute_index / SimdBp128Packing::BLOCK_SIZE;
+    if (block_index != _buffered_block_index) {
+      SimdBp128Packing::unpack_block(_data->data() + (*_block_offsets)[block_index], _buffer.data(),
+                                     (*_bit_widths)[block_index]);
+      _buffered_block_index = block_index;
+    }
+    return _buffer[_absolute_index % SimdBp128Packing::BLOCK_SIZE];
+  }
+
+ private:
+  const pmr_vector<uint32_t>* _data;
+  const pmr_vector<uint8_t>* _bit_widths;
+  const pmr_vector<uint32_t>* _block_offsets;
+  size_t _absolute_index;
+
+  mutable size_t _buffered_block_index = std::numeric_limits<size_t>::max();
+  mutable std::array<uint32_t, SimdBp128Packing::BLOCK_SIZE> _buffer;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,41 @@
+#include "simd_bp128_packing.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+void SimdBp128Packing::pack_block(const uint32_t* in, uint32_t* out, const uint8_t bit_width) {
+  DebugAssert(bit_width <= MAX_BIT_WIDTH, "Invalid bit width.");
+  DebugAssert(std::all_of(in, in + BLOCK_SIZE,
+                          [&](const auto value) {
+                            return std::bit_width(value) <= bit_width;
+                          }),
+              "Value does not fit into the block's bit width.");
+
+  std::fill_n(out, block_word_count(bit_width), uint32_t{0});
+  if (bit_width == 0) {
+    return;
+  }
+
+  for (auto index = size_t{0}; index < BLOCK_SIZE / LANE_COUNT; ++index) {
+    const auto bit_offset = index * bit_width;
+    const auto word = bit_offset / 32;
+    const auto shift = bit_offset % 32;
+    const auto spans_two_words = shift + bit_width > 32;
+
+    for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+      const auto value = in[index * LANE_COUNT + lane];
+      out[word * LANE_COUNT + lane] |= value << shift;
+      if (spans_two_words) {
+        out[(word + 1) * LANE_COUNT + lane] |= value >> (32 - shift);
+      }
+    }
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Packing and unpacking of blocks in the SIMD-BP128 layout
+ *
+ * A block consists of BLOCK_SIZE values that are packed with the same bit width. The values are distributed
+ * round-robin over LANE_COUNT 32-bit lanes (i.e., value i is stored in lane i % LANE_COUNT) and each lane is
+ * bit-packed on its own. The n-th words of all lanes are stored next to each other, so that a single 128-bit register
+ * holds one word of every lane and four values are (un)packed with the same shift and mask operations. A block with
+ * bit width b occupies exactly LANE_COUNT * b words.
+ *
+ * We do not use intrinsics. Instead, the lane loops are written so that the compiler can vectorize them (see
+ * -fopenmp-simd). Unpacking is specialized for every bit width, so that all shifts and masks are constants.
+ *
+ * See Lemire and Boytsov, "Decoding billions of integers per second through vectorization" (2015).
+ */
+class SimdBp128Packing {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{128};
+  static constexpr auto LANE_COUNT = size_t{4};
+  static constexpr auto MAX_BIT_WIDTH = uint8_t{32};
+
+  // Returns the number of 32-bit words that a block with the given bit width occupies.
+  static constexpr size_t block_word_count(const uint8_t bit_width) {
+    return LANE_COUNT * bit_width;
+  }
+
+  // Packs BLOCK_SIZE values of `in` into the block_word_count(bit_width) words of `out`. All values must fit into
+  // bit_width bits.
+  static void pack_block(const uint32_t* in, uint32_t* out, const uint8_t bit_width);
+
+  // Unpacks the BLOCK_SIZE values of the block `in` into `out`.
+  static void unpack_block(const uint32_t* in, uint32_t* out, const uint8_t bit_width) {
+    DebugAssert(bit_width <= MAX_BIT_WIDTH, "Invalid bit width.");
+    _unpack_functions[bit_width](in, out);
+  }
+
+  // Unpacks the value at `index` (< BLOCK_SIZE) of the block `in` without unpacking the others.
+  static uint32_t unpack_value(const uint32_t* in, const uint8_t bit_width, const size_t index) {
+    if (bit_width == 0) {
+      return 0;
+    }
+
+    const auto lane = index % LANE_COUNT;
+    const auto bit_offset = (index / LANE_COUNT) * bit_width;
+    const auto word = bit_offset / 32;
+    const auto shift = bit_offset % 32;
+
+    auto value = uint64_t{in[word * LANE_COUNT + lane]} >> shift;
+    if (shift + bit_width > 32) {
+      value |= uint64_t{in[(word + 1) * LANE_COUNT + lane]} << (32 - shift);
+    }
+    return static_cast<uint32_t>(value & ((uint64_t{1} << bit_width) - 1));
+  }
+
+ private:
+  template <uint8_t BitWidth>
+  static void _unpack_block(const uint32_t* __restrict in, uint32_t* __restrict out) {
+    if constexpr (BitWidth == 0) {
+      std::fill_n(out, BLOCK_SIZE, uint32_t{0});
+    } else {
+      constexpr auto MASK = static_cast<uint32_t>((uint64_t{1} << BitWidth) - 1);
+      for (auto index = size_t{0}; index < BLOCK_SIZE / LANE_COUNT; ++index) {
+        const auto bit_offset = index * BitWidth;
+        const auto word = bit_offset / 32;
+        const auto shift = bit_offset % 32;
+        const auto spans_two_words = shift + BitWidth > 32;
+
+        // This empty block is used to convince clang-format to keep the pragma indented.
+        // NOLINTNEXTLINE
+        {}  // clang-format off
+        #pragma omp simd
+        // clang-format on
+        for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+          auto value = in[word * LANE_COUNT + lane] >> shift;
+          if (spans_two_words) {
+            value |= in[(word + 1) * LANE_COUNT + lane] << (32 - shift);
+          }
+          out[index * LANE_COUNT + lane] = value & MASK;
+        }
+      }
+    }
+  }
+
+  using UnpackFunction = void (*)(const uint32_t*, uint32_t*);
+
+  template <size_t... BitWidths>
+  static constexpr std::array<UnpackFunction, sizeof...(BitWidths)> _make_unpack_functions(
+      std::index_sequence<BitWidths...> /*bit_widths*/) {
+    return {&_unpack_block<static_cast<uint8_t>(BitWidths)>...};
+  }
+
+  static const std::array<UnpackFunction, MAX_BIT_WIDTH + 1> _unpack_functions;
+};
+
+inline constexpr std::array<SimdBp128Packing::UnpackFunction, SimdBp128Packing::MAX_BIT_WIDTH + 1>
+    SimdBp128Packing::_unpack_functions =
+        SimdBp128Packing::_make_unpack_functions(std::make_index_sequence<MAX_BIT_WIDTH + 1>{});
+
+}  // namespace hyrise
@@ -0,0 +1,115 @@
+#include "simd_bp128_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "simd_bp128_decompressor.hpp"
+#include "simd_bp128_iterator.hpp"
+#include "simd_bp128_packing.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+SimdBp128Vector::SimdBp128Vector(pmr_vector<uint32_t> data, pmr_vector<uint8_t> bit_widths, const size_t size)
+    : _data{std::move(data)},
+      _bit_widths{std::move(bit_widths)},
+      _block_offsets{_bit_widths.get_allocator()},
+      _size{size} {
+  Assert(_bit_widths.size() == (_size + BLOCK_SIZE - 1) / BLOCK_SIZE, "Expected one bit width per block.");
+
+  _block_offsets.reserve(_bit_widths.size());
+  auto word_count = size_t{0};
+  for (const auto bit_width : _bit_widths) {
+    Assert(bit_width <= SimdBp128Packing::MAX_BIT_WIDTH, "Invalid bit width.");
+    _block_offsets.emplace_back(static_cast<uint32_t>(word_count));
+    word_count += SimdBp128Packing::block_word_count(bit_width);
+  }
+  Assert(word_count == _data.size(), "Size of the packed data does not match the bit widths of the blocks.");
+}
+
+const pmr_vector<uint32_t>& SimdBp128Vector::data() const {
+  return _data;
+}
+
+const pmr_vector<uint8_t>& SimdBp128Vector::bit_widths() const {
+  return _bit_widths;
+}
+
+size_t SimdBp128Vector::block_count() const {
+  return _bit_widths.size();
+}
+
+uint32_t SimdBp128Vector::block_max_value(const size_t block_index) const {
+  DebugAssert(block_index < block_count(), "Block index out of bounds.");
+  return static_cast<uint32_t>((uint64_t{1} << _bit_widths[block_index]) - 1);
+}
+
+void SimdBp128Vector::decompress_block(const size_t block_index, uint32_t* out) const {
+  DebugAssert(block_index < block_count(), "Block index out of bounds.");
+  SimdBp128Packing::unpack_block(_data.data() + _block_offsets[block_index], out, _bit_widths[block_index]);
+}
+
+void SimdBp128Vector::decompress(const size_t begin, const size_t count, uint32_t* out) const {
+  DebugAssert(begin + count <= _size, "Range out of bounds.");
+
+  auto buffer = std::array<uint32_t, BLOCK_SIZE>{};
+  auto index = begin;
+  const auto end = begin + count;
+  while (index < end) {
+    const auto block_index = index / BLOCK_SIZE;
+    const auto offset_in_block = index % BLOCK_SIZE;
+    const auto value_count = std::min(BLOCK_SIZE - offset_in_block, end - index);
+
+    if (value_count == BLOCK_SIZE) {
+      // Unpack full blocks directly into the output.
+      decompress_block(block_index, out);
+    } else {
+      decompress_block(block_index, buffer.data());
+      std::copy_n(buffer.begin() + static_cast<std::ptrdiff_t>(offset_in_block), value_count, out);
+    }
+
+    out += value_count;
+    index += value_count;
+  }
+}
+
+size_t SimdBp128Vector::on_size() const {
+  return _size;
+}
+
+size_t SimdBp128Vector::on_data_size() const {
+  return sizeof(uint32_t) * _data.capacity() + sizeof(uint8_t) * _bit_widths.capacity() +
+         sizeof(uint32_t) * _block_offsets.capacity();
+}
+
+std::unique_ptr<BaseVectorDecompressor> SimdBp128Vector::on_create_base_decompressor() const {
+  return std::make_unique<SimdBp128Decompressor>(_data, _bit_widths, _block_offsets, _size);
+}
+
+SimdBp128Decompressor SimdBp128Vector::on_create_decompressor() const {
+  return SimdBp128Decompressor(_data, _bit_widths, _block_offsets, _size);
+}
+
+SimdBp128Iterator SimdBp128Vector::on_begin() const {
+  return SimdBp128Iterator(_data, _bit_widths, _block_offsets, 0u);
+}
+
+SimdBp128Iterator SimdBp128Vector::on_end() const {
+  return SimdBp128Iterator(_data, _bit_widths, _block_offsets, _size);
+}
+
+std::unique_ptr<const BaseCompressedVector> SimdBp128Vector::on_copy_using_memory_resource(
+    MemoryResource& memory_resource) const {
+  auto data_copy = pmr_vector<uint32_t>{_data, &memory_resource};
+  auto bit_widths_copy = pmr_vector<uint8_t>{_bit_widths, &memory_resource};
+  return std::make_unique<SimdBp128Vector>(std::move(data_copy), std::move(bit_widths_copy), _size);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "simd_bp128_decompressor.hpp"
+#include "simd_bp128_iterator.hpp"
+#include "simd_bp128_packing.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Bit-packed vector with one bit width per block of 128 values
+ *
+ * In contrast to BitPackingVector, the values are packed in blocks (see SimdBp128Packing for the layout) and every
+ * block uses the bit width required by its own maximum. Thus, a few large values only affect the size of their own
+ * blocks. Whole blocks are unpacked with vectorized shifts, which makes sequential decoding (e.g., of attribute
+ * vectors in scans and aggregates) considerably faster than unpacking value by value. Point access remains possible
+ * without unpacking the surrounding block.
+ *
+ * The last block is padded with zeros.
+ */
+class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
+ public:
+  static constexpr auto BLOCK_SIZE = SimdBp128Packing::BLOCK_SIZE;
+
+  /**
+   * @param data The packed blocks.
+   * @param bit_widths The bit width of every block.
+   * @param size The number of values (i.e., without the padding of the last block).
+   */
+  explicit SimdBp128Vector(pmr_vector<uint32_t> data, pmr_vector<uint8_t> bit_widths, const size_t size);
+
+  const pmr_vector<uint32_t>& data() const;
+  const pmr_vector<uint8_t>& bit_widths() const;
+
+  size_t block_count() const;
+
+  // Returns the largest value that the block can contain. If it is smaller than a search value, no value of the block
+  // can be equal to or larger than the search value. Thus, scans can skip (or fully accept) the block without
+  // unpacking it.
+  uint32_t block_max_value(const size_t block_index) const;
+
+  // Unpacks all BLOCK_SIZE values of a block into `out`. For the last block, the values beyond size() are zero.
+  void decompress_block(const size_t block_index, uint32_t* out) const;
+
+  // Unpacks the values [begin, begin + count) into `out`. Hides CompressedVector::decompress, which decodes value by
+  // value using the iterators.
+  void decompress(const size_t begin, const size_t count, uint32_t* out) const;
+
+  size_t on_size() const;
+  size_t on_data_size() const;
+
+  std::unique_ptr<BaseVectorDecompressor> on_create_base_decompressor() const;
+  SimdBp128Decompressor on_create_decompressor() const;
+
+  SimdBp128Iterator on_begin() const;
+  SimdBp128Iterator on_end() const;
+
+  std::unique_ptr<const BaseCompressedVector> on_copy_using_memory_resource(MemoryResource& memory_resource) const;
+
+ private:
+  const pmr_vector<uint32_t> _data;
+  const pmr_vector<uint8_t> _bit_widths;
+
+  // Index of the first word of every block in _data.
+  pmr_vector<uint32_t> _block_offsets;
+
+  const size_t _size;
+};
+
+}  // namespace hyrise
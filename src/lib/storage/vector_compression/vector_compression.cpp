@@ -10,6 +10,7 @@
 #include "base_vector_compressor.hpp"
 #include "bitpacking/bitpacking_compressor.hpp"
 #include "fixed_width_integer/fixed_width_integer_compressor.hpp"
+#include "simd_bp128/simd_bp128_compressor.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -24,7 +25,8 @@ namespace {
  */
 const auto vector_compressor_for_type = std::map<VectorCompressionType, std::shared_ptr<BaseVectorCompressor>>{
     {VectorCompressionType::FixedWidthInteger, std::make_shared<FixedWidthIntegerCompressor>()},
-    {VectorCompressionType::BitPacking, std::make_shared<BitPackingCompressor>()}};
+    {VectorCompressionType::BitPacking, std::make_shared<BitPackingCompressor>()},
+    {VectorCompressionType::SimdBp128, std::make_shared<SimdBp128Compressor>()}};
 
 std::unique_ptr<BaseVectorCompressor> create_compressor_by_type(VectorCompressionType type) {
   auto iter = vector_compressor_for_type.find(type);
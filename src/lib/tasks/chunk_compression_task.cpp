@@ -3,10 +3,13 @@
 #include <memory>
 #include <vector>
 
+#include "statistics/segment_sketch.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/constraints/constraint_utils.hpp"
 #include "storage/encoding_type.hpp"
-#include "storage/segment_encoding_utils.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/segment_encoding_advisor.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -29,9 +32,8 @@ ChunkCompressionTask::ChunkCompressionTask(const std::shared_ptr<Table>& table,
 void ChunkCompressionTask::_on_execute() {
   Assert(_table, "Table does not exist.");
 
-  const auto default_encoding_spec =
-      auto_select_chunk_encoding_spec(_table->column_data_types(), unique_columns(_table));
-  const auto chunk_encoding_spec = _chunk_encoding_spec.value_or(default_encoding_spec);
+  const auto column_data_types = _table->column_data_types();
+  const auto table_unique_columns = _chunk_encoding_spec ? std::vector<ColumnID>{} : unique_columns(_table);
 
   for (const auto chunk_id : _chunk_ids) {
     Assert(chunk_id < _table->chunk_count(), "Chunk with given ID does not exist.");
@@ -42,7 +44,20 @@ void ChunkCompressionTask::_on_execute() {
     }
     Assert(!chunk->is_mutable(), "Mutable chunks cannot be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), chunk_encoding_spec);
+    // Without an explicitly requested encoding, the encoding of each segment is chosen based on its values and its
+    // access history.
+    const auto chunk_encoding_spec =
+        _chunk_encoding_spec ? *_chunk_encoding_spec
+                             : advise_chunk_encoding_spec(chunk, column_data_types, table_unique_columns);
+    ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+
+    // The sketches are merged into the table statistics by the StatisticsMaintenancePlugin. Re-encoding a chunk does
+    // not change its values, so existing sketches are kept.
+    if (!chunk->sketches()) {
+      chunk->set_sketches(generate_chunk_sketches(*chunk));
+    }
+
+    place_chunk_on_numa_node(*_table, chunk_id);
   }
 }
 
@@ -13,7 +13,10 @@ class Chunk;
 class Table;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses a chunk of a table using the passed or an automatically selected encoding
+ *
+ * If no ChunkEncodingSpec is passed, advise_chunk_encoding_spec() picks the encoding of each segment based on its
+ * values and access history (see segment_encoding_advisor.hpp).
  *
  * The task compresses a chunk by sequentially compressing segments.
  * From each value segment, a dictionary segment is created that replaces the
@@ -30,6 +33,9 @@ class Table;
  * full and all of their end-cids must be smaller than infinity. This task calls
  * those chunks “completed”.
  *
+ * After compressing a chunk, the task builds mergeable sketches of its segments (see segment_sketch.hpp) that are
+ * used to maintain the table statistics.
+ *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
  */
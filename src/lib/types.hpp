@@ -235,6 +235,8 @@ enum class MetaTableChangeType { Insert, Delete, Update };
 
 enum class AutoCommit : bool { Yes = true, No = false };
 
+enum class IsolationLevel : bool { SnapshotIsolation, Serializable };
+
 enum class DatetimeComponent { Year, Month, Day, Hour, Minute, Second };
 
 // Used as a template parameter that is passed whenever we conditionally erase the type of a template. This is done to
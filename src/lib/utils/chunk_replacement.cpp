@@ -0,0 +1,133 @@
+#include "chunk_replacement.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/append_chunks.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/sort.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+bool try_replace_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                        const std::vector<ChunkID>& chunk_ids,
+                        const std::vector<SortColumnDefinition>& sort_definitions) {
+  DebugAssert(std::ranges::is_sorted(chunk_ids), "Expected sorted vector of ChunkIDs.");
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  // Create a temporary referencing table that contains the given chunks only.
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!std::ranges::binary_search(chunk_ids, chunk_id)) {
+      excluded_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  const auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>{});
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->never_clear_output();
+  validate->execute();
+
+  const auto delete_operator = std::make_shared<Delete>(validate);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+
+  // Usually, the OperatorTask would call rollback on a transaction conflict, but as we execute the operators directly,
+  // that is our job.
+  const auto rollback = [&]() {
+    transaction_context->rollback(RollbackReason::Conflict);
+    table->release_cleanup_claims(chunk_ids);
+    return false;
+  };
+
+  if (delete_operator->execute_failed()) {
+    return rollback();
+  }
+
+  // AppendChunks packs the (sorted) valid rows of all chunks into chunks of the table's target chunk size.
+  auto rows_to_append = std::shared_ptr<const AbstractOperator>{validate};
+  if (!sort_definitions.empty()) {
+    const auto sort = std::make_shared<Sort>(validate, sort_definitions, table->target_chunk_size());
+    sort->execute();
+    rows_to_append = sort;
+  }
+
+  const auto append_chunks = std::make_shared<AppendChunks>(table_name, rows_to_append, sort_definitions);
+  append_chunks->set_transaction_context(transaction_context);
+  append_chunks->execute();
+
+  if (append_chunks->execute_failed()) {
+    return rollback();
+  }
+
+  transaction_context->commit();
+
+  // Mark the old chunks as logically deleted.
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  }
+
+  return true;
+}
+
+void DeferredChunkRemoval::add(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
+  DebugAssert(table->get_chunk(chunk_id)->get_cleanup_commit_id(),
+              "Chunk needs to be deleted logically before deleting it physically.");
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _chunks.emplace_back(DeletedChunk{table, chunk_id});
+}
+
+size_t DeferredChunkRemoval::remove_invisible_chunks() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+
+  auto removed_chunk_count = size_t{0};
+  std::erase_if(_chunks, [&](const auto& deleted_chunk) {
+    const auto table = deleted_chunk.table.lock();
+    if (!table) {
+      return true;
+    }
+
+    const auto chunk = table->get_chunk(deleted_chunk.chunk_id);
+    if (!chunk) {
+      // The chunk has already been removed. Nothing is left to do.
+      return true;
+    }
+
+    // Check whether there are still active transactions that might use the chunk.
+    if (lowest_snapshot_commit_id && *chunk->get_cleanup_commit_id() > *lowest_snapshot_commit_id) {
+      return false;
+    }
+
+    table->remove_chunk(deleted_chunk.chunk_id);
+    ++removed_chunk_count;
+    return true;
+  });
+
+  return removed_chunk_count;
+}
+
+void DeferredChunkRemoval::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _chunks.clear();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Replaces the given chunks of a stored table by new, immutable chunks that hold their valid rows. This is used by
+ * plugins that reorganize tables in the background (e.g., to remove dead rows, to merge sparse chunks, or to cluster
+ * chunks by a key). In a single transaction, the valid rows are deleted, sorted by \p sort_definitions if given, and
+ * appended as full chunks (see AppendChunks), which are encoded in the background. Thus, concurrent transactions either
+ * see the old or the new chunks. Afterwards, the cleanup commit id of the old chunks is set. They can be removed
+ * physically once no active transaction can see them anymore (see DeferredChunkRemoval).
+ *
+ * The chunks have to be claimed for the cleanup before (see Table::try_claim_chunks_for_cleanup()). Returns false if
+ * the transaction conflicted with a concurrent one. In this case, it is rolled back and the claims are released.
+ */
+bool try_replace_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                        const std::vector<ChunkID>& chunk_ids,
+                        const std::vector<SortColumnDefinition>& sort_definitions = {});
+
+/**
+ * Collects chunks that have been logically deleted (i.e., whose cleanup commit id is set) and removes them physically
+ * once their cleanup commit id is not newer than the lowest active snapshot. Chunks of dropped tables are skipped.
+ */
+class DeferredChunkRemoval {
+ public:
+  void add(const std::shared_ptr<Table>& table, const ChunkID chunk_id);
+
+  // Removes the chunks that no active transaction can see anymore. Returns the number of removed chunks.
+  size_t remove_invisible_chunks();
+
+  void clear();
+
+ private:
+  struct DeletedChunk {
+    std::weak_ptr<Table> table;
+    ChunkID chunk_id;
+  };
+
+  std::mutex _mutex;
+  std::vector<DeletedChunk> _chunks;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,177 @@
+#include "chunk_merging_plugin.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/assert.hpp"
+#include "utils/chunk_replacement.hpp"
+#include "utils/log_manager.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+std::string ChunkMergingPlugin::description() const {
+  return "Chunk merging plugin";
+}
+
+void ChunkMergingPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY, [&](size_t /*unused*/) {
+    _merge_chunks();
+  });
+}
+
+void ChunkMergingPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread.
+  _loop_thread.reset();
+  _merged_chunks.clear();
+  _deltas.clear();
+}
+
+std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>>
+ChunkMergingPlugin::provided_user_executable_functions() {
+  return {{"MergeChunks", [&]() {
+             _merge_chunks();
+           }}};
+}
+
+size_t ChunkMergingPlugin::_merge_chunks() {
+  // Merging can be triggered both by the loop thread and as a user-executable function.
+  const auto lock = std::lock_guard<std::mutex>{_merge_mutex};
+  _merged_chunks.remove_invisible_chunks();
+  _seal_idle_deltas();
+
+  auto merged_chunk_count = size_t{0};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
+
+    const auto chunk_ids = _merge_candidates(*table);
+    if (chunk_ids.empty() || !_try_merge_chunks(table_name, table, chunk_ids)) {
+      continue;
+    }
+
+    merged_chunk_count += chunk_ids.size();
+    auto message = std::stringstream{};
+    message << "Merged " << chunk_ids.size() << " sparse chunk(s) of table '" << table_name << "'.";
+    Hyrise::get().log_manager.add_message("ChunkMergingPlugin", message.str(), LogLevel::Info);
+  }
+
+  return merged_chunk_count;
+}
+
+size_t ChunkMergingPlugin::_seal_idle_deltas() {
+  auto sealed_chunk_count = size_t{0};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
+
+    // Inserts register at the tail chunks while holding the append mutex. Holding it exclusively, no Insert can start
+    // writing to a delta while we seal it.
+    const auto append_lock = table->acquire_append_mutex();
+    const auto previous_deltas = std::exchange(_deltas[table_name], {});
+    auto& deltas = _deltas[table_name];
+
+    for (const auto chunk_id : table->insert_tail_chunk_ids()) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->is_full()) {
+        continue;
+      }
+
+      const auto size = chunk->size();
+      const auto is_idle = std::ranges::any_of(previous_deltas, [&](const auto& delta) {
+        return delta.chunk.lock() == chunk && delta.size == size;
+      });
+      if (!is_idle || size == 0 || chunk->mvcc_data()->pending_inserts() != 0) {
+        deltas.emplace_back(Delta{chunk, size});
+        continue;
+      }
+
+      chunk->mark_as_full();
+      const auto sealed = chunk->try_set_immutable();
+      Assert(sealed, "Idle delta could not be marked as immutable.");
+      std::make_shared<ChunkCompressionTask>(table, chunk_id)->schedule();
+      ++sealed_chunk_count;
+
+      auto message = std::stringstream{};
+      message << "Sealed delta chunk " << chunk_id << " of table '" << table_name << "' with " << size << " row(s).";
+      Hyrise::get().log_manager.add_message("ChunkMergingPlugin", message.str(), LogLevel::Info);
+    }
+  }
+
+  return sealed_chunk_count;
+}
+
+std::vector<ChunkID> ChunkMergingPlugin::_merge_candidates(const Table& table) {
+  const auto sparse_row_count = MERGE_THRESHOLD_FILL_RATIO * static_cast<double>(table.target_chunk_size());
+
+  auto candidates = std::vector<ChunkID>{};
+  auto run = std::vector<ChunkID>{};
+  const auto finish_run = [&]() {
+    if (run.size() >= 2) {
+      candidates.insert(candidates.end(), run.begin(), run.end());
+    }
+    run.clear();
+  };
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    // Physically deleted chunks and chunks that are about to be deleted do not separate their neighbors.
+    if (!chunk || chunk->get_cleanup_commit_id()) {
+      continue;
+    }
+
+    // The mutable last chunk is still filled by Inserts.
+    const auto valid_row_count = chunk->size() - chunk->invalid_row_count();
+    if (chunk->is_mutable() || static_cast<double>(valid_row_count) > sparse_row_count) {
+      finish_run();
+      continue;
+    }
+
+    run.emplace_back(chunk_id);
+    if (candidates.size() + run.size() == MAX_CHUNKS_PER_MERGE) {
+      break;
+    }
+  }
+  finish_run();
+
+  return candidates;
+}
+
+bool ChunkMergingPlugin::_try_merge_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                           const std::vector<ChunkID>& chunk_ids) {
+  // The MvccDeletePlugin or the ClusteringPlugin might rewrite some of the chunks concurrently.
+  if (!table->try_claim_chunks_for_cleanup(chunk_ids)) {
+    return false;
+  }
+
+  // AppendChunks packs the valid rows of all chunks into chunks of the table's target chunk size.
+  if (!try_replace_chunks(table_name, table, chunk_ids)) {
+    return false;
+  }
+
+  for (const auto chunk_id : chunk_ids) {
+    _merged_chunks.add(table, chunk_id);
+  }
+
+  return true;
+}
+
+EXPORT_PLUGIN(ChunkMergingPlugin);
+
+}  // namespace hyrise
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/chunk_replacement.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+
+/**
+ * Tables that are filled by many small transactions or that have been consolidated by the MvccDeletePlugin end up with
+ * many chunks that are only sparsely filled with valid rows. Every scan pays a fixed overhead per chunk and Validate
+ * has to check the invalidated rows over and over again.
+ *
+ * This plugin compacts such tables. It looks for runs of at least two adjacent immutable chunks whose valid rows make
+ * up at most MERGE_THRESHOLD_FILL_RATIO of the target chunk size each. In a single transaction per table, the valid
+ * rows of these chunks are deleted and appended in their original order as full chunks (see try_replace_chunks()),
+ * which are encoded in the background. Concurrent transactions either see the old or the new chunks. The old chunks
+ * are removed physically once no active transaction can see them anymore.
+ *
+ * Together with the Insert operator, this gives tables a delta-main layout: Inserts (and the inserting half of
+ * Updates) append to the mutable last chunk, the write-optimized delta of unencoded ValueSegments. The encoded,
+ * immutable chunks form the read-optimized main. A delta that reaches the target chunk size is encoded right away. If
+ * a table receives only few writes, however, its delta would stay unencoded. Therefore, the plugin seals deltas that
+ * have not grown since the previous run. They are encoded and, as they are usually sparse, merged into full chunks
+ * of the main with their sealed neighbors.
+ */
+class ChunkMergingPlugin : public AbstractPlugin {
+  friend class ChunkMergingPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>> provided_user_executable_functions() final;
+
+ protected:
+  /**
+   * Removes chunks of previous merges that are no longer visible, seals idle deltas, then merges the sparse chunks of
+   * all tables. Returns the number of merged chunks.
+   */
+  size_t _merge_chunks();
+
+  /**
+   * Marks the mutable tail chunks of all tables (see Table::insert_tail_chunk_ids()) as full and immutable if they
+   * have not grown since the previous run and no Insert is pending, and schedules their encoding. Subsequent Inserts
+   * continue in a new chunk. Returns the number of sealed chunks.
+   */
+  size_t _seal_idle_deltas();
+
+  /**
+   * Returns the sparse chunks of the table that are part of a run of at least two adjacent sparse chunks, in ascending
+   * order. Physically deleted chunks do not interrupt a run. At most MAX_CHUNKS_PER_MERGE chunks are returned.
+   */
+  static std::vector<ChunkID> _merge_candidates(const Table& table);
+
+  /**
+   * Deletes the valid rows of the given chunks and appends them as full chunks in a single transaction. Returns false
+   * if another plugin has claimed one of the chunks for a rewrite (see Chunk::try_claim_for_cleanup()) or if the
+   * transaction conflicted with a concurrent one and was rolled back.
+   */
+  bool _try_merge_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                         const std::vector<ChunkID>& chunk_ids);
+
+  constexpr static auto MERGE_THRESHOLD_FILL_RATIO = 0.5;
+  constexpr static auto MAX_CHUNKS_PER_MERGE = size_t{64};
+  constexpr static auto IDLE_DELAY = std::chrono::milliseconds{10'000};
+
+ private:
+  struct Delta {
+    std::weak_ptr<Chunk> chunk;
+    ChunkOffset size;
+  };
+
+  DeferredChunkRemoval _merged_chunks;
+  std::unordered_map<std::string, std::vector<Delta>> _deltas;
+  std::mutex _merge_mutex;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
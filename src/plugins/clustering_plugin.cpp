@@ -0,0 +1,277 @@
+#include "clustering_plugin.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/assert.hpp"
+#include "utils/chunk_replacement.hpp"
+#include "utils/log_manager.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/string_utils.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Returns the stored column that the predicate compares to constants or placeholders only, if any.
+std::shared_ptr<LQPColumnExpression> clustering_candidate_column(const AbstractPredicateExpression& predicate) {
+  const auto predicate_condition = predicate.predicate_condition;
+  if (predicate_condition == PredicateCondition::NotEquals ||
+      (!is_binary_numeric_predicate_condition(predicate_condition) &&
+       !is_between_predicate_condition(predicate_condition))) {
+    return nullptr;
+  }
+
+  auto column_expression = std::shared_ptr<LQPColumnExpression>{};
+  for (const auto& argument : predicate.arguments) {
+    if (argument->type == ExpressionType::LQPColumn) {
+      if (column_expression) {
+        // Column-to-column comparisons do not benefit from clustering.
+        return nullptr;
+      }
+      column_expression = std::static_pointer_cast<LQPColumnExpression>(argument);
+    } else if (argument->type != ExpressionType::Value && argument->type != ExpressionType::Placeholder &&
+               argument->type != ExpressionType::CorrelatedParameter) {
+      return nullptr;
+    }
+  }
+  return column_expression;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+ClusteringPlugin::ClusteringKeysSetting::ClusteringKeysSetting()
+    : AbstractSetting("ClusteringPlugin.clustering_keys") {}
+
+const std::string& ClusteringPlugin::ClusteringKeysSetting::description() const {
+  static const auto description =
+      std::string{"Comma-separated list of table.column pairs by which the immutable chunks of a table are clustered"};
+  return description;
+}
+
+const std::string& ClusteringPlugin::ClusteringKeysSetting::get() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _value;
+}
+
+void ClusteringPlugin::ClusteringKeysSetting::set(const std::string& value) {
+  auto clustering_columns = std::unordered_map<std::string, std::string>{};
+  for (auto clustering_key : split_string_by_delimiter(value, ',')) {
+    boost::trim(clustering_key);
+    if (clustering_key.empty()) {
+      continue;
+    }
+
+    const auto table_and_column = split_string_by_delimiter(clustering_key, '.');
+    AssertInput(table_and_column.size() == 2 && !table_and_column[0].empty() && !table_and_column[1].empty(),
+                "Expected clustering key of the form 'table.column', got '" + clustering_key + "'.");
+    clustering_columns.insert_or_assign(table_and_column[0], table_and_column[1]);
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _value = value;
+  _clustering_columns = std::move(clustering_columns);
+}
+
+std::unordered_map<std::string, std::string> ClusteringPlugin::ClusteringKeysSetting::clustering_columns() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _clustering_columns;
+}
+
+ClusteringPlugin::ClusteringPlugin() : _clustering_keys_setting{std::make_shared<ClusteringKeysSetting>()} {}
+
+std::string ClusteringPlugin::description() const {
+  return "Chunk clustering plugin";
+}
+
+void ClusteringPlugin::start() {
+  _clustering_keys_setting->register_at_settings_manager();
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY, [&](size_t /*unused*/) {
+    _cluster_tables();
+  });
+}
+
+void ClusteringPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread.
+  _loop_thread.reset();
+  _clustering_keys_setting->unregister_at_settings_manager();
+  _reorganized_chunks.clear();
+}
+
+std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>>
+ClusteringPlugin::provided_user_executable_functions() {
+  return {{"ClusterTables", [&]() {
+             _cluster_tables();
+           }}};
+}
+
+size_t ClusteringPlugin::_cluster_tables() {
+  // Clustering can be triggered both by the loop thread and as a user-executable function.
+  const auto lock = std::lock_guard<std::mutex>{_cluster_mutex};
+  _reorganized_chunks.remove_invisible_chunks();
+
+  auto reorganized_chunk_count = size_t{0};
+  for (const auto& [table_name, column_id] : _clustering_keys()) {
+    const auto table = Hyrise::get().storage_manager.get_table(table_name);
+    if (table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
+
+    // Candidates are immutable chunks that are neither sorted by the clustering key nor logically deleted. Mutable
+    // chunks are still filled by Inserts and chunks without valid rows are left to the MvccDeletePlugin.
+    const auto sort_definition = SortColumnDefinition{column_id};
+    auto chunk_ids = std::vector<ChunkID>{};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id() ||
+          chunk->invalid_row_count() == chunk->size()) {
+        continue;
+      }
+
+      const auto& sorted_by = chunk->individually_sorted_by();
+      if (std::ranges::find(sorted_by, sort_definition) != sorted_by.end()) {
+        continue;
+      }
+
+      chunk_ids.emplace_back(chunk_id);
+      if (chunk_ids.size() == MAX_CHUNKS_PER_REORGANIZATION) {
+        break;
+      }
+    }
+
+    if (chunk_ids.empty() || !_try_cluster_chunks(table_name, table, chunk_ids, column_id)) {
+      continue;
+    }
+
+    reorganized_chunk_count += chunk_ids.size();
+    auto message = std::stringstream{};
+    message << "Clustered " << chunk_ids.size() << " chunk(s) of table '" << table_name << "' by column '"
+            << table->column_name(column_id) << "'.";
+    Hyrise::get().log_manager.add_message("ClusteringPlugin", message.str(), LogLevel::Info);
+  }
+
+  return reorganized_chunk_count;
+}
+
+std::unordered_map<std::string, ColumnID> ClusteringPlugin::_clustering_keys() const {
+  auto clustering_keys = _learn_clustering_keys();
+
+  for (const auto& [table_name, column_name] : _clustering_keys_setting->clustering_columns()) {
+    // Tables and columns might not exist (yet) when the setting is changed, so we silently skip unknown ones.
+    if (!Hyrise::get().storage_manager.has_table(table_name)) {
+      continue;
+    }
+
+    const auto table = Hyrise::get().storage_manager.get_table(table_name);
+    const auto column_names = table->column_names();
+    const auto column_name_iter = std::ranges::find(column_names, column_name);
+    if (column_name_iter == column_names.end()) {
+      continue;
+    }
+
+    const auto column_id = static_cast<ColumnID::base_type>(std::distance(column_names.begin(), column_name_iter));
+    clustering_keys.insert_or_assign(table_name, ColumnID{column_id});
+  }
+
+  return clustering_keys;
+}
+
+std::unordered_map<std::string, ColumnID> ClusteringPlugin::_learn_clustering_keys() {
+  const auto lqp_cache = Hyrise::get().default_lqp_cache;
+  if (!lqp_cache) {
+    return {};
+  }
+
+  auto column_weights = std::unordered_map<std::string, std::unordered_map<ColumnID, size_t>>{};
+  for (const auto& [_, entry] : lqp_cache->snapshot()) {
+    const auto frequency = entry.frequency.value_or(1);
+
+    visit_lqp(entry.value, [&](const auto& node) {
+      if (node->type != LQPNodeType::Predicate) {
+        return LQPVisitation::VisitInputs;
+      }
+
+      const auto predicate =
+          std::dynamic_pointer_cast<AbstractPredicateExpression>(static_cast<const PredicateNode&>(*node).predicate());
+      if (!predicate) {
+        return LQPVisitation::VisitInputs;
+      }
+
+      const auto column_expression = clustering_candidate_column(*predicate);
+      if (!column_expression) {
+        return LQPVisitation::VisitInputs;
+      }
+
+      const auto original_node = column_expression->original_node.lock();
+      if (!original_node || original_node->type != LQPNodeType::StoredTable) {
+        return LQPVisitation::VisitInputs;
+      }
+
+      const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+      column_weights[table_name][column_expression->original_column_id] += frequency;
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  auto clustering_keys = std::unordered_map<std::string, ColumnID>{};
+  for (const auto& [table_name, weights] : column_weights) {
+    if (!Hyrise::get().storage_manager.has_table(table_name)) {
+      continue;
+    }
+
+    // Prefer the lower ColumnID on ties to make the choice deterministic.
+    const auto& [column_id, _] = *std::ranges::max_element(weights, [](const auto& lhs, const auto& rhs) {
+      return lhs.second < rhs.second || (lhs.second == rhs.second && lhs.first > rhs.first);
+    });
+    clustering_keys.emplace(table_name, column_id);
+  }
+
+  return clustering_keys;
+}
+
+bool ClusteringPlugin::_try_cluster_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                           const std::vector<ChunkID>& chunk_ids, const ColumnID column_id) {
+  // The MvccDeletePlugin or the ChunkMergingPlugin might rewrite some of the chunks concurrently.
+  if (!table->try_claim_chunks_for_cleanup(chunk_ids)) {
+    return false;
+  }
+
+  // Sort the valid rows and append them as full chunks so that their value ranges are disjoint.
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{column_id}};
+  if (!try_replace_chunks(table_name, table, chunk_ids, sort_definitions)) {
+    return false;
+  }
+
+  for (const auto chunk_id : chunk_ids) {
+    _reorganized_chunks.add(table, chunk_id);
+  }
+
+  return true;
+}
+
+EXPORT_PLUGIN(ClusteringPlugin);
+
+}  // namespace hyrise
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/chunk_replacement.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Chunk pruning only skips chunks whose value ranges do not overlap with a predicate. For tables that are filled in
+ * insertion order, the ranges of most columns span nearly the whole domain in every chunk. This plugin reorganizes
+ * the immutable chunks of a table by a clustering key so that their pruning statistics become selective and scans on
+ * the key can use the chunks' sort order.
+ *
+ * The clustering key of a table is either configured explicitly via the setting "ClusteringPlugin.clustering_keys"
+ * (e.g., "lineitem.l_shipdate,orders.o_orderdate") or learned from the predicates of the plans in the LQP cache. In the
+ * latter case, the column that is most frequently filtered by range or equality predicates against constants is used.
+ *
+ * Reorganizing a batch of chunks happens in a single transaction: the valid rows are deleted, sorted by the key, and
+ * appended as new immutable chunks (see try_replace_chunks()), which are encoded and get fresh pruning statistics.
+ * Thus, concurrent transactions either see the old or the new chunks. The old chunks are removed physically once no
+ * active transaction can see them anymore.
+ */
+class ClusteringPlugin : public AbstractPlugin {
+  friend class ClusteringPluginTest;
+
+ public:
+  /**
+   * Setting that holds the explicitly configured clustering keys as comma-separated `table.column` pairs. Explicit
+   * keys take precedence over learned ones.
+   */
+  class ClusteringKeysSetting : public AbstractSetting {
+   public:
+    ClusteringKeysSetting();
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+    // Maps table names to the names of their clustering columns.
+    std::unordered_map<std::string, std::string> clustering_columns() const;
+
+   private:
+    mutable std::mutex _mutex;
+    std::string _value;
+    std::unordered_map<std::string, std::string> _clustering_columns;
+  };
+
+  ClusteringPlugin();
+
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>> provided_user_executable_functions() final;
+
+ protected:
+  /**
+   * Removes chunks of previous runs that are no longer visible, then clusters up to MAX_CHUNKS_PER_REORGANIZATION
+   * chunks per table that are not yet sorted by the table's clustering key. Returns the number of reorganized chunks.
+   */
+  size_t _cluster_tables();
+
+  /**
+   * Returns the clustering keys of all tables, merging the explicitly configured and the learned keys.
+   */
+  std::unordered_map<std::string, ColumnID> _clustering_keys() const;
+
+  /**
+   * Weights each stored column that is compared to a constant or placeholder by a PredicateNode in the cached LQPs by
+   * the plan's execution frequency and returns the column with the highest weight per table.
+   */
+  static std::unordered_map<std::string, ColumnID> _learn_clustering_keys();
+
+  /**
+   * Deletes the valid rows of the given chunks and reinserts them sorted by the clustering column in a single
+   * transaction. Returns false if another plugin has claimed one of the chunks for a rewrite (see
+   * Chunk::try_claim_for_cleanup()) or if the transaction conflicted with a concurrent one and was rolled back.
+   */
+  bool _try_cluster_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                           const std::vector<ChunkID>& chunk_ids, const ColumnID column_id);
+
+  constexpr static auto MAX_CHUNKS_PER_REORGANIZATION = size_t{16};
+  constexpr static auto IDLE_DELAY = std::chrono::milliseconds{10'000};
+
+ private:
+  std::shared_ptr<ClusteringKeysSetting> _clustering_keys_setting;
+
+  DeferredChunkRemoval _reorganized_chunks;
+  std::mutex _cluster_mutex;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
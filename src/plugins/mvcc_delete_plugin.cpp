@@ -1,5 +1,6 @@
 #include "mvcc_delete_plugin.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <iomanip>
 #include <memory>
@@ -8,6 +9,7 @@
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
@@ -15,10 +17,12 @@
 #include "operators/get_table.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "storage/mvcc_data.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/abstract_plugin.hpp"
 #include "utils/assert.hpp"
+#include "utils/chunk_replacement.hpp"
 #include "utils/log_manager.hpp"
 #include "utils/pausable_loop_thread.hpp"
 
@@ -29,21 +33,30 @@ std::string MvccDeletePlugin::description() const {
 }
 
 void MvccDeletePlugin::start() {
+  // The garbage collection shares the thread of the logical delete so that both never rewrite the same chunk.
   _loop_thread_logical_delete = std::make_unique<PausableLoopThread>(IDLE_DELAY_LOGICAL_DELETE, [&](size_t /*unused*/) {
     _logical_delete_loop();
+    _garbage_collection_loop();
   });
 
   _loop_thread_physical_delete =
       std::make_unique<PausableLoopThread>(IDLE_DELAY_PHYSICAL_DELETE, [&](size_t /*unused*/) {
         _physical_delete_loop();
       });
+
+  _loop_thread_mvcc_compaction =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_MVCC_COMPACTION, [&](size_t /*unused*/) {
+        _compact_mvcc_data_loop();
+      });
 }
 
 void MvccDeletePlugin::stop() {
   // Call destructor of PausableLoopThread to terminate its thread
   _loop_thread_logical_delete.reset();
   _loop_thread_physical_delete.reset();
-  _physical_delete_queue = {};
+  _loop_thread_mvcc_compaction.reset();
+  _chunks_to_delete.clear();
+  _compacted_mvcc_data.clear();
 }
 
 /**
@@ -91,11 +104,7 @@ void MvccDeletePlugin::_logical_delete_loop() {
         const auto success = _try_logical_delete(table_name, chunk_id, transaction_context);
 
         if (success) {
-          DebugAssert(table->get_chunk(chunk_id)->get_cleanup_commit_id(),
-                      "Chunk needs to be deleted logically before deleting it physically.");
-
-          const auto lock = std::lock_guard{_physical_delete_queue_mutex};
-          _physical_delete_queue.emplace(table, chunk_id);
+          _chunks_to_delete.add(table, chunk_id);
           saved_memory += chunk_memory;
           ++num_chunks;
         }
@@ -112,31 +121,133 @@ void MvccDeletePlugin::_logical_delete_loop() {
 }
 
 /**
- * This function processes the physical-delete-queue until it is empty.
+ * This function removes the logically deleted chunks that are no longer visible to any active transaction.
  */
 void MvccDeletePlugin::_physical_delete_loop() {
-  const auto lock = std::lock_guard{_physical_delete_queue_mutex};
+  _chunks_to_delete.remove_invisible_chunks();
+}
+
+/**
+ * This function releases the row versions of previously compacted MVCC data that no transaction can read anymore and
+ * compacts the MVCC data of immutable chunks whose rows are visible to all active transactions.
+ */
+void MvccDeletePlugin::_compact_mvcc_data_loop() {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto lock = std::lock_guard{_mvcc_compaction_mutex};
+
+  // Transactions that were active during the compaction might still read the row versions. They all have a snapshot
+  // that is not newer than the last CommitID at the time of the compaction.
+  const auto lowest_snapshot_commit_id = transaction_manager.get_lowest_active_snapshot_commit_id();
+  std::erase_if(_compacted_mvcc_data, [&](const auto& compacted_mvcc_data) {
+    const auto& [mvcc_data, compaction_commit_id] = compacted_mvcc_data;
+    if (lowest_snapshot_commit_id && *lowest_snapshot_commit_id <= compaction_commit_id) {
+      return false;
+    }
+
+    mvcc_data->release_row_versions();
+    return true;
+  });
+
+  // All inserts up to this CommitID are visible to all active transactions.
+  const auto visible_commit_id = lowest_snapshot_commit_id.value_or(transaction_manager.last_commit_id());
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
+
+    auto compacted_chunk_count = size_t{0};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id() || chunk->mvcc_data()->is_compacted()) {
+        continue;
+      }
+
+      // Chunks with many invalidated rows are consolidated by the logical delete instead.
+      const auto invalidated_rows_ratio = static_cast<double>(chunk->invalid_row_count()) / chunk->size();
+      const auto max_begin_cid = chunk->mvcc_data()->max_begin_cid.load();
+      if (max_begin_cid > visible_commit_id || invalidated_rows_ratio >= DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS) {
+        continue;
+      }
+
+      if (chunk->try_compact_mvcc_data()) {
+        _compacted_mvcc_data.emplace_back(chunk->mvcc_data(), transaction_manager.last_commit_id());
+        ++compacted_chunk_count;
+      }
+    }
+
+    if (compacted_chunk_count > 0) {
+      auto message = std::ostringstream{};
+      message << "Compacted MVCC data of " << compacted_chunk_count << " chunk(s) of " << table_name;
+      Hyrise::get().log_manager.add_message("MvccDeletePlugin", message.str(), LogLevel::Info);
+    }
+  }
+}
 
-  if (!_physical_delete_queue.empty()) {
-    const auto& [table, chunk_id] = _physical_delete_queue.front();
-    const auto& chunk = table->get_chunk(chunk_id);
+/**
+ * This function rewrites chunks with many dead rows without them and frees the end CIDs of dead rows in compacted MVCC
+ * data.
+ */
+void MvccDeletePlugin::_garbage_collection_loop() {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
 
-    DebugAssert(chunk, "Chunk does not exist. Physical Delete can not be applied.");
+  // Rows that were invalidated up to this CommitID are invisible to all active and future transactions.
+  const auto horizon_commit_id =
+      transaction_manager.get_lowest_active_snapshot_commit_id().value_or(transaction_manager.last_commit_id());
 
-    if (chunk->get_cleanup_commit_id()) {
-      // Check whether there are still active transactions that might use the chunk.
-      auto transactions_conflict = false;
-      const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
 
-      if (lowest_snapshot_commit_id) {
-        transactions_conflict = *chunk->get_cleanup_commit_id() > *lowest_snapshot_commit_id;
+    auto chunk_ids = std::vector<ChunkID>{};
+    auto dead_row_count = size_t{0};
+    auto collected_end_cid_count = size_t{0};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id() || chunk->invalid_row_count() == 0) {
+        continue;
       }
 
-      if (!transactions_conflict) {
-        _delete_chunk_physically(table, chunk_id);
-        _physical_delete_queue.pop();
+      const auto& mvcc_data = chunk->mvcc_data();
+      const auto chunk_dead_row_count = mvcc_data->dead_row_count(horizon_commit_id, chunk->size());
+      const auto dead_rows_ratio = static_cast<double>(chunk_dead_row_count) / chunk->size();
+      if (dead_rows_ratio < GARBAGE_COLLECTION_THRESHOLD_PERCENTAGE_DEAD_ROWS ||
+          chunk_ids.size() == MAX_CHUNKS_PER_GARBAGE_COLLECTION) {
+        if (mvcc_data->is_compacted()) {
+          collected_end_cid_count += mvcc_data->collect_garbage(horizon_commit_id);
+        }
+        continue;
       }
+
+      // The ChunkMergingPlugin or the ClusteringPlugin might rewrite the chunk concurrently.
+      if (!chunk->try_claim_for_cleanup()) {
+        continue;
+      }
+
+      chunk_ids.emplace_back(chunk_id);
+      dead_row_count += chunk_dead_row_count;
+    }
+
+    if (collected_end_cid_count > 0) {
+      auto message = std::ostringstream{};
+      message << "Freed the end CIDs of " << collected_end_cid_count << " dead row(s) of " << table_name;
+      Hyrise::get().log_manager.add_message("MvccDeletePlugin", message.str(), LogLevel::Info);
+    }
+
+    if (chunk_ids.empty() || !_try_rewrite_chunks(table_name, table, chunk_ids)) {
+      continue;
     }
+
+    for (const auto chunk_id : chunk_ids) {
+      _chunks_to_delete.add(table, chunk_id);
+    }
+
+    auto message = std::ostringstream{};
+    message << "Removed " << dead_row_count << " dead row(s) of " << table_name << " by rewriting " << chunk_ids.size()
+            << " chunk(s)";
+    Hyrise::get().log_manager.add_message("MvccDeletePlugin", message.str(), LogLevel::Info);
   }
 }
 
@@ -149,6 +260,11 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
   Assert(chunk_id < (table->chunk_count() - 1),
          "MVCC Logical Delete should not be applied on the last/current mutable chunk.");
 
+  // The ChunkMergingPlugin or the ClusteringPlugin might rewrite the chunk concurrently.
+  if (!chunk->try_claim_for_cleanup()) {
+    return false;
+  }
+
   // Create temporary referencing table that contains the given chunk only. Include all ChunksIDs of current table
   // except chunk_id for pruning in GetTable.
   auto excluded_chunk_ids = std::vector<ChunkID>(table->chunk_count() - 1);
@@ -175,6 +291,7 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
     // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed Update directly, that is
     // our job.
     transaction_context->rollback(RollbackReason::Conflict);
+    chunk->release_cleanup_claim();
     return false;
   }
 
@@ -184,14 +301,12 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
   return true;
 }
 
-void MvccDeletePlugin::_delete_chunk_physically(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
-  const auto& chunk = table->get_chunk(chunk_id);
-
-  Assert(chunk->get_cleanup_commit_id(),
-         "The cleanup commit id of the chunk is not set. This should have been done by the logical delete.");
-
-  // Usage checks have been passed. Apply physical delete now.
-  table->remove_chunk(chunk_id);
+bool MvccDeletePlugin::_try_rewrite_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                           const std::vector<ChunkID>& chunk_ids) {
+  // The chunks have been claimed by _garbage_collection_loop(). Unlike the Update of the logical delete, AppendChunks
+  // does not write the valid rows to the mutable last chunk but packs them into new full chunks, which are encoded in
+  // the background.
+  return try_replace_chunks(table_name, table, chunk_ids);
 }
 
 EXPORT_PLUGIN(MvccDeletePlugin);
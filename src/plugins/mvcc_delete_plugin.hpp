@@ -4,16 +4,17 @@
 #include <memory>
 #include <mutex>
 #include <numeric>
-#include <queue>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest_prod.h"
 #include "hyrise.hpp"
 #include "storage/chunk.hpp"
 #include "types.hpp"
 #include "utils/abstract_plugin.hpp"
+#include "utils/chunk_replacement.hpp"
 #include "utils/pausable_loop_thread.hpp"
 #include "utils/singleton.hpp"
 
@@ -30,8 +31,18 @@ namespace hyrise {
  * recognizing chunks with high numbers of invalidated rows and fully invalidates them.
  * The physical delete checks if chunks are not visible anymore for other transactions and
  * removes the chunk from the table completely.
+ * Additionally, the plugin compacts the MVCC data of old immutable chunks whose rows are visible
+ * to all active transactions (see MvccData::try_compact()). Validate then uses a bitmap of the
+ * invalidated rows and the begin and end CIDs of each row are freed once all transactions that
+ * were active during the compaction have finished.
+ * Independent of the invalidation level and the hotness of a chunk, the plugin collects garbage: rows that were
+ * invalidated before the lowest active snapshot are dead, i.e., invisible to all current and future transactions.
+ * Chunks with enough dead rows are rewritten without them. Their valid rows are deleted and appended as full chunks
+ * (see try_replace_chunks()), which are encoded in the background, and the old chunks are deleted physically like the
+ * ones of the logical delete. For other chunks with compacted MVCC data, the end CIDs of dead rows are freed.
  */
 class MvccDeletePlugin : public AbstractPlugin {
+  friend class ChunkMergingPluginTest;
   friend class MvccDeletePluginTest;
   friend class MvccDeletePluginSystemTest;
 
@@ -49,26 +60,38 @@ class MvccDeletePlugin : public AbstractPlugin {
    * the candidate chunk was last modified
    * IDLE_DELAY_LOGICAL_DELETE: sleep after execution of logical delete
    * IDLE_DELAY_PHYSICAL_DELETE: sleep after execution of physical delete
+   * IDLE_DELAY_MVCC_COMPACTION: sleep after compacting MVCC data
+   * GARBAGE_COLLECTION_THRESHOLD_PERCENTAGE_DEAD_ROWS: the percentage of dead rows in a chunk to be rewritten by the
+   * garbage collection, which runs after each logical delete
+   * MAX_CHUNKS_PER_GARBAGE_COLLECTION: the number of chunks of a table that are rewritten in a single transaction
    */
   constexpr static double DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS = 0.6;
   constexpr static CommitID DELETE_THRESHOLD_LAST_COMMIT = CommitID{100};
   constexpr static std::chrono::milliseconds IDLE_DELAY_LOGICAL_DELETE = std::chrono::milliseconds(1000);
   constexpr static std::chrono::milliseconds IDLE_DELAY_PHYSICAL_DELETE = std::chrono::milliseconds(1000);
+  constexpr static std::chrono::milliseconds IDLE_DELAY_MVCC_COMPACTION = std::chrono::milliseconds(1000);
+  constexpr static double GARBAGE_COLLECTION_THRESHOLD_PERCENTAGE_DEAD_ROWS = 0.25;
+  constexpr static size_t MAX_CHUNKS_PER_GARBAGE_COLLECTION = 16;
 
  private:
-  using TableAndChunkID = std::pair<const std::shared_ptr<Table>, ChunkID>;
-
   void _logical_delete_loop();
   void _physical_delete_loop();
+  void _compact_mvcc_data_loop();
+  void _garbage_collection_loop();
 
   static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
                                   const std::shared_ptr<TransactionContext>& transaction_context);
-  static void _delete_chunk_physically(const std::shared_ptr<Table>& table, ChunkID chunk_id);
+  static bool _try_rewrite_chunks(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                  const std::vector<ChunkID>& chunk_ids);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete,
+      _loop_thread_mvcc_compaction;
 
-  std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete;
+  DeferredChunkRemoval _chunks_to_delete;
 
-  std::mutex _physical_delete_queue_mutex;
-  std::queue<TableAndChunkID> _physical_delete_queue;
+  // Compacted MVCC data whose row versions are released once the lowest active snapshot has passed the CommitID.
+  std::mutex _mvcc_compaction_mutex;
+  std::vector<std::pair<std::shared_ptr<MvccData>, CommitID>> _compacted_mvcc_data;
 };
 
 }  // namespace hyrise
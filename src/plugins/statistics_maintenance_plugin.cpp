@@ -0,0 +1,239 @@
+#include "statistics_maintenance_plugin.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/base_attribute_statistics.hpp"
+#include "statistics/segment_sketch.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/histogram_domain.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/log_manager.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+template <typename T>
+std::shared_ptr<AbstractHistogram<T>> scaled_histogram(
+    const std::shared_ptr<const AbstractHistogram<T>>& previous_histogram, const T& min, const T& max,
+    const Cardinality value_count, const Cardinality distinct_count) {
+  const auto domain = previous_histogram ? previous_histogram->domain() : HistogramDomain<T>{};
+  const auto to_domain = [&](const T& value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return domain.contains(value) ? value : domain.string_to_domain(value);
+    } else {
+      return value;
+    }
+  };
+
+  if (!previous_histogram || previous_histogram->bin_count() == 0 || previous_histogram->total_count() <= 0 ||
+      previous_histogram->total_distinct_count() <= 0) {
+    return GenericHistogram<T>::with_single_bin(to_domain(min), to_domain(max), value_count, distinct_count, domain);
+  }
+
+  // The merged sketches do not tell how the values are distributed. Thus, the bins of the previous histogram are kept
+  // and scaled to the new value and distinct counts. The outer bins are extended to the current value range.
+  const auto bin_count = previous_histogram->bin_count();
+  const auto height_scale = value_count / previous_histogram->total_count();
+  const auto distinct_count_scale = distinct_count / previous_histogram->total_distinct_count();
+
+  auto bin_minima = std::vector<T>(bin_count);
+  auto bin_maxima = std::vector<T>(bin_count);
+  auto bin_heights = std::vector<HistogramCountType>(bin_count);
+  auto bin_distinct_counts = std::vector<HistogramCountType>(bin_count);
+  for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+    bin_minima[bin_id] = previous_histogram->bin_minimum(bin_id);
+    bin_maxima[bin_id] = previous_histogram->bin_maximum(bin_id);
+    bin_heights[bin_id] = previous_histogram->bin_height(bin_id) * height_scale;
+    bin_distinct_counts[bin_id] =
+        std::min(previous_histogram->bin_distinct_count(bin_id) * distinct_count_scale, bin_heights[bin_id]);
+  }
+
+  bin_minima.front() = std::min(bin_minima.front(), to_domain(min));
+  bin_maxima.back() = std::max(bin_maxima.back(), to_domain(max));
+
+  return std::make_shared<GenericHistogram<T>>(std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+                                               std::move(bin_distinct_counts), domain);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::string StatisticsMaintenancePlugin::description() const {
+  return "Statistics maintenance plugin";
+}
+
+void StatisticsMaintenancePlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY, [&](size_t /*unused*/) {
+    _update_stale_statistics();
+  });
+}
+
+void StatisticsMaintenancePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread.
+  _loop_thread.reset();
+  _invalid_row_counts.clear();
+}
+
+std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>>
+StatisticsMaintenancePlugin::provided_user_executable_functions() {
+  return {{"UpdateStaleStatistics", [&]() {
+             _update_stale_statistics();
+           }}};
+}
+
+size_t StatisticsMaintenancePlugin::_update_stale_statistics() {
+  // The update can be triggered both by the loop thread and as a user-executable function.
+  const auto lock = std::lock_guard<std::mutex>{_update_mutex};
+  auto updated_table_count = size_t{0};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto table_statistics = table->table_statistics();
+    if (!table_statistics) {
+      continue;
+    }
+
+    auto previous_invalid_row_count = uint64_t{0};
+    const auto invalid_row_count_iter = _invalid_row_counts.find(table_name);
+    if (invalid_row_count_iter != _invalid_row_counts.end() &&
+        invalid_row_count_iter->second.table.lock() == table) {
+      previous_invalid_row_count = invalid_row_count_iter->second.invalid_row_count;
+    }
+
+    const auto statistics_row_count = static_cast<uint64_t>(std::max(table_statistics->row_count, Cardinality{0}));
+    const auto row_count = static_cast<uint64_t>(table->row_count());
+    const auto invalid_row_count = _invalid_row_count(*table);
+
+    // Inserted rows and removed chunks (e.g., by the MvccDeletePlugin) change the row count. Deleted and updated rows
+    // are invalidated.
+    const auto changed_row_count =
+        std::max(row_count, statistics_row_count) - std::min(row_count, statistics_row_count);
+    const auto modified_row_count =
+        changed_row_count + (invalid_row_count - std::min(invalid_row_count, previous_invalid_row_count));
+
+    const auto stale_threshold =
+        std::max(STALE_MIN_MODIFIED_ROWS,
+                 static_cast<uint64_t>(STALE_MODIFIED_ROWS_RATIO * static_cast<double>(statistics_row_count)));
+    if (modified_row_count < stale_threshold) {
+      continue;
+    }
+
+    table->set_table_statistics(_merge_chunk_sketches(*table, *table_statistics));
+    _invalid_row_counts.insert_or_assign(table_name, InvalidRowCount{table, invalid_row_count});
+    ++updated_table_count;
+
+    auto message = std::stringstream{};
+    message << "Updated statistics of table '" << table_name << "' (" << statistics_row_count << " -> " << row_count
+            << " rows, " << modified_row_count << " modified rows).";
+    Hyrise::get().log_manager.add_message("StatisticsMaintenancePlugin", message.str(), LogLevel::Info);
+  }
+
+  if (updated_table_count > 0) {
+    // Cached plans were optimized using the outdated statistics.
+    Hyrise::get().default_lqp_cache->clear();
+    Hyrise::get().default_pqp_cache->clear();
+  }
+
+  return updated_table_count;
+}
+
+std::shared_ptr<TableStatistics> StatisticsMaintenancePlugin::_merge_chunk_sketches(
+    Table& table, const TableStatistics& table_statistics) {
+  const auto column_count = table.column_count();
+  auto merged_sketches = ChunkSketches(column_count);
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    // Chunks that were not compressed by a ChunkCompressionTask (e.g., chunks of imported tables) are sketched once
+    // here. The sketches of mutable chunks are not stored as rows are still appended to them.
+    auto chunk_sketches = chunk->sketches();
+    if (!chunk_sketches) {
+      const auto generated_sketches = generate_chunk_sketches(*chunk);
+      if (!chunk->is_mutable()) {
+        chunk->set_sketches(generated_sketches);
+      }
+      chunk_sketches = generated_sketches;
+    }
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      merged_sketches[column_id].merge((*chunk_sketches)[column_id]);
+    }
+  }
+
+  const auto row_count = static_cast<Cardinality>(table.row_count());
+  auto column_statistics = std::vector<std::shared_ptr<const BaseAttributeStatistics>>{column_count};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& sketch = merged_sketches[column_id];
+
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+      const auto null_value_count = std::min(static_cast<Cardinality>(sketch.null_value_count), row_count);
+      output_column_statistics->set_statistics_object(
+          std::make_shared<NullValueRatioStatistics>(row_count == 0 ? 0.0 : null_value_count / row_count));
+
+      const auto value_count = row_count - null_value_count;
+      if (value_count > 0 && !variant_is_null(sketch.min)) {
+        const auto distinct_count = std::clamp(std::round(sketch.distinct_values.estimate()), 1.0, value_count);
+
+        const auto previous_column_statistics = std::dynamic_pointer_cast<const AttributeStatistics<ColumnDataType>>(
+            table_statistics.column_statistics[column_id]);
+        const auto previous_histogram =
+            previous_column_statistics ? std::dynamic_pointer_cast<const AbstractHistogram<ColumnDataType>>(
+                                             previous_column_statistics->histogram)
+                                       : nullptr;
+
+        output_column_statistics->set_statistics_object(
+            scaled_histogram(previous_histogram, boost::get<ColumnDataType>(sketch.min),
+                              boost::get<ColumnDataType>(sketch.max), value_count, distinct_count));
+      }
+
+      column_statistics[column_id] = output_column_statistics;
+    });
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+}
+
+uint64_t StatisticsMaintenancePlugin::_invalid_row_count(const Table& table) {
+  auto invalid_row_count = uint64_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk) {
+      invalid_row_count += chunk->invalid_row_count();
+    }
+  }
+  return invalid_row_count;
+}
+
+EXPORT_PLUGIN(StatisticsMaintenancePlugin);
+
+}  // namespace hyrise
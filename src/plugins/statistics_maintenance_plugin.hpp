@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+class Table;
+class TableStatistics;
+
+/**
+ * Table statistics are created when a table is added to the StorageManager or imported. Afterwards, they do not
+ * change, even if the table grows or shrinks by orders of magnitude. Thus, cardinality estimates for modified tables
+ * become increasingly wrong and the optimizer (e.g., the JoinOrderingRule) picks bad plans.
+ *
+ * This plugin periodically checks how many rows of each table have been inserted or invalidated since its statistics
+ * were created. If this number exceeds a threshold relative to the row count the statistics were created for, the
+ * statistics are updated in the background and replace the old ones. Afterwards, the plan caches are cleared since
+ * the cached plans were optimized based on the outdated statistics.
+ *
+ * Rebuilding the histograms of large tables from scratch is expensive. Instead, the statistics are updated from the
+ * SegmentSketches that the ChunkCompressionTask stores for each compressed chunk. Only chunks without sketches (i.e.,
+ * mutable chunks and chunks that were never compressed by the task) are scanned.
+ */
+class StatisticsMaintenancePlugin : public AbstractPlugin {
+  friend class StatisticsMaintenancePluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>> provided_user_executable_functions() final;
+
+ protected:
+  /**
+   * Updates the statistics of all tables with stale statistics and clears the plan caches if any statistics were
+   * updated. Returns the number of tables whose statistics were updated.
+   */
+  size_t _update_stale_statistics();
+
+  /**
+   * Statistics are stale if the number of inserted or invalidated rows since their creation is at least
+   * STALE_MODIFIED_ROWS_RATIO of the row count they were created for and at least STALE_MIN_MODIFIED_ROWS.
+   */
+  constexpr static auto STALE_MODIFIED_ROWS_RATIO = 0.1;
+  constexpr static auto STALE_MIN_MODIFIED_ROWS = uint64_t{1'000};
+
+  constexpr static auto IDLE_DELAY = std::chrono::milliseconds{5'000};
+
+ private:
+  // Merges the sketches of all chunks into new statistics. The row count, null value ratios, and distinct counts are
+  // taken from the sketches. As the sketches do not describe the value distribution, the bins of the previous
+  // histograms are kept, scaled to the new counts, and extended to the new value range.
+  static std::shared_ptr<TableStatistics> _merge_chunk_sketches(Table& table, const TableStatistics& table_statistics);
+
+  static uint64_t _invalid_row_count(const Table& table);
+
+  // Number of invalidated rows of a table when its statistics were last recreated by this plugin. Tables whose
+  // statistics were not created by this plugin are assumed to have had no invalidated rows at that point.
+  struct InvalidRowCount {
+    std::weak_ptr<const Table> table;
+    uint64_t invalid_row_count;
+  };
+
+  std::unordered_map<std::string, InvalidRowCount> _invalid_row_counts;
+  std::mutex _update_mutex;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
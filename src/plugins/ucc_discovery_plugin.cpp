@@ -285,8 +285,9 @@ bool UccDiscoveryPlugin::_uniqueness_holds_across_segments(
       const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(source_segment);
       if (dictionary_segment) {
         // Directly insert dictionary entries.
-        const auto& dictionary = dictionary_segment->dictionary();
-        distinct_values_across_segments.insert(dictionary->cbegin(), dictionary->cend());
+        for (const auto& value : *dictionary_segment->dictionary()) {
+          distinct_values_across_segments.emplace(value);
+        }
       } else if (value_segment && !value_segment->is_nullable()) {
         const auto& values = value_segment->values();
         distinct_values_across_segments.insert(values.cbegin(), values.cend());
@@ -102,10 +102,13 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     SegmentEncodingSpec{EncodingType::Unencoded},
     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger},
     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking},
+    SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::FixedWidthInteger},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::FrameOfReference},
     SegmentEncodingSpec{EncodingType::LZ4},
+    SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::FixedWidthInteger},
+    SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::RunLength}};
 
 template <typename EnumType>
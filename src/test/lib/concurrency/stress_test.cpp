@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -609,6 +610,67 @@ TEST_F(StressTest, ConcurrentInsertsSetChunksImmutable) {
   EXPECT_FALSE(table->last_chunk()->pruning_statistics());
 }
 
+TEST_F(StressTest, ConcurrentShardedInserts) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{3}, UseMvcc::Yes);
+  const auto shard_count = uint32_t{4};
+  table->set_insert_shard_count(shard_count);
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  const auto values_to_insert =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  values_to_insert->append({int32_t{1}});
+  values_to_insert->append({int32_t{1}});
+
+  const auto insert_count = 19 * (HYRISE_DEBUG && HYRISE_WITH_ADDR_UB_LEAK_SAN ? 1 : DEFAULT_LOAD_FACTOR) + 1;
+  const auto thread_count = uint32_t{100};
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(thread_count);
+
+  for (auto thread_id = uint32_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto iteration = uint32_t{0}; iteration < insert_count; ++iteration) {
+        const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+        const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+        const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+        insert->set_transaction_context(transaction_context);
+        table_wrapper->execute();
+        insert->execute();
+        EXPECT_FALSE(insert->execute_failed());
+        transaction_context->commit();
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+
+  const auto inserted_rows = insert_count * thread_count * 2;
+  EXPECT_EQ(table->row_count(), inserted_rows);
+
+  // Each shard has at most one tail chunk that is not full. All other chunks are full, immutable, and encoded.
+  const auto append_lock = table->acquire_append_mutex();
+  const auto tail_chunk_ids = table->insert_tail_chunk_ids();
+  EXPECT_LE(tail_chunk_ids.size(), shard_count);
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    ASSERT_TRUE(chunk);
+    if (std::ranges::find(tail_chunk_ids, chunk_id) != tail_chunk_ids.end()) {
+      EXPECT_TRUE(chunk->is_mutable());
+      continue;
+    }
+
+    EXPECT_EQ(chunk->size(), 3);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(std::static_pointer_cast<AbstractEncodedSegment>(chunk->get_segment(ColumnID{0})));
+  }
+}
+
 // Consuming operators register at their inputs and deregister when they are executed. Thus, operators can clear
 // intermediate results. Consumer deregistration must work properly in concurrent scenarios.
 TEST_F(StressTest, OperatorRegistration) {
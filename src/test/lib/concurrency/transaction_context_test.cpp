@@ -11,7 +11,10 @@
 #include "operators/abstract_read_write_operator.hpp"
 #include "operators/delete.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -31,6 +34,27 @@ class TransactionContextTest : public BaseTest {
   TransactionManager& manager() {
     return Hyrise::get().transaction_manager;
   }
+
+  static std::shared_ptr<Validate> read_table(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table_op = std::make_shared<GetTable>(table_name);
+    const auto validate_op = std::make_shared<Validate>(get_table_op);
+    validate_op->set_transaction_context_recursively(context);
+    get_table_op->execute();
+    validate_op->execute();
+    return validate_op;
+  }
+
+  static void insert_row(const std::shared_ptr<TransactionContext>& context) {
+    const auto values = std::make_shared<Table>(
+        Hyrise::get().storage_manager.get_table(table_name)->column_definitions(), TableType::Data);
+    values->append({1.0f, 1});
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto insert_op = std::make_shared<Insert>(table_name, table_wrapper);
+    insert_op->set_transaction_context(context);
+    insert_op->execute();
+  }
 };
 
 /**
@@ -161,6 +185,102 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, IsolationLevel) {
+  EXPECT_EQ(manager().new_transaction_context(AutoCommit::No)->isolation_level(), IsolationLevel::SnapshotIsolation);
+  EXPECT_EQ(manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable)->isolation_level(),
+            IsolationLevel::Serializable);
+}
+
+TEST_F(TransactionContextTest, SnapshotIsolationAllowsWriteSkew) {
+  auto context_1 = manager().new_transaction_context(AutoCommit::No);
+  auto context_2 = manager().new_transaction_context(AutoCommit::No);
+
+  // Both transactions read the table and insert a row the other one does not see. There is no serial order in which
+  // both would have read the same rows.
+  read_table(context_1);
+  read_table(context_2);
+  insert_row(context_1);
+  insert_row(context_2);
+
+  context_1->commit();
+  context_2->commit();
+  EXPECT_EQ(context_1->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+}
+
+TEST_F(TransactionContextTest, SerializablePreventsWriteSkew) {
+  auto context_1 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+  auto context_2 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+
+  read_table(context_1);
+  read_table(context_2);
+  insert_row(context_1);
+  insert_row(context_2);
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+  context_1->commit();
+  EXPECT_EQ(context_1->phase(), TransactionPhase::Committed);
+
+  // The row inserted by context_1 is a phantom for context_2. context_2 is rolled back, but still consumes its commit
+  // id so that subsequent transactions are not blocked.
+  context_2->commit();
+  EXPECT_EQ(context_2->phase(), TransactionPhase::RolledBackAfterConflict);
+  EXPECT_TRUE(context_2->aborted());
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + 2);
+
+  const auto validate_op = read_table(manager().new_transaction_context(AutoCommit::Yes));
+  EXPECT_EQ(validate_op->get_output()->row_count(), 4);
+}
+
+TEST_F(TransactionContextTest, SerializableDetectsConcurrentDelete) {
+  auto context_1 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+  auto context_2 = manager().new_transaction_context(AutoCommit::No);
+
+  read_table(context_1);
+  insert_row(context_1);
+
+  // context_2 deletes all rows that context_1 has read.
+  const auto delete_op = std::make_shared<Delete>(read_table(context_2));
+  delete_op->set_transaction_context(context_2);
+  delete_op->execute();
+  context_2->commit();
+
+  context_1->commit();
+  EXPECT_EQ(context_1->phase(), TransactionPhase::RolledBackAfterConflict);
+}
+
+TEST_F(TransactionContextTest, SerializableReadOnlyTransactionsDoNotConflict) {
+  auto context_1 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+  auto context_2 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+
+  // A transaction that only reads is serialized at its snapshot.
+  read_table(context_1);
+  insert_row(context_2);
+  context_2->commit();
+  context_1->commit();
+  EXPECT_EQ(context_1->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+}
+
+TEST_F(TransactionContextTest, SerializableCommitsWithoutConcurrentModifications) {
+  auto context_1 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+  read_table(context_1);
+  insert_row(context_1);
+
+  // Transactions that committed before the snapshot of context_1 do not conflict.
+  auto context_2 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+  read_table(context_2);
+  context_1->commit();
+  EXPECT_EQ(context_1->phase(), TransactionPhase::Committed);
+
+  auto context_3 = manager().new_transaction_context(AutoCommit::No, IsolationLevel::Serializable);
+  read_table(context_3);
+  insert_row(context_3);
+  context_3->commit();
+  EXPECT_EQ(context_3->phase(), TransactionPhase::Committed);
+  context_2->commit();
+}
+
 TEST_F(TransactionContextTest, CommitWithFailedOperator) {
   auto context = manager().new_transaction_context(AutoCommit::No);
   context->rollback(RollbackReason::Conflict);
@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "base_test.hpp"
@@ -11,8 +13,19 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return Hyrise::get().transaction_manager._active_snapshot_commit_ids;
+  static std::unordered_multiset<CommitID> get_active_snapshot_commit_ids() {
+    const auto& manager = Hyrise::get().transaction_manager;
+    auto active_snapshot_commit_ids = manager._overflowing_snapshot_commit_ids;
+    for (const auto& slot : manager._active_snapshot_slots) {
+      if (slot.snapshot_commit_id != MAX_COMMIT_ID) {
+        active_snapshot_commit_ids.insert(slot.snapshot_commit_id);
+      }
+    }
+    return active_snapshot_commit_ids;
+  }
+
+  static size_t active_snapshot_slot_count() {
+    return TransactionManager::ACTIVE_SNAPSHOT_SLOT_COUNT;
   }
 
   static void register_transaction(CommitID snapshot_commit_id) {
@@ -46,30 +59,24 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t1_snapshot_commit_id));
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t2_snapshot_commit_id));
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t3_snapshot_commit_id));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
 
   t1_context->commit();
   deregister_transaction(t1_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t1_context->snapshot_commit_id()));
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t3_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t3_context->commit();
   deregister_transaction(t3_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t2_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t2_context->commit();
@@ -84,4 +91,60 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   register_transaction(t3_snapshot_commit_id);
 }
 
+TEST_F(TransactionManagerTest, TrackMoreActiveCommitIDsThanSlots) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto transaction_count = active_snapshot_slot_count() + 10;
+
+  for (auto commit_id = CommitID{1}; commit_id <= transaction_count; ++commit_id) {
+    register_transaction(commit_id);
+  }
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), transaction_count);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{1});
+
+  // Deregister in the order of registration, so that the lowest snapshot-commit-ids are eventually stored only in the
+  // overflow multiset.
+  for (auto commit_id = CommitID{1}; commit_id < transaction_count; ++commit_id) {
+    deregister_transaction(commit_id);
+    EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{commit_id + 1});
+  }
+
+  deregister_transaction(CommitID{static_cast<CommitID::base_type>(transaction_count)});
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, DeregisterUnknownSnapshotCommitID) {
+  register_transaction(CommitID{1});
+  deregister_transaction(CommitID{1});
+  EXPECT_THROW(deregister_transaction(CommitID{1}), std::logic_error);
+  EXPECT_THROW(deregister_transaction(CommitID{2}), std::logic_error);
+}
+
+TEST_F(TransactionManagerTest, ConcurrentTransactions) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto long_running_context = manager.new_transaction_context(AutoCommit::No);
+
+  constexpr auto THREAD_COUNT = size_t{16};
+  constexpr auto TRANSACTIONS_PER_THREAD = size_t{500};
+
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(THREAD_COUNT);
+  for (auto thread_id = size_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto transaction_id = size_t{0}; transaction_id < TRANSACTIONS_PER_THREAD; ++transaction_id) {
+        const auto transaction_context = manager.new_transaction_context(AutoCommit::No);
+        EXPECT_LE(*manager.get_lowest_active_snapshot_commit_id(), long_running_context->snapshot_commit_id());
+        transaction_context->commit();
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), long_running_context->snapshot_commit_id());
+}
+
 }  // namespace hyrise
@@ -146,6 +146,28 @@ TEST_F(ExpressionUtilsTest, ExpressionContainsCorrelatedParameter) {
       and_(greater_than_(a_a, correlated_parameter_(ParameterID{5}, a_a)), equals_(a_c, 7))));
 }
 
+TEST_F(ExpressionUtilsTest, ExpressionCopyForExecution) {
+  auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+
+  // Expressions without per-execution state are shared.
+  const auto stateless_expression = and_(greater_than_(a_a, 5), equals_(a_c, 7));
+  EXPECT_EQ(expression_copy_for_execution(stateless_expression, copied_ops), stateless_expression);
+
+  // Expressions with correlated parameters or subqueries are copied.
+  const auto correlated_expression = greater_than_(a_a, correlated_parameter_(ParameterID{5}, a_a));
+  const auto correlated_copy = expression_copy_for_execution(correlated_expression, copied_ops);
+  EXPECT_NE(correlated_copy, correlated_expression);
+  EXPECT_EQ(*correlated_copy, *correlated_expression);
+
+  const auto pqp_subquery = std::make_shared<PQPSubqueryExpression>(std::make_shared<GetTable>("table_a"));
+  const auto expressions = expression_vector(stateless_expression, add_(pqp_subquery, value_(1)));
+  const auto copied_expressions = expressions_copy_for_execution(expressions, copied_ops);
+  ASSERT_EQ(copied_expressions.size(), 2);
+  EXPECT_EQ(copied_expressions[0], stateless_expression);
+  EXPECT_NE(copied_expressions[1], expressions[1]);
+  EXPECT_NE(find_pqp_subquery_expressions(copied_expressions[1]).at(0)->pqp, pqp_subquery->pqp);
+}
+
 TEST_F(ExpressionUtilsTest, CollectPQPSubqueryExpressionsSingle) {
   const auto pqp_subquery = std::make_shared<PQPSubqueryExpression>(std::make_shared<GetTable>("table_a"));
 
@@ -1,3 +1,5 @@
+#include <sstream>
+
 #include "base_test.hpp"
 #include "hyrise.hpp"
 #include "import_export/csv/csv_parser.hpp"
@@ -8,7 +10,28 @@
 
 namespace hyrise {
 
-class CsvParserTest : public BaseTest {};
+class CsvParserTest : public BaseTest {
+ protected:
+  static std::shared_ptr<Table> parse_stream(const std::string& content, const CsvMeta& meta,
+                                             const ChunkOffset chunk_size, const size_t read_block_size) {
+    auto stream = std::istringstream{content};
+    return CsvParser::_parse_stream(stream, meta, chunk_size, read_block_size);
+  }
+
+  static std::vector<size_t> find_row_ends(const std::string& content, const CsvMeta& meta) {
+    auto in_quotes = false;
+    return CsvParser::_find_row_ends(content, meta, 0, in_quotes);
+  }
+
+  static std::vector<size_t> find_row_ends(const std::string& content, const CsvMeta& meta, const size_t begin,
+                                           bool& in_quotes) {
+    return CsvParser::_find_row_ends(content, meta, begin, in_quotes);
+  }
+
+  static size_t row_search_segment_size() {
+    return CsvParser::ROW_SEARCH_SEGMENT_SIZE;
+  }
+};
 
 TEST_F(CsvParserTest, SingleFloatColumn) {
   const auto csv_file = std::string{"resources/test_data/csv/float.csv"};
@@ -342,4 +365,100 @@ TEST_F(CsvParserTest, ImmutableChunks) {
   EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
 }
 
+TEST_F(CsvParserTest, SmallReadBlocks) {
+  auto meta = CsvMeta{};
+  meta.columns = {{"a", "int", false}, {"b", "string", false}};
+  const auto content = std::string{"1,\"x\ny\"\n2,\"a,\"\"b\"\n3,c\n4,\"\"\n5,\"d\n\ne\"\n6,f\n7,g"};
+
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}}, TableType::Data);
+  expected_table->append({1, "x\ny"});
+  expected_table->append({2, "a,\"b"});
+  expected_table->append({3, "c"});
+  expected_table->append({4, ""});
+  expected_table->append({5, "d\n\ne"});
+  expected_table->append({6, "f"});
+  expected_table->append({7, "g"});
+
+  // Blocks that end within rows, quoted values, and chunks have to be carried over to the next block.
+  for (const auto read_block_size : {size_t{1}, size_t{5}, size_t{13}, size_t{1024}}) {
+    SCOPED_TRACE(read_block_size);
+    const auto table = parse_stream(content, meta, ChunkOffset{3}, read_block_size);
+    EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+    ASSERT_EQ(table->chunk_count(), 3);
+    EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 3);
+    EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 3);
+    EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 1);
+  }
+}
+
+TEST_F(CsvParserTest, BlocksSmallerThanChunk) {
+  auto meta = CsvMeta{};
+  meta.columns = {{"a", "int", false}, {"b", "string", false}};
+
+  // Every block holds fewer rows than a chunk, so blocks are extended until they contain a full chunk.
+  auto content = std::string{};
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}}, TableType::Data);
+  for (auto row_id = int32_t{0}; row_id < 10; ++row_id) {
+    const auto value = pmr_string(20, static_cast<char>('a' + row_id));
+    content += std::to_string(row_id) + ",\"" + std::string{value} + "\n\"\n";
+    expected_table->append({row_id, value + "\n"});
+  }
+
+  const auto table = parse_stream(content, meta, ChunkOffset{4}, 7);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  ASSERT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 4);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 4);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 2);
+}
+
+TEST_F(CsvParserTest, FindRowEndsIncrementally) {
+  auto meta = CsvMeta{};
+  const auto content = std::string{"1,\"a\nb\"\n2,c\n3,\"d\n\"\n"};
+
+  // Searching the content in pieces yields the same row ends as searching it at once, also if a piece ends within a
+  // quoted value.
+  for (auto split = size_t{0}; split <= content.size(); ++split) {
+    SCOPED_TRACE(split);
+    auto in_quotes = false;
+    auto row_ends = find_row_ends(content.substr(0, split), meta, 0, in_quotes);
+    const auto remaining_row_ends = find_row_ends(content, meta, split, in_quotes);
+    row_ends.insert(row_ends.end(), remaining_row_ends.begin(), remaining_row_ends.end());
+
+    EXPECT_EQ(row_ends, find_row_ends(content, meta));
+    EXPECT_FALSE(in_quotes);
+  }
+}
+
+TEST_F(CsvParserTest, FindRowEndsAcrossSegments) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Each row contains quoted delimiters and escaped quotes, so that segments start both within and outside of quoted
+  // values.
+  auto meta = CsvMeta{};
+  const auto rfc_row = std::string{"1,\"a\n\"\"\nb\"\n"};
+  const auto escaped_row = std::string{"1,\"a\n\\\"\nb\"\n"};
+
+  for (const auto& row : {rfc_row, escaped_row}) {
+    meta.config.escape = row == rfc_row ? '"' : '\\';
+    const auto row_count = 2 * row_search_segment_size() / row.size() + 7;
+
+    auto content = std::string{};
+    auto expected_row_ends = std::vector<size_t>{};
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      content += row;
+      expected_row_ends.push_back(content.size() - 1);
+    }
+
+    EXPECT_EQ(find_row_ends(content, meta), expected_row_ends);
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace hyrise
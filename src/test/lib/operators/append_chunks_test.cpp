@@ -0,0 +1,162 @@
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/append_chunks.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+class OperatorsAppendChunksTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three rows in chunks of two rows. The last chunk is still mutable.
+    _table = load_table("resources/test_data/tbl/int.tbl", ChunkOffset{2}, SetLastChunkImmutable::No);
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+
+    const auto values = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                                ChunkOffset{3});
+    for (auto value = int32_t{1}; value <= 5; ++value) {
+      values->append({value});
+    }
+    _values = std::make_shared<TableWrapper>(values);
+    _values->execute();
+  }
+
+  static size_t _visible_row_count(const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _values;
+};
+
+TEST_F(OperatorsAppendChunksTest, Name) {
+  const auto append_chunks = std::make_shared<AppendChunks>("table_a", _values);
+  EXPECT_EQ(append_chunks->name(), "AppendChunks");
+}
+
+TEST_F(OperatorsAppendChunksTest, AppendChunks) {
+  const auto sorted_by = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto append_chunks = std::make_shared<AppendChunks>("table_a", _values, sorted_by);
+  append_chunks->set_transaction_context(context);
+  append_chunks->execute();
+  ASSERT_FALSE(append_chunks->execute_failed());
+
+  // The input rows are packed into immutable chunks of the table's target chunk size. The formerly last chunk is left
+  // to Inserts.
+  ASSERT_EQ(_table->chunk_count(), 5);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->size(), 2);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 2);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->size(), 1);
+  EXPECT_EQ((*_table->get_chunk(ChunkID{3})->get_segment(ColumnID{0}))[ChunkOffset{0}], AllTypeVariant{3});
+  for (const auto chunk_id : {ChunkID{2}, ChunkID{3}, ChunkID{4}}) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_EQ(chunk->individually_sorted_by(), sorted_by);
+  }
+
+  // Until the commit, only the appending transaction sees the new rows.
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 3);
+  EXPECT_EQ(_visible_row_count(context), 8);
+
+  context->commit();
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 8);
+
+  // The committed chunks are encoded in the background.
+  const auto segment = _table->get_chunk(ChunkID{2})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<AbstractEncodedSegment>(segment));
+
+  // Subsequent Inserts first fill the formerly last chunk and do not write to the appended chunks.
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>("table_a", _values);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+  EXPECT_EQ(_table->chunk_count(), 7);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 2);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->size(), 1);
+}
+
+TEST_F(OperatorsAppendChunksTest, Rollback) {
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto append_chunks = std::make_shared<AppendChunks>("table_a", _values);
+  append_chunks->set_transaction_context(context);
+  append_chunks->execute();
+  context->rollback(RollbackReason::User);
+
+  ASSERT_EQ(_table->chunk_count(), 5);
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->invalid_row_count(), 2);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->invalid_row_count(), 2);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->invalid_row_count(), 1);
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 3);
+}
+
+TEST_F(OperatorsAppendChunksTest, EmptyInput) {
+  const auto empty_values = std::make_shared<TableWrapper>(
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data));
+  empty_values->execute();
+
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto append_chunks = std::make_shared<AppendChunks>("table_a", empty_values);
+  append_chunks->set_transaction_context(context);
+  append_chunks->execute();
+  context->commit();
+
+  EXPECT_EQ(_table->chunk_count(), 2);
+  EXPECT_TRUE(_table->last_chunk()->is_mutable());
+}
+
+TEST_F(OperatorsAppendChunksTest, EmptyLastChunk) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{2}, UseMvcc::Yes);
+  table->append_mutable_chunk();
+  Hyrise::get().storage_manager.add_table("table_b", table);
+
+  // The empty last chunk does not prevent appending chunks. It is skipped and left to Inserts.
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto append_chunks = std::make_shared<AppendChunks>("table_b", _values);
+  append_chunks->set_transaction_context(context);
+  append_chunks->execute();
+  ASSERT_FALSE(append_chunks->execute_failed());
+  context->commit();
+
+  ASSERT_EQ(table->chunk_count(), 4);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 0);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_EQ(table->row_count(), 5);
+
+  // Inserts fill the empty chunk before they append new chunks.
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>("table_b", _values);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+
+  ASSERT_EQ(table->chunk_count(), 6);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_EQ(table->row_count(), 10);
+}
+
+}  // namespace hyrise
@@ -21,6 +21,8 @@
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -1340,6 +1342,95 @@ TEST_P(OperatorsTableScanTest, SortedFlagMultipleChunksReferenced) {
   ASSERT_TRUE(chunk_sorted_by.empty());
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnSimdBp128DictionarySegment) {
+  // The first two blocks of the attribute vector only contain small value IDs, the last (partial) block contains NULLs.
+  // Thus, the scan skips or fully accepts some blocks without unpacking them.
+  const auto create_table = [&]() {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                         ChunkOffset{1'000});
+    for (auto row = int32_t{0}; row < 1'000; ++row) {
+      if (row < 256) {
+        table->append({row % 10});
+      } else if (row >= 768 && row % 7 == 0) {
+        table->append({NULL_VALUE});
+      } else {
+        table->append({1'000 + row});
+      }
+    }
+    table->last_chunk()->set_immutable();
+    return table;
+  };
+
+  const auto table = create_table();
+  ChunkEncoder::encode_all_chunks(table, {SegmentEncodingSpec{EncodingType::Dictionary,
+                                                              VectorCompressionType::SimdBp128}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_table_wrapper = std::make_shared<TableWrapper>(create_table());
+  expected_table_wrapper->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    for (const auto value : {int32_t{5}, int32_t{1'500}, int32_t{1'501}}) {
+      const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value);
+      scan->execute();
+      const auto expected_scan = create_table_scan(expected_table_wrapper, ColumnID{0}, predicate_condition, value);
+      expected_scan->execute();
+
+      EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanSplitChunk) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // A single large chunk is split into row ranges that are scanned by separate jobs.
+  constexpr auto ROW_COUNT = int32_t{20'000};
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             ChunkOffset{ROW_COUNT});
+  for (auto value = int32_t{0}; value < ROW_COUNT; ++value) {
+    table->append({value % 7 == 0 ? NULL_VALUE : AllTypeVariant{value % 100}});
+  }
+  table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto predicate_condition : {PredicateCondition::LessThan, PredicateCondition::IsNull}) {
+    // The measured costs of a previous scan could make the morsels larger than the chunk.
+    MorselDispatcher::reset_cost_statistics();
+
+    const auto value = predicate_condition == PredicateCondition::IsNull ? NULL_VALUE : AllTypeVariant{10};
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value);
+    scan->execute();
+
+    const auto& result = scan->get_output();
+    EXPECT_GT(result->chunk_count(), 1);
+
+    auto matched_rows = std::vector<bool>(ROW_COUNT);
+    for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+      const auto segment = std::static_pointer_cast<const ReferenceSegment>(
+          result->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      for (const auto& row_id : *segment->pos_list()) {
+        EXPECT_FALSE(matched_rows[row_id.chunk_offset]);
+        matched_rows[row_id.chunk_offset] = true;
+      }
+    }
+
+    for (auto chunk_offset = int32_t{0}; chunk_offset < ROW_COUNT; ++chunk_offset) {
+      const auto is_null = chunk_offset % 7 == 0;
+      const auto expected_match =
+          predicate_condition == PredicateCondition::IsNull ? is_null : !is_null && chunk_offset % 100 < 10;
+      EXPECT_EQ(matched_rows[chunk_offset], expected_match);
+    }
+  }
+}
+
 TEST_P(OperatorsTableScanTest, DeepCopyRetainsExcludedChunks) {
   const auto table_scan =
       create_table_scan(get_int_float_op(), ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
@@ -14,6 +14,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -207,6 +209,37 @@ TEST_F(OperatorsValidateTest, ChunkEntirelyVisible) {
   EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
 }
 
+TEST_F(OperatorsValidateTest, ValidateCompactedMvccData) {
+  const auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
+
+  const auto chunk_count = _test_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _test_table->get_chunk(chunk_id);
+    chunk->mvcc_data()->max_begin_cid = CommitID{0};
+    ASSERT_TRUE(chunk->try_compact_mvcc_data());
+  }
+
+  // Data table as input.
+  const auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(),
+                            load_table("resources/test_data/tbl/validate_output_validated.tbl", ChunkOffset{2}));
+
+  // Reference table as input.
+  const auto a = PQPColumnExpression::from_table(*_test_table, "a");
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_equals_(a, 2));
+  table_scan->set_transaction_context(context);
+  table_scan->execute();
+
+  const auto validate_scan = std::make_shared<Validate>(table_scan);
+  validate_scan->set_transaction_context(context);
+  validate_scan->execute();
+  const auto expected_scan_result =
+      load_table("resources/test_data/tbl/validate_output_validated_scanned.tbl", ChunkOffset{2});
+  EXPECT_TABLE_EQ_UNORDERED(validate_scan->get_output(), expected_scan_result);
+}
+
 TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   // If Validate has a reference table as input, it can usually optimize the evaluation of the MVCC data.
   // This optimization is possible if a PosList of a reference segment references only one chunk.
@@ -287,4 +320,48 @@ TEST_F(OperatorsValidateTest, ForwardSortedByFlag) {
   }
 }
 
+TEST_F(OperatorsValidateTest, ValidateSplitChunk) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // A single large chunk that is not entirely visible is split into multiple morsels.
+  constexpr auto ROW_COUNT = int32_t{20'000};
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{ROW_COUNT}, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < ROW_COUNT; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->set_immutable();
+  set_all_records_visible(*table);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < ROW_COUNT; chunk_offset += 10) {
+    invalidate_record(*table, RowID{ChunkID{0}, chunk_offset}, CommitID{2});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto& result = validate->get_output();
+  EXPECT_GT(result->chunk_count(), 1);
+  EXPECT_EQ(result->row_count(), ROW_COUNT - ROW_COUNT / 10);
+
+  auto visible_rows = std::vector<bool>(ROW_COUNT);
+  for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+    const auto segment = std::static_pointer_cast<const ReferenceSegment>(
+        result->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    for (const auto& row_id : *segment->pos_list()) {
+      EXPECT_FALSE(visible_rows[row_id.chunk_offset]);
+      visible_rows[row_id.chunk_offset] = true;
+    }
+  }
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < ROW_COUNT; ++chunk_offset) {
+    EXPECT_EQ(visible_rows[chunk_offset], chunk_offset % 10 != 0);
+  }
+}
+
 }  // namespace hyrise
@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "scheduler/admission_control.hpp"
+#include "scheduler/scheduling_group.hpp"
+
+namespace hyrise {
+
+class AdmissionControlTest : public BaseTest {
+ protected:
+  static void _wait_for_waiting_queries(const AdmissionControl& admission_control, const size_t count) {
+    while (admission_control.waiting_query_count() < count) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+};
+
+TEST_F(AdmissionControlTest, SchedulingGroup) {
+  auto scheduling_group = SchedulingGroup{};
+  EXPECT_EQ(scheduling_group.priority(), SchedulePriority::Default);
+  EXPECT_EQ(scheduling_group.weight(), SchedulingGroup::DEFAULT_WEIGHT);
+
+  scheduling_group.set_priority(SchedulePriority::High);
+  scheduling_group.set_weight(4);
+  EXPECT_EQ(scheduling_group.priority(), SchedulePriority::High);
+  EXPECT_EQ(scheduling_group.weight(), 4);
+
+  EXPECT_THROW(scheduling_group.set_weight(0), InvalidInputException);
+  EXPECT_THROW(scheduling_group.set_weight(SchedulingGroup::MAX_WEIGHT + 1), InvalidInputException);
+}
+
+TEST_F(AdmissionControlTest, Unlimited) {
+  auto admission_control = AdmissionControl{};
+  auto scheduling_group = SchedulingGroup{};
+  EXPECT_EQ(admission_control.max_concurrent_queries(), AdmissionControl::UNLIMITED);
+
+  {
+    const auto ticket_1 = admission_control.admit(scheduling_group);
+    const auto ticket_2 = admission_control.admit(scheduling_group);
+    EXPECT_EQ(admission_control.running_query_count(), 2);
+  }
+  EXPECT_EQ(admission_control.running_query_count(), 0);
+}
+
+TEST_F(AdmissionControlTest, LimitConcurrentQueries) {
+  auto admission_control = AdmissionControl{};
+  admission_control.set_max_concurrent_queries(1);
+  auto scheduling_group = SchedulingGroup{};
+
+  auto admitted = std::atomic_bool{false};
+  auto waiting_thread = std::optional<std::thread>{};
+  {
+    const auto ticket = admission_control.admit(scheduling_group);
+    waiting_thread.emplace([&]() {
+      const auto waiting_ticket = admission_control.admit(scheduling_group);
+      admitted = true;
+    });
+
+    _wait_for_waiting_queries(admission_control, 1);
+    EXPECT_FALSE(admitted);
+    EXPECT_EQ(admission_control.running_query_count(), 1);
+
+    // High-priority queries are not subject to the limit.
+    auto high_priority_group = SchedulingGroup{SchedulePriority::High};
+    const auto high_priority_ticket = admission_control.admit(high_priority_group);
+    EXPECT_EQ(admission_control.running_query_count(), 1);
+  }
+
+  waiting_thread->join();
+  EXPECT_TRUE(admitted);
+  EXPECT_EQ(admission_control.running_query_count(), 0);
+  EXPECT_EQ(admission_control.waiting_query_count(), 0);
+}
+
+TEST_F(AdmissionControlTest, RaisingLimitAdmitsWaitingQueries) {
+  auto admission_control = AdmissionControl{};
+  admission_control.set_max_concurrent_queries(1);
+  auto scheduling_group = SchedulingGroup{};
+
+  const auto ticket = admission_control.admit(scheduling_group);
+  auto waiting_thread = std::thread{[&]() {
+    const auto waiting_ticket = admission_control.admit(scheduling_group);
+  }};
+
+  _wait_for_waiting_queries(admission_control, 1);
+  admission_control.set_max_concurrent_queries(AdmissionControl::UNLIMITED);
+  waiting_thread.join();
+  EXPECT_EQ(admission_control.running_query_count(), 1);
+}
+
+TEST_F(AdmissionControlTest, WeightedFairShare) {
+  constexpr auto QUERIES_PER_GROUP = 4;
+
+  auto admission_control = AdmissionControl{};
+  admission_control.set_max_concurrent_queries(1);
+  auto light_group = SchedulingGroup{SchedulePriority::Default, 1};
+  auto heavy_group = SchedulingGroup{SchedulePriority::Default, 3};
+
+  auto admission_order = std::vector<const SchedulingGroup*>{};
+  auto admission_order_mutex = std::mutex{};
+  auto threads = std::vector<std::thread>{};
+  {
+    auto blocking_group = SchedulingGroup{};
+    const auto ticket = admission_control.admit(blocking_group);
+    for (auto query_id = 0; query_id < QUERIES_PER_GROUP; ++query_id) {
+      for (auto* scheduling_group : {&light_group, &heavy_group}) {
+        threads.emplace_back([&, scheduling_group]() {
+          const auto waiting_ticket = admission_control.admit(*scheduling_group);
+          const auto lock = std::lock_guard{admission_order_mutex};
+          admission_order.emplace_back(scheduling_group);
+        });
+      }
+    }
+    _wait_for_waiting_queries(admission_control, 2 * QUERIES_PER_GROUP);
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // The group with weight 3 gets three of the first four slots, regardless of the order in which the queries arrived.
+  ASSERT_EQ(admission_order.size(), 2 * QUERIES_PER_GROUP);
+  EXPECT_EQ(std::count(admission_order.begin(), admission_order.begin() + 4, &heavy_group), 3);
+}
+
+}  // namespace hyrise
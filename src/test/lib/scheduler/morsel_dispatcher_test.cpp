@@ -0,0 +1,151 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace hyrise {
+
+class MorselDispatcherTest : public BaseTest {
+ protected:
+  static void _use_node_queue_scheduler() {
+    // Eight workers, independent of the hardware.
+    Hyrise::get().topology.use_fake_numa_topology(std::vector<uint32_t>{4, 4});
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  }
+};
+
+TEST_F(MorselDispatcherTest, CostStatistics) {
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::TableScan};
+  EXPECT_EQ(morsel_dispatcher.cost_per_row(), MorselDispatcher::DEFAULT_COST_PER_ROW);
+
+  // Without parallelism, morsels are as large as possible: 2 ms / 10 ns.
+  EXPECT_EQ(morsel_dispatcher.target_morsel_size(1'000'000), 200'000);
+
+  // Morsels with few rows are not measured.
+  morsel_dispatcher.record_runtime(10, std::chrono::milliseconds{1});
+  EXPECT_EQ(morsel_dispatcher.cost_per_row(), MorselDispatcher::DEFAULT_COST_PER_ROW);
+
+  // The first measurement replaces the default cost, later ones are smoothed.
+  morsel_dispatcher.record_runtime(10'000, std::chrono::milliseconds{1});
+  EXPECT_DOUBLE_EQ(morsel_dispatcher.cost_per_row().count(), 100.0);
+  EXPECT_EQ(morsel_dispatcher.target_morsel_size(1'000'000), 20'000);
+
+  morsel_dispatcher.record_runtime(10'000, std::chrono::microseconds{500});
+  EXPECT_DOUBLE_EQ(morsel_dispatcher.cost_per_row().count(), 90.0);
+
+  // Statistics are kept per operator type.
+  EXPECT_EQ(MorselDispatcher{OperatorType::Projection}.cost_per_row(), MorselDispatcher::DEFAULT_COST_PER_ROW);
+
+  MorselDispatcher::reset_cost_statistics();
+  EXPECT_EQ(morsel_dispatcher.cost_per_row(), MorselDispatcher::DEFAULT_COST_PER_ROW);
+}
+
+TEST_F(MorselDispatcherTest, CoalesceSmallChunks) {
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::TableScan};
+
+  const auto morsels = morsel_dispatcher.create_morsels(
+      {ChunkOffset{100}, ChunkOffset{0}, ChunkOffset{100}, ChunkOffset{150'000}, ChunkOffset{100'000},
+       ChunkOffset{10}});
+  ASSERT_EQ(morsels.size(), 2);
+
+  EXPECT_EQ(morsels[0].chunk_id_begin, ChunkID{0});
+  EXPECT_EQ(morsels[0].chunk_id_end, ChunkID{4});
+  EXPECT_EQ(morsels[0].row_count, 150'200);
+  EXPECT_FALSE(morsels[0].chunk_offsets);
+
+  EXPECT_EQ(morsels[1].chunk_id_begin, ChunkID{4});
+  EXPECT_EQ(morsels[1].chunk_id_end, ChunkID{6});
+  EXPECT_EQ(morsels[1].row_count, 100'010);
+  EXPECT_FALSE(morsels[1].chunk_offsets);
+
+  EXPECT_TRUE(morsel_dispatcher.create_morsels({}).empty());
+}
+
+TEST_F(MorselDispatcherTest, SplitLargeChunks) {
+  _use_node_queue_scheduler();
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::Validate};
+
+  // With idle workers, the rows are spread over the workers. The morsels still take at least 50 us (5'000 rows).
+  EXPECT_EQ(morsel_dispatcher.target_morsel_size(320'000), 10'000);
+  EXPECT_EQ(morsel_dispatcher.target_morsel_size(1'000), 5'000);
+
+  const auto chunk_sizes = std::vector<ChunkOffset>{ChunkOffset{20'000}, ChunkOffset{100}, ChunkOffset{12'000}};
+  const auto split_first_chunk = [](const ChunkID chunk_id) {
+    return chunk_id == ChunkID{0};
+  };
+
+  // The target size is 5'000 rows. Only the first chunk may be split.
+  const auto morsels = morsel_dispatcher.create_morsels(chunk_sizes, split_first_chunk);
+  ASSERT_EQ(morsels.size(), 6);
+  for (auto morsel_id = uint32_t{0}; morsel_id < 4; ++morsel_id) {
+    const auto& morsel = morsels[morsel_id];
+    EXPECT_EQ(morsel.chunk_id_begin, ChunkID{0});
+    EXPECT_EQ(morsel.chunk_id_end, ChunkID{1});
+    ASSERT_TRUE(morsel.chunk_offsets);
+    EXPECT_EQ(morsel.chunk_offsets->first, ChunkOffset{morsel_id * 5'000});
+    EXPECT_EQ(morsel.chunk_offsets->second, ChunkOffset{(morsel_id + 1) * 5'000});
+    EXPECT_EQ(morsel.row_count, 5'000);
+  }
+
+  EXPECT_EQ(morsels[4].chunk_id_begin, ChunkID{1});
+  EXPECT_EQ(morsels[4].chunk_id_end, ChunkID{2});
+  EXPECT_EQ(morsels[5].chunk_id_begin, ChunkID{2});
+  EXPECT_EQ(morsels[5].chunk_id_end, ChunkID{3});
+  EXPECT_FALSE(morsels[5].chunk_offsets);
+}
+
+TEST_F(MorselDispatcherTest, KeepChunksOfNodesApart) {
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::TableScan};
+  const auto chunk_sizes = std::vector<ChunkOffset>(4, ChunkOffset{100});
+  const auto chunk_node_ids = std::vector<NodeID>{NodeID{0}, NodeID{0}, NodeID{1}, NodeID{1}};
+
+  // Without a multi-threaded scheduler, nodes are ignored.
+  const auto single_threaded_morsels = morsel_dispatcher.create_morsels(chunk_sizes, nullptr, chunk_node_ids);
+  ASSERT_EQ(single_threaded_morsels.size(), 1);
+  EXPECT_EQ(single_threaded_morsels[0].node_id, INVALID_NODE_ID);
+
+  // Chunks stored on different nodes are not coalesced.
+  _use_node_queue_scheduler();
+  const auto morsels = morsel_dispatcher.create_morsels(chunk_sizes, nullptr, chunk_node_ids);
+  ASSERT_EQ(morsels.size(), 2);
+
+  EXPECT_EQ(morsels[0].chunk_id_begin, ChunkID{0});
+  EXPECT_EQ(morsels[0].chunk_id_end, ChunkID{2});
+  EXPECT_EQ(morsels[0].node_id, NodeID{0});
+
+  EXPECT_EQ(morsels[1].chunk_id_begin, ChunkID{2});
+  EXPECT_EQ(morsels[1].chunk_id_end, ChunkID{4});
+  EXPECT_EQ(morsels[1].node_id, NodeID{1});
+}
+
+TEST_F(MorselDispatcherTest, ExecuteAllMorsels) {
+  _use_node_queue_scheduler();
+  const auto morsel_dispatcher = MorselDispatcher{OperatorType::TableScan};
+
+  constexpr auto CHUNK_COUNT = 100;
+  const auto chunk_sizes = std::vector<ChunkOffset>(CHUNK_COUNT, ChunkOffset{1'000});
+  const auto morsels = morsel_dispatcher.create_morsels(chunk_sizes);
+  EXPECT_GT(morsels.size(), 1);
+  EXPECT_LT(morsels.size(), CHUNK_COUNT);
+
+  auto executions_per_chunk = std::vector<std::atomic_uint32_t>(CHUNK_COUNT);
+  morsel_dispatcher.execute(morsels, [&](const auto& morsel) {
+    for (auto chunk_id = morsel.chunk_id_begin; chunk_id < morsel.chunk_id_end; ++chunk_id) {
+      ++executions_per_chunk[chunk_id];
+    }
+  });
+
+  for (const auto& execution_count : executions_per_chunk) {
+    EXPECT_EQ(execution_count, 1);
+  }
+}
+
+}  // namespace hyrise
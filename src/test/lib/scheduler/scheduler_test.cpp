@@ -184,6 +184,34 @@ TEST_F(SchedulerTest, Grouping) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, GroupingPerPreferredNode) {
+  // Tasks are only grouped with tasks of the same preferred node, so that chains of tasks stay on their node.
+  Hyrise::get().topology.use_fake_numa_topology(std::vector<uint32_t>{1, 1});
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto task_count = 1'000;
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([] {}));
+    tasks.back()->set_preferred_node_id(NodeID{static_cast<NodeID::base_type>(task_id % 2)});
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  auto grouped_task_count = size_t{0};
+  for (const auto& task : tasks) {
+    EXPECT_TRUE(task->is_done());
+    for (const auto& predecessor : task->predecessors()) {
+      EXPECT_EQ(predecessor.get().preferred_node_id(), task->preferred_node_id());
+      ++grouped_task_count;
+    }
+  }
+  EXPECT_EQ(grouped_task_count, task_count - 2 * NodeQueueScheduler::NUM_GROUPS);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 TEST_F(SchedulerTest, MultipleDependenciesWithScheduler) {
   Hyrise::get().topology.use_fake_numa_topology(8, 4);
   Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
@@ -351,6 +379,64 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, SpawnedTasksArePushedToWorkerDeque) {
+  Hyrise::get().topology.use_default_topology(1);
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>();
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+
+  auto subtasks_done = std::atomic_uint32_t{0};
+  auto node_queue_empty = false;
+  auto task = std::make_shared<JobTask>([&]() {
+    auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto index = 0; index < 4; ++index) {
+      subtasks.emplace_back(std::make_shared<JobTask>([&]() {
+        ++subtasks_done;
+      }));
+    }
+
+    // Tasks spawned by a worker do not go through the shared node queue.
+    for (const auto& subtask : subtasks) {
+      subtask->schedule();
+    }
+    node_queue_empty = node_queue_scheduler->queues()[0]->empty();
+    node_queue_scheduler->wait_for_tasks(subtasks);
+  });
+
+  task->schedule();
+  node_queue_scheduler->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(node_queue_empty);
+  EXPECT_EQ(subtasks_done, 4);
+
+  node_queue_scheduler->finish();
+}
+
+TEST_F(SchedulerTest, InheritHighPriority) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto default_priority_subtask = std::shared_ptr<AbstractTask>{};
+  auto high_priority_subtask = std::shared_ptr<AbstractTask>{};
+  const auto spawn_subtask = [](auto& subtask) {
+    subtask = std::make_shared<JobTask>([]() {});
+    subtask->schedule();
+    Hyrise::get().scheduler()->wait_for_tasks({subtask});
+  };
+
+  const auto default_priority_task = std::make_shared<JobTask>([&]() {
+    spawn_subtask(default_priority_subtask);
+  });
+  const auto high_priority_task = std::make_shared<JobTask>(
+      [&]() {
+        spawn_subtask(high_priority_subtask);
+      },
+      SchedulePriority::High);
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({default_priority_task, high_priority_task});
+  EXPECT_EQ(default_priority_subtask->priority(), SchedulePriority::Default);
+  EXPECT_EQ(high_priority_subtask->priority(), SchedulePriority::High);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 TEST_F(SchedulerTest, DetermineQueueIDForTask) {
   if (std::thread::hardware_concurrency() < 2) {
     GTEST_SKIP();
@@ -460,6 +546,7 @@ TEST_F(SchedulerTest, ExecuteNextFromNonWorker) {
   EXPECT_EQ(node_queue_scheduler->active_worker_count(), 1);
   auto empty_task = std::make_shared<JobTask>([&]() {});
   EXPECT_THROW(worker->execute_next(empty_task), std::logic_error);
+  EXPECT_THROW(worker->try_push_local(empty_task), std::logic_error);
 }
 
 }  // namespace hyrise
@@ -47,4 +47,27 @@ TEST_F(TaskQueueTest, EstimateLoad) {
   EXPECT_EQ(task_queue.estimate_load(), size_t{3});
 }
 
+TEST_F(TaskQueueTest, WakeUpSleepingWorker) {
+  auto task_queue = TaskQueue{NodeID{0}};
+
+  // Without a registered sleeper, pushes to deques do not signal the semaphore.
+  task_queue.wake_up_sleeping_worker();
+  EXPECT_FALSE(task_queue.semaphore.tryWait());
+
+  // A worker that registered as sleeping is woken up, even if it has not reached wait() yet. Only one wake-up is
+  // issued per sleeper, and pull() consumes it without signaling the semaphore again.
+  task_queue.prepare_wait();
+  task_queue.wake_up_sleeping_worker();
+  task_queue.wake_up_sleeping_worker();
+  task_queue.wait();
+  EXPECT_FALSE(task_queue.pull());
+  EXPECT_FALSE(task_queue.semaphore.tryWait());
+
+  // Canceling the registration stops further wake-ups.
+  task_queue.prepare_wait();
+  task_queue.cancel_wait();
+  task_queue.wake_up_sleeping_worker();
+  EXPECT_FALSE(task_queue.semaphore.tryWait());
+}
+
 }  // namespace hyrise
@@ -0,0 +1,113 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace hyrise {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::shared_ptr<AbstractTask> _make_task() {
+    return std::make_shared<JobTask>([]() {});
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoAndStealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+
+  const auto task_1 = _make_task();
+  const auto task_2 = _make_task();
+  const auto task_3 = _make_task();
+  EXPECT_TRUE(deque.push(task_1));
+  EXPECT_TRUE(deque.push(task_2));
+  EXPECT_TRUE(deque.push(task_3));
+  EXPECT_EQ(deque.estimate_size(), 3);
+
+  EXPECT_EQ(deque.pop(), task_3);
+  EXPECT_EQ(deque.steal(), task_1);
+  EXPECT_EQ(deque.pop(), task_2);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+}
+
+TEST_F(WorkStealingDequeTest, BoundedCapacity) {
+  auto deque = WorkStealingDeque{};
+  const auto task = _make_task();
+  for (auto index = size_t{0}; index < WorkStealingDeque::CAPACITY; ++index) {
+    EXPECT_TRUE(deque.push(task));
+  }
+  EXPECT_FALSE(deque.push(task));
+
+  // Stealing frees a slot. The ring buffer wraps around.
+  EXPECT_TRUE(deque.steal());
+  EXPECT_TRUE(deque.push(task));
+  EXPECT_EQ(deque.estimate_size(), WorkStealingDeque::CAPACITY);
+
+  // Every slot holds a copy of the task's shared pointer.
+  EXPECT_EQ(task.use_count(), WorkStealingDeque::CAPACITY + 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentPopAndSteal) {
+  constexpr auto TASK_COUNT = size_t{100'000};
+  constexpr auto THIEF_COUNT = size_t{4};
+
+  auto deque = WorkStealingDeque{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>(TASK_COUNT);
+  for (auto& task : tasks) {
+    task = _make_task();
+  }
+
+  // Every task must be taken exactly once, either by the owner or by one of the thieves.
+  auto taken_count = std::atomic_size_t{0};
+  const auto take = [&](const std::shared_ptr<AbstractTask>& task) {
+    EXPECT_TRUE(task->try_mark_as_enqueued());
+    ++taken_count;
+  };
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = size_t{0}; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (taken_count < TASK_COUNT) {
+        if (const auto task = deque.steal()) {
+          take(task);
+        }
+      }
+    });
+  }
+
+  for (auto index = size_t{0}; index < TASK_COUNT; ++index) {
+    while (!deque.push(tasks[index])) {
+      if (const auto task = deque.pop()) {
+        take(task);
+      }
+    }
+
+    // Pop every other task so that the owner and the thieves race for the last elements.
+    if (index % 2 == 1) {
+      if (const auto task = deque.pop()) {
+        take(task);
+      }
+    }
+  }
+
+  while (const auto task = deque.pop()) {
+    take(task);
+  }
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  EXPECT_EQ(taken_count, TASK_COUNT);
+  EXPECT_TRUE(deque.empty());
+}
+
+}  // namespace hyrise
@@ -193,6 +193,14 @@ TEST_F(PostgresProtocolHandlerTest, ReadSyncPacket) {
   EXPECT_NO_THROW(_protocol_handler->read_sync_packet());
 }
 
+TEST_F(PostgresProtocolHandlerTest, DiscardPacket) {
+  // Bind packet with a length of 12 bytes followed by the type of the next packet.
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\f'});
+  _mocked_socket->write(std::string{"garbage\0S", 9});
+  _protocol_handler->discard_packet();
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::SyncCommand);
+}
+
 TEST_F(PostgresProtocolHandlerTest, SendStatusMessage) {
   _protocol_handler->send_status_message(PostgresMessageType::BindComplete);
   _protocol_handler->force_flush();
@@ -257,7 +265,20 @@ TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
   _mocked_socket->write(portal_name);
   _mocked_socket->write({'\0', '\0', '\0', '\0', '\0'});
 
-  EXPECT_EQ(_protocol_handler->read_execute_packet(), portal_name);
+  const auto [read_portal_name, row_limit] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(read_portal_name, portal_name);
+  EXPECT_EQ(row_limit, 0);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadExecutePacketWithRowLimit) {
+  const std::string portal_name = "some_portal";
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x14'});
+  _mocked_socket->write(portal_name);
+  _mocked_socket->write({'\0', '\0', '\0', '\x01', '\x02'});
+
+  const auto [read_portal_name, row_limit] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(read_portal_name, portal_name);
+  EXPECT_EQ(row_limit, 258);
 }
 
 TEST_F(PostgresProtocolHandlerTest, SendErrorMessage) {
@@ -60,6 +60,31 @@ TEST_F(QueryHandlerTest, ExecutePreparedStatement) {
   EXPECT_EQ(result_table->column_count(), 2u);
 }
 
+TEST_F(QueryHandlerTest, BindPreparedPlanBatch) {
+  QueryHandler::setup_prepared_plan("insert_statement", "INSERT INTO table_a VALUES (?, ?)");
+  QueryHandler::setup_prepared_plan("select_statement", "SELECT * FROM table_a WHERE a > ?");
+  EXPECT_TRUE(QueryHandler::is_batchable_prepared_plan("insert_statement"));
+  EXPECT_FALSE(QueryHandler::is_batchable_prepared_plan("select_statement"));
+
+  const auto parameter_sets = std::vector<std::vector<AllTypeVariant>>{
+      {int32_t{1}, float{1.5f}}, {int32_t{2}, float{2.5f}}, {int32_t{3}, float{3.5f}}};
+  const auto pqp = QueryHandler::bind_prepared_plan_batch("insert_statement", parameter_sets);
+  EXPECT_EQ(pqp->type(), OperatorType::Insert);
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  pqp->set_transaction_context_recursively(transaction_context);
+  QueryHandler::execute_prepared_plan(pqp);
+
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  ASSERT_EQ(table->row_count(), 6);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 3), 1);
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 3), 1.5f);
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 4), 2.5f);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 5), 3);
+
+  EXPECT_THROW(QueryHandler::bind_prepared_plan_batch("insert_statement", {{int32_t{1}}}), InvalidInputException);
+}
+
 TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
   QueryHandler::setup_prepared_plan("", "SELECT * FROM table_a WHERE a > ?");
   const auto old_plan = Hyrise::get().storage_manager.get_prepared_plan("");
@@ -77,4 +102,154 @@ TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
   EXPECT_FALSE(Hyrise::get().storage_manager.has_prepared_plan(""));
 }
 
+TEST_F(QueryHandlerTest, ParseCopyStatement) {
+  EXPECT_FALSE(QueryHandler::parse_copy_statement("SELECT * FROM table_a;"));
+  EXPECT_FALSE(QueryHandler::parse_copy_statement("COPY table_a FROM 'file.csv';"));
+  EXPECT_FALSE(QueryHandler::parse_copy_statement("COPY table_a TO 'file.csv';"));
+
+  const auto copy_from = QueryHandler::parse_copy_statement("copy table_a from stdin;");
+  ASSERT_TRUE(copy_from);
+  EXPECT_EQ(copy_from->direction, CopyDirection::FromStdin);
+  EXPECT_EQ(copy_from->table_name, "table_a");
+  EXPECT_EQ(copy_from->format, CopyFormat::Text);
+  EXPECT_EQ(copy_from->delimiter, '\t');
+  EXPECT_FALSE(copy_from->header);
+
+  const auto copy_from_csv =
+      QueryHandler::parse_copy_statement("COPY table_a FROM STDIN WITH (FORMAT csv, HEADER true, DELIMITER ';')");
+  ASSERT_TRUE(copy_from_csv);
+  EXPECT_EQ(copy_from_csv->format, CopyFormat::Csv);
+  EXPECT_EQ(copy_from_csv->delimiter, ';');
+  EXPECT_TRUE(copy_from_csv->header);
+
+  const auto copy_from_legacy_csv = QueryHandler::parse_copy_statement("COPY table_a FROM STDIN WITH CSV HEADER");
+  ASSERT_TRUE(copy_from_legacy_csv);
+  EXPECT_EQ(copy_from_legacy_csv->format, CopyFormat::Csv);
+  EXPECT_EQ(copy_from_legacy_csv->delimiter, ',');
+  EXPECT_TRUE(copy_from_legacy_csv->header);
+
+  const auto copy_to = QueryHandler::parse_copy_statement("COPY table_a TO STDOUT;");
+  ASSERT_TRUE(copy_to);
+  EXPECT_EQ(copy_to->direction, CopyDirection::ToStdout);
+  EXPECT_EQ(copy_to->query, "SELECT * FROM table_a");
+
+  const auto copy_query_to = QueryHandler::parse_copy_statement("COPY (SELECT a FROM table_a WHERE a > 5) TO STDOUT");
+  ASSERT_TRUE(copy_query_to);
+  EXPECT_EQ(copy_query_to->query, "SELECT a FROM table_a WHERE a > 5");
+
+  EXPECT_THROW(QueryHandler::parse_copy_statement("COPY table_a FROM STDIN (FORMAT binary)"), InvalidInputException);
+  EXPECT_THROW(QueryHandler::parse_copy_statement("COPY table_a FROM STDIN (DELIMITER)"), InvalidInputException);
+}
+
+TEST_F(QueryHandlerTest, ParseSchedulingSetting) {
+  EXPECT_FALSE(QueryHandler::parse_scheduling_setting("SELECT * FROM table_a;"));
+  EXPECT_FALSE(QueryHandler::parse_scheduling_setting("SET search_path = public;"));
+
+  const auto priority = QueryHandler::parse_scheduling_setting("SET query_priority = 'high';");
+  ASSERT_TRUE(priority);
+  EXPECT_EQ(priority->priority, SchedulePriority::High);
+  EXPECT_FALSE(priority->weight);
+
+  const auto default_priority = QueryHandler::parse_scheduling_setting("set session QUERY_PRIORITY to default");
+  ASSERT_TRUE(default_priority);
+  EXPECT_EQ(default_priority->priority, SchedulePriority::Default);
+
+  const auto weight = QueryHandler::parse_scheduling_setting("SET query_weight = 4");
+  ASSERT_TRUE(weight);
+  EXPECT_EQ(weight->weight, 4);
+  EXPECT_FALSE(weight->priority);
+
+  EXPECT_THROW(QueryHandler::parse_scheduling_setting("SET query_priority = low"), InvalidInputException);
+  EXPECT_THROW(QueryHandler::parse_scheduling_setting("SET query_weight = 0"), InvalidInputException);
+  EXPECT_THROW(QueryHandler::parse_scheduling_setting("SET query_weight = many"), InvalidInputException);
+}
+
+TEST_F(QueryHandlerTest, ParseBeginIsolationLevel) {
+  EXPECT_FALSE(QueryHandler::parse_begin_isolation_level("BEGIN;"));
+  EXPECT_FALSE(QueryHandler::parse_begin_isolation_level("SELECT * FROM table_a;"));
+  EXPECT_FALSE(QueryHandler::parse_begin_isolation_level("BEGIN ISOLATION LEVEL SERIALIZABLE READ ONLY"));
+
+  EXPECT_EQ(QueryHandler::parse_begin_isolation_level("BEGIN ISOLATION LEVEL SERIALIZABLE;"),
+            IsolationLevel::Serializable);
+  EXPECT_EQ(QueryHandler::parse_begin_isolation_level("start transaction isolation level serializable, read write"),
+            IsolationLevel::Serializable);
+  EXPECT_EQ(QueryHandler::parse_begin_isolation_level("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ"),
+            IsolationLevel::SnapshotIsolation);
+  EXPECT_EQ(QueryHandler::parse_begin_isolation_level("BEGIN WORK ISOLATION LEVEL READ COMMITTED;"),
+            IsolationLevel::SnapshotIsolation);
+}
+
+TEST_F(QueryHandlerTest, CompleteRowsLength) {
+  EXPECT_EQ(QueryHandler::complete_rows_length("1\ta\n2\tb", CopyFormat::Text), 4);
+  EXPECT_EQ(QueryHandler::complete_rows_length("1\ta", CopyFormat::Text), 0);
+  EXPECT_EQ(QueryHandler::complete_rows_length("1,\"a\n\"\"b\"\n2,\"c\n", CopyFormat::Csv), 10);
+}
+
+TEST_F(QueryHandlerTest, InsertCopyData) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data,
+      ChunkOffset{2}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("copy_table", table);
+
+  auto text_copy = CopyStatementDetails{CopyDirection::FromStdin, "copy_table", ""};
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(QueryHandler::insert_copy_data(text_copy, "1\tx\n2\t\\N\n3\ttab\\there\n4\tnull\n",
+                                           transaction_context),
+            4);
+
+  auto csv_copy = CopyStatementDetails{CopyDirection::FromStdin, "copy_table", "", CopyFormat::Csv, ';'};
+  EXPECT_EQ(QueryHandler::insert_copy_data(csv_copy, "5;\"a;\"\"b\"\"\"\n6;\n7;\"\"\n", transaction_context), 3);
+  transaction_context->commit();
+
+  ASSERT_EQ(table->row_count(), 7);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 0), 1);
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 0), "x");
+  EXPECT_FALSE(table->get_value<pmr_string>(ColumnID{1}, 1));
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 2), "tab\there");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 3), "null");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 4), "a;\"b\"");
+  EXPECT_FALSE(table->get_value<pmr_string>(ColumnID{1}, 5));
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 6), "");
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 6), 7);
+}
+
+TEST_F(QueryHandlerTest, InsertCopyDataTextEscapes) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data,
+                                             ChunkOffset{8}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("copy_table", table);
+
+  // Single-character escapes, octal and hexadecimal byte values (with one to three and one to two digits), an escaped
+  // delimiter, and escapes that represent the character itself.
+  const auto copy_data =
+      std::string{"\\b\\f\\n\\r\\t\\v\n\\101\\60\\1010\n\\x41\\x4a\\x4G\\xz\n\\\t\\\\\\a\n"};
+  auto copy_statement = CopyStatementDetails{CopyDirection::FromStdin, "copy_table", ""};
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(QueryHandler::insert_copy_data(copy_statement, copy_data, transaction_context), 4);
+  transaction_context->commit();
+
+  ASSERT_EQ(table->row_count(), 4);
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{0}, 0), "\b\f\n\r\t\v");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{0}, 1), "A0A0");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{0}, 2), "AJ\x04Gxz");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{0}, 3), "\t\\a");
+}
+
+TEST_F(QueryHandlerTest, InsertCopyDataQuotedNumerics) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Double, true}}, TableType::Data,
+      ChunkOffset{8}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("copy_table", table);
+
+  auto copy_statement = CopyStatementDetails{CopyDirection::FromStdin, "copy_table", "", CopyFormat::Csv, ','};
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(QueryHandler::insert_copy_data(copy_statement, "\"1\",\"2.5\"\n2,\n", transaction_context), 2);
+  transaction_context->commit();
+
+  ASSERT_EQ(table->row_count(), 2);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 0), 1);
+  EXPECT_EQ(table->get_value<double>(ColumnID{1}, 0), 2.5);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 1), 2);
+  EXPECT_FALSE(table->get_value<double>(ColumnID{1}, 1));
+}
+
 }  // namespace hyrise
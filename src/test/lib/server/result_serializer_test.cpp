@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 #include "server/postgres_protocol_handler.hpp"
+#include "server/query_handler.hpp"
 #include "server/result_serializer.hpp"
 
 namespace hyrise {
@@ -42,6 +43,83 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, QueryResponseWithRowLimit) {
+  // The table has eight rows in chunks of two rows. Fetch them in batches of three rows, which do not align with the
+  // chunk boundaries.
+  ASSERT_EQ(_test_table->row_count(), 8);
+  auto position = ResultPosition{};
+  auto total_row_count = uint64_t{0};
+  auto batch_count = size_t{0};
+
+  while (!ResultSerializer::is_completely_sent(_test_table, position)) {
+    const auto sent_row_count = ResultSerializer::send_query_response(_test_table, _protocol_handler, position, 3);
+    EXPECT_EQ(sent_row_count, std::min(uint64_t{3}, _test_table->row_count() - total_row_count));
+    total_row_count += sent_row_count;
+    ++batch_count;
+  }
+
+  EXPECT_EQ(total_row_count, _test_table->row_count());
+  EXPECT_EQ(batch_count, 3);
+  EXPECT_EQ(ResultSerializer::send_query_response(_test_table, _protocol_handler, position, 3), 0);
+
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+  EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
+}
+
+TEST_F(ResultSerializerTest, CopyData) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}}, TableType::Data);
+  table->append({pmr_string{"x\ty"}});
+  table->append({NULL_VALUE});
+  table->append({pmr_string{""}});
+
+  auto copy_statement = CopyStatementDetails{CopyDirection::ToStdout, "", "", CopyFormat::Text, '\t'};
+  ResultSerializer::send_copy_data(table, _protocol_handler, copy_statement);
+  copy_statement = CopyStatementDetails{CopyDirection::ToStdout, "", "", CopyFormat::Csv, ',', true};
+  ResultSerializer::send_copy_data(table, _protocol_handler, copy_statement);
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // Text: escaped tabulator, NULL marker, and empty string. CSV: header, quoted empty string, and unquoted NULL. The rows
+  // of each statement fit into a single CopyData message.
+  EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'd'), 2);
+  EXPECT_NE(file_content.find("x\\ty\n"), std::string::npos);
+  EXPECT_NE(file_content.find("\\N\n"), std::string::npos);
+  EXPECT_NE(file_content.find("x\ty\n"), std::string::npos);
+  EXPECT_NE(file_content.find("\"\"\n"), std::string::npos);
+}
+
+TEST_F(ResultSerializerTest, CopyDataCombinesRows) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  auto expected_data = std::string{};
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    table->append({value});
+    expected_data += std::to_string(value) + "\n";
+  }
+
+  const auto copy_statement = CopyStatementDetails{CopyDirection::ToStdout, "", "", CopyFormat::Text, '\t'};
+  ResultSerializer::send_copy_data(table, _protocol_handler, copy_statement);
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // Reassemble the payload of all CopyData messages.
+  auto data = std::string{};
+  auto message_count = size_t{0};
+  auto message_begin = size_t{0};
+  while (message_begin < file_content.size()) {
+    ASSERT_EQ(file_content[message_begin], 'd');
+    const auto message_length =
+        NetworkConversionHelper::get_message_length(file_content.cbegin() + message_begin + 1);
+    data.append(file_content, message_begin + 5, message_length - 4);
+    message_begin += 1 + message_length;
+    ++message_count;
+  }
+
+  EXPECT_EQ(data, expected_data);
+  EXPECT_GT(message_count, 1);
+  EXPECT_LT(message_count, 100);
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
@@ -1,6 +1,9 @@
 #include <fstream>
 #include <future>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 // GCC in release mode finds potentially uninitialized memory in pqxx. Looking at param.hxx, this appears to be a false
 // positive.
@@ -10,6 +13,8 @@
 #include <pqxx/nontransaction>  // NOLINT(build/include_order)
 #pragma GCC diagnostic pop
 
+#include <libpq-fe.h>  // NOLINT(build/include_order)
+
 #include "base_test.hpp"
 #include "hyrise.hpp"
 #include "operators/get_table.hpp"
@@ -206,6 +211,56 @@ TEST_F(ServerTestRunner, TestCopyIntegration) {
   EXPECT_TABLE_EQ_ORDERED(table_c, expected_table);
 }
 
+TEST_F(ServerTestRunner, TestCopyFromStdinFailureInTransaction) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+  Hyrise::get().storage_manager.add_table(
+      "copy_table", std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes));
+
+  // pqxx cannot send a CopyFail message, so libpq is used directly.
+  auto* const connection = PQconnectdb(_connection_string.c_str());
+  ASSERT_EQ(PQstatus(connection), CONNECTION_OK);
+
+  const auto execute = [&](const std::string& query) {
+    auto* const result = PQexec(connection, query.c_str());
+    const auto status = PQresultStatus(result);
+    PQclear(result);
+    return status;
+  };
+
+  EXPECT_EQ(execute("BEGIN;"), PGRES_COMMAND_OK);
+  EXPECT_EQ(execute("COPY copy_table FROM STDIN;"), PGRES_COPY_IN);
+
+  // Send more than one batch (64 MB) of data so that the first batch is inserted before the COPY fails. Long strings
+  // keep the number of rows small.
+  const auto long_string = std::string(size_t{1024} * 1024, 'x');
+  for (auto row_id = 0; row_id < 80; ++row_id) {
+    const auto row = std::to_string(row_id) + "\t" + long_string + "\n";
+    ASSERT_EQ(PQputCopyData(connection, row.data(), static_cast<int>(row.size())), 1);
+  }
+  ASSERT_EQ(PQputCopyEnd(connection, "aborted by client"), 1);
+
+  auto* const copy_result = PQgetResult(connection);
+  EXPECT_EQ(PQresultStatus(copy_result), PGRES_FATAL_ERROR);
+  PQclear(copy_result);
+  while (auto* const result = PQgetResult(connection)) {
+    PQclear(result);
+  }
+
+  // The failed COPY discarded the transaction, so the already inserted batch cannot be committed.
+  EXPECT_EQ(execute("COMMIT;"), PGRES_FATAL_ERROR);
+  PQfinish(connection);
+
+  const auto table = Hyrise::get().storage_manager.get_table("copy_table");
+  EXPECT_GT(table->row_count(), 0);
+
+  auto get_table = std::make_shared<GetTable>("copy_table");
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes));
+  get_table->execute();
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 0);
+}
+
 TEST_F(ServerTestRunner, TestInvalidStatement) {
   auto connection = pqxx::connection{_connection_string};
 
@@ -263,6 +318,27 @@ TEST_F(ServerTestRunner, TestTransactionRollback) {
   EXPECT_EQ(verification_result.size(), 3);
 }
 
+TEST_F(ServerTestRunner, TestSerializableTransaction) {
+  auto connection = pqxx::connection{_connection_string};
+  auto concurrent_connection = pqxx::connection{_connection_string};
+
+  // Sends BEGIN ISOLATION LEVEL SERIALIZABLE.
+  auto transaction = pqxx::transaction<pqxx::isolation_level::serializable>{connection};
+  EXPECT_EQ(transaction.exec("SELECT * FROM table_a WHERE a = 123;").size(), 1);
+  transaction.exec("INSERT INTO table_a (a, b) VALUES (1, 2);");
+
+  // A concurrent transaction deletes the row that was read. Under snapshot isolation, both transactions could commit.
+  {
+    auto concurrent_transaction = pqxx::nontransaction{concurrent_connection};
+    concurrent_transaction.exec("DELETE FROM table_a WHERE a = 123;");
+  }
+
+  EXPECT_THROW(transaction.commit(), pqxx::serialization_failure);
+
+  auto verification_transaction = pqxx::nontransaction{concurrent_connection};
+  EXPECT_EQ(verification_transaction.exec("SELECT * FROM table_a;").size(), 2);
+}
+
 TEST_F(ServerTestRunner, TestInvalidTransactionFlow) {
   auto connection = pqxx::connection{_connection_string};
 
@@ -391,6 +467,86 @@ TEST_F(ServerTestRunner, TestInvalidPreparedStatement) {
   EXPECT_EQ(result.size(), 1u);
 }
 
+TEST_F(ServerTestRunner, TestPipelinedPreparedStatements) {
+  Hyrise::get().storage_manager.add_table(
+      "pipeline_table", std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                                std::nullopt, UseMvcc::Yes));
+
+  // pqxx waits for the result of each statement, so libpq's pipeline mode is used to send several Bind/Execute
+  // messages before a Sync.
+  auto* const connection = PQconnectdb(_connection_string.c_str());
+  ASSERT_EQ(PQstatus(connection), CONNECTION_OK);
+
+  for (const auto& [name, query] : {std::pair{"insert", "INSERT INTO pipeline_table VALUES (?)"},
+                                    std::pair{"select", "SELECT a FROM pipeline_table WHERE a > ? ORDER BY a"}}) {
+    auto* const result = PQprepare(connection, name, query, 0, nullptr);
+    EXPECT_EQ(PQresultStatus(result), PGRES_COMMAND_OK);
+    PQclear(result);
+  }
+
+  const auto send = [&](const char* const name, const std::vector<const char*>& parameters) {
+    EXPECT_EQ(PQsendQueryPrepared(connection, name, static_cast<int>(parameters.size()), parameters.data(), nullptr,
+                                  nullptr, 0),
+              1);
+  };
+
+  // Returns the status and the values of the first column of the next result.
+  const auto next_result = [&]() {
+    auto* const result = PQgetResult(connection);
+    const auto status = PQresultStatus(result);
+    auto values = std::vector<std::string>{};
+    for (auto row_id = 0; row_id < PQntuples(result); ++row_id) {
+      values.emplace_back(PQgetvalue(result, row_id, 0));
+    }
+    PQclear(result);
+
+    // Apart from Sync, the results of each statement are terminated by a null pointer.
+    if (status != PGRES_PIPELINE_SYNC) {
+      EXPECT_EQ(PQgetResult(connection), nullptr);
+    }
+    return std::pair{status, values};
+  };
+
+  ASSERT_EQ(PQenterPipelineMode(connection), 1);
+
+  // The batched INSERTs are executed before the SELECT, and the responses arrive in the order of the statements.
+  send("insert", {"1"});
+  send("insert", {"2"});
+  send("select", {"0"});
+  send("insert", {"3"});
+  ASSERT_EQ(PQpipelineSync(connection), 1);
+
+  EXPECT_EQ(next_result().first, PGRES_COMMAND_OK);
+  EXPECT_EQ(next_result().first, PGRES_COMMAND_OK);
+  EXPECT_EQ(next_result(), std::pair(PGRES_TUPLES_OK, std::vector<std::string>{"1", "2"}));
+  EXPECT_EQ(next_result().first, PGRES_COMMAND_OK);
+  EXPECT_EQ(next_result().first, PGRES_PIPELINE_SYNC);
+
+  // Binding the SELECT without a parameter fails. The server skips all following messages until the Sync, and libpq
+  // reports the skipped statements as aborted. The INSERT before the error is rolled back.
+  send("insert", {"4"});
+  send("select", {});
+  send("insert", {"5"});
+  send("select", {"0"});
+  ASSERT_EQ(PQpipelineSync(connection), 1);
+
+  EXPECT_EQ(next_result().first, PGRES_COMMAND_OK);
+  EXPECT_EQ(next_result().first, PGRES_FATAL_ERROR);
+  EXPECT_EQ(next_result().first, PGRES_PIPELINE_ABORTED);
+  EXPECT_EQ(next_result().first, PGRES_PIPELINE_ABORTED);
+  EXPECT_EQ(next_result().first, PGRES_PIPELINE_SYNC);
+
+  // The session continues normally after the Sync.
+  send("select", {"0"});
+  ASSERT_EQ(PQpipelineSync(connection), 1);
+
+  EXPECT_EQ(next_result(), std::pair(PGRES_TUPLES_OK, std::vector<std::string>{"1", "2", "3"}));
+  EXPECT_EQ(next_result().first, PGRES_PIPELINE_SYNC);
+
+  EXPECT_EQ(PQexitPipelineMode(connection), 1);
+  PQfinish(connection);
+}
+
 TEST_F(ServerTestRunner, TestParallelConnections) {
   // This test is by no means perfect, as it can show flaky behaviour. But it is rather hard to get reliable tests with
   // multiple concurrent connections to detect a randomly (but often) occurring bug. This test will/can only fail if a
@@ -0,0 +1,52 @@
+#include "base_test.hpp"
+#include "statistics/hyper_log_log.hpp"
+
+namespace hyrise {
+
+class HyperLogLogTest : public BaseTest {};
+
+TEST_F(HyperLogLogTest, EmptySketch) {
+  const auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0.0);
+}
+
+TEST_F(HyperLogLogTest, SmallCardinality) {
+  auto sketch = HyperLogLog{};
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = int32_t{0}; value < 10; ++value) {
+      sketch.add(value);
+    }
+  }
+  EXPECT_NEAR(sketch.estimate(), 10.0, 0.5);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinality) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 1'000'000; ++value) {
+    sketch.add(value);
+    sketch.add(value);
+  }
+  EXPECT_NEAR(sketch.estimate(), 1'000'000.0, 50'000.0);
+}
+
+TEST_F(HyperLogLogTest, Strings) {
+  auto sketch = HyperLogLog{};
+  for (auto value = 0; value < 10'000; ++value) {
+    sketch.add(pmr_string{"value_" + std::to_string(value % 5'000)});
+  }
+  EXPECT_NEAR(sketch.estimate(), 5'000.0, 250.0);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sketch_a = HyperLogLog{};
+  auto sketch_b = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 20'000; ++value) {
+    sketch_a.add(value);
+    sketch_b.add(value + 10'000);
+  }
+
+  sketch_a.merge(sketch_b);
+  EXPECT_NEAR(sketch_a.estimate(), 30'000.0, 1'500.0);
+}
+
+}  // namespace hyrise
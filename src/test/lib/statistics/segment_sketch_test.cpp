@@ -0,0 +1,81 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "statistics/segment_sketch.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class SegmentSketchTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, true}}, TableType::Data,
+        ChunkOffset{4});
+    _table->append({int32_t{3}, pmr_string{"b"}});
+    _table->append({int32_t{1}, NULL_VALUE});
+    _table->append({NULL_VALUE, NULL_VALUE});
+    _table->append({int32_t{3}, NULL_VALUE});
+    _table->append({int32_t{7}, NULL_VALUE});
+    _table->append({NULL_VALUE, pmr_string{"a"}});
+  }
+
+ protected:
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(SegmentSketchTest, GenerateChunkSketches) {
+  const auto sketches = generate_chunk_sketches(*_table->get_chunk(ChunkID{0}));
+  ASSERT_EQ(sketches->size(), 2);
+
+  const auto& sketch_a = (*sketches)[ColumnID{0}];
+  EXPECT_NEAR(sketch_a.distinct_values.estimate(), 2.0, 0.5);
+  EXPECT_EQ(sketch_a.null_value_count, 1);
+  EXPECT_EQ(sketch_a.min, AllTypeVariant{int32_t{1}});
+  EXPECT_EQ(sketch_a.max, AllTypeVariant{int32_t{3}});
+
+  const auto& sketch_b = (*sketches)[ColumnID{1}];
+  EXPECT_NEAR(sketch_b.distinct_values.estimate(), 1.0, 0.5);
+  EXPECT_EQ(sketch_b.null_value_count, 3);
+  EXPECT_EQ(sketch_b.min, AllTypeVariant{pmr_string{"b"}});
+  EXPECT_EQ(sketch_b.max, AllTypeVariant{pmr_string{"b"}});
+}
+
+TEST_F(SegmentSketchTest, Merge) {
+  auto sketch_a = SegmentSketch{};
+  auto sketch_b = SegmentSketch{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto sketches = generate_chunk_sketches(*_table->get_chunk(chunk_id));
+    sketch_a.merge((*sketches)[ColumnID{0}]);
+    sketch_b.merge((*sketches)[ColumnID{1}]);
+  }
+
+  EXPECT_NEAR(sketch_a.distinct_values.estimate(), 3.0, 0.5);
+  EXPECT_EQ(sketch_a.null_value_count, 2);
+  EXPECT_EQ(sketch_a.min, AllTypeVariant{int32_t{1}});
+  EXPECT_EQ(sketch_a.max, AllTypeVariant{int32_t{7}});
+
+  EXPECT_NEAR(sketch_b.distinct_values.estimate(), 2.0, 0.5);
+  EXPECT_EQ(sketch_b.null_value_count, 4);
+  EXPECT_EQ(sketch_b.min, AllTypeVariant{pmr_string{"a"}});
+  EXPECT_EQ(sketch_b.max, AllTypeVariant{pmr_string{"b"}});
+}
+
+TEST_F(SegmentSketchTest, MergeNullOnlySketch) {
+  // A sketch of a segment that contains only NULLs has no value range.
+  auto null_sketch = SegmentSketch{};
+  null_sketch.null_value_count = 2;
+
+  auto sketch = SegmentSketch{};
+  sketch.merge(null_sketch);
+  EXPECT_TRUE(variant_is_null(sketch.min));
+  EXPECT_TRUE(variant_is_null(sketch.max));
+  EXPECT_EQ(sketch.null_value_count, 2);
+
+  sketch.merge((*generate_chunk_sketches(*_table->get_chunk(ChunkID{1})))[ColumnID{0}]);
+  EXPECT_EQ(sketch.min, AllTypeVariant{int32_t{7}});
+  EXPECT_EQ(sketch.max, AllTypeVariant{int32_t{7}});
+  EXPECT_EQ(sketch.null_value_count, 3);
+}
+
+}  // namespace hyrise
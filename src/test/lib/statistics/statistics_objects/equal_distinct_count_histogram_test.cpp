@@ -64,4 +64,30 @@ TEST_F(EqualDistinctCountHistogramTest, FromColumnFloat) {
   EXPECT_EQ(hist->bin(BinID{2}), HistogramBin<float>(3.6f, 6.1f, 4, 3));
 }
 
+TEST_F(EqualDistinctCountHistogramTest, FromColumnSample) {
+  // 100 chunks with 100 rows each. Every chunk contains 100 distinct values, the table contains 1,000 distinct values.
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, ChunkOffset{100});
+  for (auto row_id = int32_t{0}; row_id < 10'000; ++row_id) {
+    table->append({row_id % 1'000});
+  }
+
+  // Only every second chunk is read, so the sample contains 500 distinct values.
+  const auto hist = EqualDistinctCountHistogram<int32_t>::from_column_sample(*table, ColumnID{0}, 10, 0.5);
+  ASSERT_EQ(hist->bin_count(), 10);
+  EXPECT_FLOAT_EQ(hist->total_count(), 10'000);
+  EXPECT_NEAR(hist->total_distinct_count(), 1'000, 50);
+  EXPECT_EQ(hist->bin_minimum(BinID{0}), 0);
+  EXPECT_EQ(hist->bin_maximum(BinID{9}), 899);
+
+  // Without sampling, the bins are the same as for from_column().
+  const auto full_hist = EqualDistinctCountHistogram<int32_t>::from_column_sample(*_int_float4, ColumnID{0}, 2, 1.0);
+  ASSERT_EQ(full_hist->bin_count(), 2);
+  EXPECT_EQ(full_hist->bin(BinID{0}), HistogramBin<int32_t>(12, 123, 2, 2));
+  EXPECT_EQ(full_hist->bin(BinID{1}), HistogramBin<int32_t>(12345, 123456, 5, 2));
+
+  EXPECT_THROW(EqualDistinctCountHistogram<int32_t>::from_column_sample(*table, ColumnID{0}, 10, 0.0),
+               std::logic_error);
+}
+
 }  // namespace hyrise
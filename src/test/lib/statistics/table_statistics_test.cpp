@@ -2,6 +2,7 @@
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "utils/load_table.hpp"
 
@@ -40,4 +41,27 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_DOUBLE_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableWithNullOnlySample) {
+  // With a sampling rate of 0.5, only the chunks 0 and 2 are sampled. Both contain only NULLs.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             ChunkOffset{1});
+  table->append({NULL_VALUE});
+  table->append({int32_t{1}});
+  table->append({NULL_VALUE});
+  table->append({NULL_VALUE});
+
+  const auto table_statistics = TableStatistics::from_table(*table, 0.5);
+
+  const auto column_statistics =
+      std::dynamic_pointer_cast<const AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics);
+
+  const auto histogram = std::dynamic_pointer_cast<const AbstractHistogram<int32_t>>(column_statistics->histogram);
+  ASSERT_TRUE(histogram);
+  EXPECT_DOUBLE_EQ(histogram->total_count(), 1);
+
+  ASSERT_TRUE(column_statistics->null_value_ratio);
+  EXPECT_DOUBLE_EQ(column_statistics->null_value_ratio->ratio, 0.75);
+}
+
 }  // namespace hyrise
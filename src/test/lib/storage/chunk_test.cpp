@@ -450,4 +450,20 @@ TEST_F(StorageChunkTest, TrySetImmutable) {
   EXPECT_THROW(chunk->mark_as_full(), std::logic_error);
 }
 
+TEST_F(StorageChunkTest, ClaimForCleanup) {
+  // Only one rewriter can claim the chunk.
+  EXPECT_TRUE(chunk->try_claim_for_cleanup());
+  EXPECT_FALSE(chunk->try_claim_for_cleanup());
+
+  // A failed rewrite releases the claim.
+  chunk->release_cleanup_claim();
+  EXPECT_THROW(chunk->release_cleanup_claim(), std::logic_error);
+  EXPECT_TRUE(chunk->try_claim_for_cleanup());
+
+  // Chunks that were cleaned up cannot be claimed.
+  chunk = std::make_shared<Chunk>(Segments{vs_int, vs_str});
+  chunk->set_cleanup_commit_id(CommitID{2});
+  EXPECT_FALSE(chunk->try_claim_for_cleanup());
+}
+
 }  // namespace hyrise
@@ -1,10 +1,16 @@
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "types.hpp"
 
@@ -73,7 +79,8 @@ class CompressedVectorTest : public BaseTestWithParam<VectorCompressionType> {
 };
 
 INSTANTIATE_TEST_SUITE_P(VectorCompressionTypes, CompressedVectorTest,
-                         ::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking),
+                         ::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking,
+                                           VectorCompressionType::SimdBp128),
                          enum_formatter<VectorCompressionType>);
 
 TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingIterators) {
@@ -122,4 +129,71 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+class SimdBp128VectorTest : public BaseTest {
+ protected:
+  std::unique_ptr<const BaseCompressedVector> encode(const pmr_vector<uint32_t>& vector) {
+    const auto max_value = vector.empty() ? uint32_t{0} : *std::max_element(vector.cbegin(), vector.cend());
+    return compress_vector(vector, VectorCompressionType::SimdBp128, {}, {max_value});
+  }
+};
+
+TEST_F(SimdBp128VectorTest, BitWidthPerBlock) {
+  // Block 0 only contains zeros, block 1 small values, and block 2 (a partial block) a single large value.
+  auto sequence = pmr_vector<uint32_t>(300, 0u);
+  for (auto index = size_t{128}; index < 256; ++index) {
+    sequence[index] = index % 5;
+  }
+  sequence[299] = 1u << 31u;
+
+  const auto encoded_sequence = encode(sequence);
+  ASSERT_EQ(encoded_sequence->type(), CompressedVectorType::SimdBp128);
+  const auto& vector = static_cast<const SimdBp128Vector&>(*encoded_sequence);
+
+  ASSERT_EQ(vector.size(), 300);
+  ASSERT_EQ(vector.block_count(), 3);
+  EXPECT_EQ(vector.bit_widths()[0], 0);
+  EXPECT_EQ(vector.bit_widths()[1], 3);
+  EXPECT_EQ(vector.bit_widths()[2], 32);
+  EXPECT_EQ(vector.block_max_value(0), 0u);
+  EXPECT_EQ(vector.block_max_value(1), 7u);
+  EXPECT_EQ(vector.block_max_value(2), std::numeric_limits<uint32_t>::max());
+
+  // Only the blocks with a non-zero bit width occupy memory.
+  EXPECT_EQ(vector.data().size(), (3 + 32) * SimdBp128Packing::LANE_COUNT);
+
+  auto block = std::array<uint32_t, SimdBp128Vector::BLOCK_SIZE>{};
+  vector.decompress_block(2, block.data());
+  EXPECT_EQ(block[299 - 256], 1u << 31u);
+  // The last block is padded with zeros.
+  EXPECT_EQ(block[127], 0u);
+}
+
+TEST_F(SimdBp128VectorTest, DecompressRange) {
+  auto sequence = pmr_vector<uint32_t>(1'000);
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    sequence[index] = static_cast<uint32_t>(index * 7'919 % 65'537);
+  }
+
+  const auto encoded_sequence = encode(sequence);
+  const auto& vector = static_cast<const SimdBp128Vector&>(*encoded_sequence);
+
+  // Unaligned ranges that start and end within blocks and span full blocks.
+  for (const auto& [begin, count] : std::vector<std::pair<size_t, size_t>>{{0, 1'000}, {3, 5}, {100, 400}, {999, 1}}) {
+    auto values = std::vector<uint32_t>(count);
+    vector.decompress(begin, count, values.data());
+    for (auto index = size_t{0}; index < count; ++index) {
+      EXPECT_EQ(values[index], sequence[begin + index]);
+    }
+  }
+}
+
+TEST_F(SimdBp128VectorTest, EmptyVector) {
+  const auto encoded_sequence = encode(pmr_vector<uint32_t>{});
+  const auto& vector = static_cast<const SimdBp128Vector&>(*encoded_sequence);
+
+  EXPECT_EQ(vector.size(), 0);
+  EXPECT_EQ(vector.block_count(), 0);
+  EXPECT_EQ(vector.cbegin(), vector.cend());
+}
+
 }  // namespace hyrise
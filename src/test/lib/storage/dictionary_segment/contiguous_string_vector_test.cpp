@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/dictionary_segment/contiguous_string_vector.hpp"
+
+namespace hyrise {
+
+class ContiguousStringVectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto strings = std::vector<pmr_string>{"", "bar", "foo", "HereIsAReallyLongStringThatExceedsTheSSOBuffer"};
+    string_vector = std::make_shared<ContiguousStringVector>(strings.cbegin(), strings.cend());
+  }
+
+  std::shared_ptr<ContiguousStringVector> string_vector;
+};
+
+TEST_F(ContiguousStringVectorTest, SubscriptOperator) {
+  ASSERT_EQ(string_vector->size(), 4);
+  EXPECT_FALSE(string_vector->empty());
+  EXPECT_EQ((*string_vector)[0], "");
+  EXPECT_EQ((*string_vector)[1], "bar");
+  EXPECT_EQ((*string_vector)[2], "foo");
+  EXPECT_EQ((*string_vector)[3], "HereIsAReallyLongStringThatExceedsTheSSOBuffer");
+  EXPECT_EQ(string_vector->front(), "");
+  EXPECT_EQ(string_vector->back(), "HereIsAReallyLongStringThatExceedsTheSSOBuffer");
+
+  // All characters are stored in a single buffer.
+  EXPECT_EQ(string_vector->chars().size(), 52);
+  EXPECT_EQ(string_vector->offsets(), (pmr_vector<size_t>{0, 0, 3, 6, 52}));
+}
+
+TEST_F(ContiguousStringVectorTest, Iterator) {
+  EXPECT_EQ(std::distance(string_vector->cbegin(), string_vector->cend()), 4);
+
+  const auto values = std::vector<std::string_view>(string_vector->cbegin(), string_vector->cend());
+  EXPECT_EQ(values[2], "foo");
+
+  // Sorted vectors can be searched with the standard algorithms.
+  const auto lower_bound = std::lower_bound(string_vector->cbegin(), string_vector->cend(), pmr_string{"c"});
+  EXPECT_EQ(std::distance(string_vector->cbegin(), lower_bound), 2);
+  EXPECT_EQ(*lower_bound, "foo");
+}
+
+TEST_F(ContiguousStringVectorTest, EmptyVector) {
+  const auto strings = std::vector<pmr_string>{};
+  const auto empty_vector = ContiguousStringVector{strings.cbegin(), strings.cend()};
+  EXPECT_TRUE(empty_vector.empty());
+  EXPECT_EQ(empty_vector.size(), 0);
+  EXPECT_TRUE(empty_vector.cbegin() == empty_vector.cend());
+  EXPECT_EQ(empty_vector.data_size(), 0);
+}
+
+TEST_F(ContiguousStringVectorTest, CopyAndCreateFromData) {
+  const auto copy = ContiguousStringVector{*string_vector};
+  EXPECT_TRUE(std::equal(copy.cbegin(), copy.cend(), string_vector->cbegin(), string_vector->cend()));
+  EXPECT_NE(copy.chars().data(), string_vector->chars().data());
+
+  auto chars = pmr_vector<char>{'a', 'b', 'c'};
+  auto offsets = pmr_vector<size_t>{0, 1, 3};
+  const auto vector = ContiguousStringVector{std::move(chars), std::move(offsets)};
+  ASSERT_EQ(vector.size(), 2);
+  EXPECT_EQ(vector[0], "a");
+  EXPECT_EQ(vector[1], "bc");
+
+  EXPECT_THROW(ContiguousStringVector(pmr_vector<char>{'a'}, pmr_vector<size_t>{0, 2}), std::logic_error);
+}
+
+}  // namespace hyrise
@@ -20,7 +20,8 @@ class StorageDictionarySegmentTest : public BaseTestWithParam<VectorCompressionT
 };
 
 INSTANTIATE_TEST_SUITE_P(VectorCompressionTypes, StorageDictionarySegmentTest,
-                         ::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking),
+                         ::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking,
+                                           VectorCompressionType::SimdBp128),
                          enum_formatter<VectorCompressionType>);
 
 TEST_P(StorageDictionarySegmentTest, LowerUpperBound) {
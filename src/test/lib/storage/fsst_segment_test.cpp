@@ -0,0 +1,219 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_test.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    std::remove(filename.c_str());
+  }
+
+  static std::shared_ptr<FSSTSegment<pmr_string>> compress(const std::shared_ptr<ValueSegment<pmr_string>>& segment) {
+    auto encoded_segment =
+        ChunkEncoder::encode_segment(segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+    return std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  }
+
+  static std::shared_ptr<Table> create_url_table(const ChunkOffset chunk_size) {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}}, TableType::Data,
+                                         chunk_size);
+    for (auto index = size_t{0}; index < 100; ++index) {
+      if (index % 10 == 9) {
+        table->append({NULL_VALUE});
+      } else if (index % 2 == 0) {
+        table->append({pmr_string{"https://www.hyrise.org/page/" + std::to_string(index)}});
+      } else {
+        table->append({pmr_string{"http://hpi.de/research/" + std::to_string(index)}});
+      }
+    }
+    table->last_chunk()->set_immutable();
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::FSST});
+    return table;
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+  const std::string filename = test_data_path + "fsst_segment_test.bin";
+};
+
+TEST_F(StorageFSSTSegmentTest, SymbolTableRoundTrip) {
+  const auto strings = std::vector<pmr_string>{"https://www.hyrise.org", "https://www.hyrise.org/docs", "hyrise", "",
+                                               "\xff\xfe binary \x01", "https://github.com/hyrise/hyrise"};
+  const auto string_views = std::vector<std::string_view>(strings.cbegin(), strings.cend());
+  const auto symbol_table = FSSTSymbolTable::build(string_views);
+
+  EXPECT_GT(symbol_table.symbol_count(), 0);
+  EXPECT_LE(symbol_table.symbol_count(), FSSTSymbolTable::MAX_SYMBOL_COUNT);
+
+  for (const auto& string : strings) {
+    auto codes = std::string{};
+    symbol_table.encode(string, codes);
+    EXPECT_EQ(symbol_table.decode(codes), string);
+  }
+
+  // Repeated substrings are represented by multi-byte symbols.
+  auto codes = std::string{};
+  symbol_table.encode("https://www.hyrise.org", codes);
+  EXPECT_LT(codes.size(), std::string_view{"https://www.hyrise.org"}.size());
+}
+
+TEST_F(StorageFSSTSegmentTest, EmptySymbolTable) {
+  const auto symbol_table = FSSTSymbolTable::build({"", ""});
+  EXPECT_EQ(symbol_table.symbol_count(), 0);
+
+  // Strings that were not part of the input are escaped byte by byte.
+  auto codes = std::string{};
+  symbol_table.encode("abc", codes);
+  EXPECT_EQ(codes.size(), 6);
+  EXPECT_EQ(symbol_table.decode(codes), "abc");
+}
+
+TEST_F(StorageFSSTSegmentTest, InvalidSymbols) {
+  // Symbols are not sorted by their length.
+  EXPECT_THROW(FSSTSymbolTable(pmr_vector<uint64_t>{'a', 'a' | ('b' << 8)}, pmr_vector<uint8_t>{1, 2}),
+               std::logic_error);
+  // Symbol is too long.
+  EXPECT_THROW(FSSTSymbolTable(pmr_vector<uint64_t>{'a'}, pmr_vector<uint8_t>{9}), std::logic_error);
+}
+
+TEST_F(StorageFSSTSegmentTest, DecodedStartsWith) {
+  const auto strings = std::vector<std::string_view>{"hello world", "hello hyrise", "help", "world"};
+  const auto symbol_table = FSSTSymbolTable::build(strings);
+
+  auto codes = std::string{};
+  symbol_table.encode("hello world", codes);
+  EXPECT_TRUE(symbol_table.decoded_starts_with(codes, ""));
+  EXPECT_TRUE(symbol_table.decoded_starts_with(codes, "h"));
+  EXPECT_TRUE(symbol_table.decoded_starts_with(codes, "hel"));
+  EXPECT_TRUE(symbol_table.decoded_starts_with(codes, "hello w"));
+  EXPECT_TRUE(symbol_table.decoded_starts_with(codes, "hello world"));
+  EXPECT_FALSE(symbol_table.decoded_starts_with(codes, "hello world!"));
+  EXPECT_FALSE(symbol_table.decoded_starts_with(codes, "help"));
+  EXPECT_FALSE(symbol_table.decoded_starts_with(codes, "world"));
+
+  codes.clear();
+  symbol_table.encode("", codes);
+  EXPECT_TRUE(symbol_table.decoded_starts_with(codes, ""));
+  EXPECT_FALSE(symbol_table.decoded_starts_with(codes, "h"));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressNullableSegment) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("");
+  vs_str->append("Alexander");
+  auto fsst_segment = compress(vs_str);
+
+  EXPECT_EQ(fsst_segment->size(), 5);
+  EXPECT_EQ(fsst_segment->encoding_type(), EncodingType::FSST);
+  ASSERT_TRUE(fsst_segment->null_values());
+  EXPECT_EQ(*fsst_segment->null_values(), (pmr_vector<bool>{false, false, true, false, false}));
+
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{0}), "Alex");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{1}), "Peter");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{2}), std::nullopt);
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{3}), "");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{4}), "Alexander");
+  EXPECT_TRUE(variant_is_null((*fsst_segment)[ChunkOffset{2}]));
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{4}], AllTypeVariant{pmr_string{"Alexander"}});
+
+  // NULL values and empty strings do not have any codes.
+  EXPECT_TRUE(fsst_segment->compressed_value(ChunkOffset{2}).empty());
+  EXPECT_TRUE(fsst_segment->compressed_value(ChunkOffset{3}).empty());
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressSegmentWithoutNulls) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+  auto fsst_segment = compress(vs_str);
+
+  EXPECT_EQ(fsst_segment->size(), 2);
+  EXPECT_FALSE(fsst_segment->null_values());
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressEmptySegment) {
+  auto fsst_segment = compress(vs_str);
+
+  EXPECT_EQ(fsst_segment->size(), 0);
+  EXPECT_FALSE(fsst_segment->null_values());
+  EXPECT_EQ(fsst_segment->symbol_table().symbol_count(), 0);
+  EXPECT_TRUE(fsst_segment->compressed_values().empty());
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressedValueIterable) {
+  vs_str->append("hyrise");
+  vs_str->append("hyrise");
+  vs_str->append("hyrax");
+  auto fsst_segment = compress(vs_str);
+
+  // Equal strings are compressed to equal codes.
+  auto compressed_values = std::vector<std::string_view>{};
+  FSSTCompressedValueIterable{*fsst_segment}.for_each([&](const auto& position) {
+    compressed_values.emplace_back(position.value());
+  });
+  ASSERT_EQ(compressed_values.size(), 3);
+  EXPECT_EQ(compressed_values[0], compressed_values[1]);
+  EXPECT_NE(compressed_values[0], compressed_values[2]);
+  EXPECT_EQ(fsst_segment->symbol_table().decode(compressed_values[2]), "hyrax");
+}
+
+TEST_F(StorageFSSTSegmentTest, BinaryRoundTrip) {
+  const auto table = create_url_table(ChunkOffset{30});
+  BinaryWriter::write(*table, filename);
+  const auto parsed_table = BinaryParser::parse(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+  for (auto chunk_id = ChunkID{0}; chunk_id < parsed_table->chunk_count(); ++chunk_id) {
+    const auto& segment = parsed_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_TRUE(std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(segment));
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, ScanOnCodes) {
+  const auto table = create_url_table(ChunkOffset{30});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expect_row_count = [&](const auto& in, const auto predicate_condition, const auto& value,
+                                    const auto row_count) {
+    const auto scan = create_table_scan(in, ColumnID{0}, predicate_condition, pmr_string{value});
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), row_count);
+    return scan;
+  };
+
+  // 50 https URLs and 40 http URLs, the remaining 10 rows are NULL.
+  expect_row_count(table_wrapper, PredicateCondition::Equals, "https://www.hyrise.org/page/42", 1);
+  expect_row_count(table_wrapper, PredicateCondition::Equals, "https://www.hyrise.org/page/", 0);
+  expect_row_count(table_wrapper, PredicateCondition::NotEquals, "https://www.hyrise.org/page/42", 89);
+  expect_row_count(table_wrapper, PredicateCondition::Like, "https://%", 50);
+  expect_row_count(table_wrapper, PredicateCondition::Like, "http://hpi.de/research/1%", 5);
+  expect_row_count(table_wrapper, PredicateCondition::NotLike, "https://%", 40);
+  expect_row_count(table_wrapper, PredicateCondition::Like, "%hyrise%", 50);
+  expect_row_count(table_wrapper, PredicateCondition::LikeInsensitive, "HTTPS://%", 50);
+
+  // Scans on the output of other scans pass a position filter.
+  const auto http_scan = expect_row_count(table_wrapper, PredicateCondition::Like, "http:%", 40);
+  expect_row_count(http_scan, PredicateCondition::Equals, "http://hpi.de/research/11", 1);
+  expect_row_count(http_scan, PredicateCondition::Like, "http://hpi.de/research/1%", 5);
+}
+
+}  // namespace hyrise
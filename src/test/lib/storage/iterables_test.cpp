@@ -13,7 +13,9 @@
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/lz4_segment/lz4_segment_iterable.hpp"
+#include "storage/pos_lists/chunk_range_pos_list.hpp"
 #include "storage/reference_segment/reference_segment_iterable.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
@@ -371,6 +373,120 @@ TEST_P(EncodedSegmentChunkOffsetTest, IteratorWithIterators) {
   });
 }
 
+class EncodedSegmentDecodeBlockTest : public BaseTest, public ::testing::WithParamInterface<SegmentEncodingSpec> {
+ protected:
+  void SetUp() override {
+    // The segments span multiple decode blocks and multiple frames of FrameOfReferenceSegments. The values form runs
+    // of three rows and contain NULLs.
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, true}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{5'000});
+    for (auto row = int32_t{0}; row < 5'000; ++row) {
+      if (row % 11 == 0) {
+        table->append({NULL_VALUE, NULL_VALUE});
+      } else {
+        const auto value = (row / 3) % 700;
+        table->append({value, pmr_string{"value" + std::to_string(value)}});
+      }
+    }
+    table->last_chunk()->set_immutable();
+
+    auto chunk_encoding_spec = ChunkEncodingSpec{};
+    for (const auto& column_definition : column_definitions) {
+      if (encoding_supports_data_type(GetParam().encoding_type, column_definition.data_type)) {
+        chunk_encoding_spec.emplace_back(GetParam());
+      } else {
+        chunk_encoding_spec.emplace_back(EncodingType::Unencoded);
+      }
+    }
+    ChunkEncoder::encode_all_chunks(table, chunk_encoding_spec);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+INSTANTIATE_TEST_SUITE_P(SegmentEncoding, EncodedSegmentDecodeBlockTest,
+                         ::testing::ValuesIn(all_segment_encoding_specs), formatter_chunk_offset);
+
+TEST_P(EncodedSegmentDecodeBlockTest, DecodeBlockMatchesIterators) {
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    const auto abstract_segment = table->get_chunk(ChunkID{0})->get_segment(column_id);
+
+    resolve_data_and_segment_type(*abstract_segment, [&](const auto data_type_t, const auto& segment) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      using SegmentType = std::decay_t<decltype(segment)>;
+
+      if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
+        auto expected_values = std::vector<ColumnDataType>{};
+        auto expected_nulls = std::vector<bool>{};
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          expected_values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+          expected_nulls.emplace_back(position.is_null());
+        });
+
+        // Decode an unaligned range that starts and ends within runs and frames.
+        const auto iterable = create_iterable_from_segment<ColumnDataType, false /* no type erasure */>(segment);
+        const auto begin = ChunkOffset{1'001};
+        const auto count = size_t{2'500};
+        auto values = std::vector<ColumnDataType>(count);
+        auto nulls = std::make_unique<bool[]>(count);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        iterable.decode_block(begin, count, values.data(), nulls.get());
+        for (auto index = size_t{0}; index < count; ++index) {
+          EXPECT_EQ(nulls[index], expected_nulls[begin + index]);
+          if (!nulls[index]) {
+            EXPECT_EQ(values[index], expected_values[begin + index]);
+          }
+        }
+
+        // Decode the entire segment in blocks.
+        auto decoded_row_count = size_t{0};
+        segment_decode_blocks<ColumnDataType>(
+            segment, [&](const ChunkOffset block_begin, const size_t block_count, const ColumnDataType* block_values,
+                         const bool* block_nulls) {
+              EXPECT_EQ(block_begin, decoded_row_count);
+              EXPECT_LE(block_count, SEGMENT_DECODE_BLOCK_SIZE);
+              for (auto index = size_t{0}; index < block_count; ++index) {
+                EXPECT_EQ(block_nulls[index], expected_nulls[block_begin + index]);
+                if (!block_nulls[index]) {
+                  EXPECT_EQ(block_values[index], expected_values[block_begin + index]);
+                }
+              }
+              decoded_row_count += block_count;
+            });
+        EXPECT_EQ(decoded_row_count, expected_values.size());
+      }
+    });
+  }
+}
+
+TEST_P(EncodedSegmentDecodeBlockTest, ChunkRangePositionFilter) {
+  // Ranges are iterated with the sequential iterators, which report the offsets within the chunk.
+  const auto position_filter = std::make_shared<ChunkRangePosList>(ChunkID{0}, ChunkOffset{1'001}, ChunkOffset{3'501});
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    const auto& segment = *table->get_chunk(ChunkID{0})->get_segment(column_id);
+
+    resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto expected_positions = std::vector<std::pair<bool, ColumnDataType>>{};
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        expected_positions.emplace_back(position.is_null(), position.is_null() ? ColumnDataType{} : position.value());
+      });
+
+      auto expected_chunk_offset = position_filter->begin_offset();
+      segment_iterate_filtered<ColumnDataType>(segment, position_filter, [&](const auto& position) {
+        EXPECT_EQ(position.chunk_offset(), expected_chunk_offset);
+        EXPECT_EQ(position.is_null(), expected_positions[expected_chunk_offset].first);
+        if (!position.is_null()) {
+          EXPECT_EQ(position.value(), expected_positions[expected_chunk_offset].second);
+        }
+        ++expected_chunk_offset;
+      });
+      EXPECT_EQ(expected_chunk_offset, position_filter->end_offset());
+    });
+  }
+}
+
 // Reference Segment Tests
 
 TEST_F(IterablesTest, ReferenceSegmentIteratorWithIterators) {
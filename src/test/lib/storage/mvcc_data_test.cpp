@@ -1,3 +1,6 @@
+#include <sstream>
+#include <vector>
+
 #include "base_test.hpp"
 #include "storage/chunk.hpp"
 #include "storage/mvcc_data.hpp"
@@ -129,4 +132,139 @@ TEST_F(MvccDataTest, PendingInserts) {
   EXPECT_THROW(_mvcc_data->deregister_insert(), std::logic_error);
 }
 
+TEST_F(MvccDataTest, Compaction) {
+  // Without a known max begin CID, we cannot tell whether all rows have been committed.
+  EXPECT_FALSE(_mvcc_data->try_compact(ChunkOffset{3}));
+  EXPECT_FALSE(_mvcc_data->is_compacted());
+
+  _mvcc_data->max_begin_cid = CommitID{3};
+  EXPECT_TRUE(_mvcc_data->try_compact(ChunkOffset{3}));
+  EXPECT_TRUE(_mvcc_data->is_compacted());
+  EXPECT_FALSE(_mvcc_data->try_compact(ChunkOffset{3}));
+
+  // All rows appear to be inserted with the max begin CID. End CIDs and TIDs are preserved.
+  EXPECT_EQ(_mvcc_data->get_begin_cid(ChunkOffset{0}), CommitID{3});
+  EXPECT_EQ(_mvcc_data->get_begin_cid(ChunkOffset{2}), CommitID{3});
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{0}), CommitID{2});
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{1}), CommitID{4});
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{2}), MAX_COMMIT_ID);
+  EXPECT_EQ(_mvcc_data->get_tid(ChunkOffset{1}), TransactionID{1});
+
+  // Deletes still work on compacted MVCC data.
+  _mvcc_data->set_end_cid(ChunkOffset{2}, CommitID{6});
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{2}), CommitID{6});
+
+  if constexpr (HYRISE_DEBUG) {
+    EXPECT_THROW(_mvcc_data->set_begin_cid(ChunkOffset{2}, CommitID{5}), std::logic_error);
+  }
+
+  auto stream = std::stringstream{};
+  stream << *_mvcc_data;
+  EXPECT_EQ(stream.str(),
+            "TIDs: 0, 1, 0, \nBeginCID of all rows: 3\n"
+            "EndCIDs of invalidated rows: 0: 2, 1: 4, 2: 6, \n");
+}
+
+TEST_F(MvccDataTest, CompactionWithPendingAndRolledBackInserts) {
+  _mvcc_data = std::make_shared<MvccData>(ChunkOffset{3}, MAX_COMMIT_ID);
+  _mvcc_data->set_begin_cid(ChunkOffset{0}, CommitID{2});
+  _mvcc_data->set_tid(ChunkOffset{1}, TransactionID{5});
+  _mvcc_data->max_begin_cid = CommitID{2};
+
+  // Row 1 is locked by an uncommitted Insert.
+  EXPECT_FALSE(_mvcc_data->try_compact(ChunkOffset{3}));
+  EXPECT_FALSE(_mvcc_data->is_compacted());
+  EXPECT_EQ(_mvcc_data->get_begin_cid(ChunkOffset{0}), CommitID{2});
+
+  // Once the Insert has been rolled back, rows 1 and 2 are visible for no one.
+  _mvcc_data->set_tid(ChunkOffset{1}, INVALID_TRANSACTION_ID);
+  EXPECT_TRUE(_mvcc_data->try_compact(ChunkOffset{3}));
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{0}), MAX_COMMIT_ID);
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{1}), UNSET_COMMIT_ID);
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{2}), UNSET_COMMIT_ID);
+  EXPECT_EQ(_mvcc_data->visible_rows(CommitID{5}, ChunkOffset{3}), std::vector<uint64_t>{0b001});
+}
+
+TEST_F(MvccDataTest, VisibleRows) {
+  _mvcc_data->max_begin_cid = CommitID{3};
+  ASSERT_TRUE(_mvcc_data->try_compact(ChunkOffset{3}));
+
+  // Row 0 was deleted with CID 2, row 1 with CID 4.
+  EXPECT_EQ(_mvcc_data->visible_rows(CommitID{3}, ChunkOffset{3}), std::vector<uint64_t>{0b110});
+  EXPECT_EQ(_mvcc_data->visible_rows(CommitID{4}, ChunkOffset{3}), std::vector<uint64_t>{0b100});
+  EXPECT_EQ(_mvcc_data->visible_rows(CommitID{4}, ChunkOffset{2}), std::vector<uint64_t>{0b00});
+  EXPECT_THROW(_mvcc_data->visible_rows(CommitID{2}, ChunkOffset{3}), std::logic_error);
+
+  // Bitmaps span multiple words for larger chunks.
+  _mvcc_data = std::make_shared<MvccData>(ChunkOffset{100}, CommitID{1});
+  _mvcc_data->set_end_cid(ChunkOffset{70}, CommitID{2});
+  _mvcc_data->max_begin_cid = CommitID{1};
+  ASSERT_TRUE(_mvcc_data->try_compact(ChunkOffset{100}));
+  const auto visible_rows = _mvcc_data->visible_rows(CommitID{2}, ChunkOffset{100});
+  ASSERT_EQ(visible_rows.size(), 2);
+  EXPECT_EQ(visible_rows[0], ~uint64_t{0});
+  EXPECT_EQ(visible_rows[1], (uint64_t{1} << 36) - 1 - (uint64_t{1} << 6));
+}
+
+TEST_F(MvccDataTest, ReleaseRowVersions) {
+  _mvcc_data = std::make_shared<MvccData>(ChunkOffset{1'000}, CommitID{1});
+  _mvcc_data->max_begin_cid = CommitID{1};
+  EXPECT_THROW(_mvcc_data->release_row_versions(), std::logic_error);
+  EXPECT_TRUE(_mvcc_data->has_row_versions());
+
+  ASSERT_TRUE(_mvcc_data->try_compact(ChunkOffset{1'000}));
+  const auto memory_usage = _mvcc_data->memory_usage();
+  _mvcc_data->release_row_versions();
+  EXPECT_FALSE(_mvcc_data->has_row_versions());
+  EXPECT_LE(_mvcc_data->memory_usage() + 2 * 1'000 * sizeof(CommitID), memory_usage);
+
+  _mvcc_data->set_end_cid(ChunkOffset{999}, CommitID{2});
+  EXPECT_EQ(_mvcc_data->get_begin_cid(ChunkOffset{999}), CommitID{1});
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{999}), CommitID{2});
+}
+
+TEST_F(MvccDataTest, DeadRowCount) {
+  // Row 0 was deleted with CID 2, row 1 with CID 4.
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{1}, ChunkOffset{3}), 0);
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{2}, ChunkOffset{3}), 1);
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{4}, ChunkOffset{3}), 2);
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{4}, ChunkOffset{1}), 1);
+
+  _mvcc_data->max_begin_cid = CommitID{3};
+  ASSERT_TRUE(_mvcc_data->try_compact(ChunkOffset{3}));
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{3}, ChunkOffset{3}), 1);
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{4}, ChunkOffset{3}), 2);
+
+  // Rows of rolled back Inserts are dead, rows of pending Inserts are not.
+  _mvcc_data = std::make_shared<MvccData>(ChunkOffset{3}, MAX_COMMIT_ID);
+  _mvcc_data->set_begin_cid(ChunkOffset{0}, CommitID{2});
+  _mvcc_data->set_tid(ChunkOffset{1}, TransactionID{5});
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{2}, ChunkOffset{3}), 1);
+}
+
+TEST_F(MvccDataTest, CollectGarbage) {
+  EXPECT_THROW(_mvcc_data->collect_garbage(CommitID{3}), std::logic_error);
+
+  _mvcc_data->max_begin_cid = CommitID{3};
+  ASSERT_TRUE(_mvcc_data->try_compact(ChunkOffset{3}));
+
+  // Only the end CID of row 0 is older than the horizon. Row 0 stays invalidated.
+  EXPECT_EQ(_mvcc_data->collect_garbage(CommitID{3}), 1);
+  EXPECT_EQ(_mvcc_data->collect_garbage(CommitID{3}), 0);
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{0}), CommitID{3});
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{1}), CommitID{4});
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{2}), MAX_COMMIT_ID);
+  EXPECT_EQ(_mvcc_data->visible_rows(CommitID{3}, ChunkOffset{3}), std::vector<uint64_t>{0b110});
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{3}, ChunkOffset{3}), 1);
+
+  EXPECT_EQ(_mvcc_data->collect_garbage(CommitID{4}), 1);
+  EXPECT_EQ(_mvcc_data->get_end_cid(ChunkOffset{1}), CommitID{4});
+  EXPECT_EQ(_mvcc_data->visible_rows(CommitID{4}, ChunkOffset{3}), std::vector<uint64_t>{0b100});
+  EXPECT_EQ(_mvcc_data->dead_row_count(CommitID{4}, ChunkOffset{3}), 2);
+
+  auto stream = std::stringstream{};
+  stream << *_mvcc_data;
+  EXPECT_EQ(stream.str(), "TIDs: 0, 1, 0, \nBeginCID of all rows: 3\nEndCIDs of invalidated rows: \n");
+}
+
 }  // namespace hyrise
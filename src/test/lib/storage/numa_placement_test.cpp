@@ -0,0 +1,85 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+class NumaPlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().topology.use_fake_numa_topology(std::vector<uint32_t>{2, 2});
+    _table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{1});
+  }
+
+  std::shared_ptr<Table> _create_reference_chunk_table(const std::shared_ptr<AbstractPosList>& pos_list) const {
+    auto segments = Segments{};
+    segments.emplace_back(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list));
+    segments.emplace_back(std::make_shared<ReferenceSegment>(_table, ColumnID{1}, pos_list));
+
+    const auto reference_table = std::make_shared<Table>(_table->column_definitions(), TableType::References);
+    reference_table->append_chunk(segments);
+    return reference_table;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(NumaPlacementTest, NodesForChunks) {
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{0}), NodeID{0});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{1}), NodeID{1});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{2}), NodeID{0});
+
+  // Nodes without workers do not get chunks.
+  Hyrise::get().topology.use_fake_numa_topology(std::vector<uint32_t>{2, 0, 2});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{1}), NodeID{2});
+
+  // With a single node, chunks are not placed.
+  Hyrise::get().topology.use_fake_numa_topology(std::vector<uint32_t>{4});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{1}), INVALID_NODE_ID);
+}
+
+TEST_F(NumaPlacementTest, PlaceTable) {
+  const auto chunk_count = _table->chunk_count();
+  ASSERT_EQ(chunk_count, 3);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->node_id(), INVALID_NODE_ID);
+  }
+
+  place_table_on_numa_nodes(*_table);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->node_id(), NodeID{0});
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->node_id(), NodeID{1});
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->node_id(), NodeID{0});
+
+  // The data is unchanged.
+  EXPECT_TABLE_EQ_ORDERED(_table, load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{1}));
+}
+
+TEST_F(NumaPlacementTest, NodeOfReferenceChunk) {
+  place_table_on_numa_nodes(*_table);
+  EXPECT_EQ(numa_node_of_chunk(*_table->get_chunk(ChunkID{1})), NodeID{1});
+
+  // Chunks referencing a single chunk inherit its node.
+  const auto single_chunk_table =
+      _create_reference_chunk_table(std::make_shared<EntireChunkPosList>(ChunkID{1}, ChunkOffset{1}));
+  EXPECT_EQ(numa_node_of_chunk(*single_chunk_table->get_chunk(ChunkID{0})), NodeID{1});
+
+  // Chunks referencing multiple chunks (or none) have no node.
+  const auto multi_chunk_table = _create_reference_chunk_table(
+      std::make_shared<RowIDPosList>(
+          std::initializer_list<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_EQ(numa_node_of_chunk(*multi_chunk_table->get_chunk(ChunkID{0})), INVALID_NODE_ID);
+
+  const auto empty_table = _create_reference_chunk_table(std::make_shared<RowIDPosList>());
+  EXPECT_EQ(numa_node_of_chunk(*empty_table->get_chunk(ChunkID{0})), INVALID_NODE_ID);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,162 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_advisor.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class SegmentEncodingAdvisorTest : public BaseTest {
+ protected:
+  static constexpr auto row_count = int32_t{10'000};
+
+  template <typename T, typename Generator>
+  static std::shared_ptr<ValueSegment<T>> create_segment(const Generator& generator) {
+    auto values = pmr_vector<T>(row_count);
+    for (auto index = int32_t{0}; index < row_count; ++index) {
+      values[index] = generator(index);
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+};
+
+TEST_F(SegmentEncodingAdvisorTest, CollectStatistics) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(
+      pmr_vector<int32_t>{1, 1, 2, 0, 0, 3, 3}, pmr_vector<bool>{false, false, false, true, true, false, false});
+
+  const auto statistics = collect_segment_encoding_statistics(segment, DataType::Int);
+  EXPECT_EQ(statistics.data_type, DataType::Int);
+  EXPECT_EQ(statistics.row_count, 7);
+  EXPECT_EQ(statistics.null_count, 2);
+  EXPECT_EQ(statistics.distinct_count, 3);
+  EXPECT_EQ(statistics.run_count, 4);
+  EXPECT_EQ(statistics.max_frame_offset, 2);
+
+  const auto unique_statistics = collect_segment_encoding_statistics(segment, DataType::Int, true);
+  EXPECT_EQ(unique_statistics.distinct_count, 5);
+
+  const auto long_string = pmr_string(100, 'a');
+  const auto string_segment =
+      std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{"a", "bc", "bc", long_string});
+  const auto string_statistics = collect_segment_encoding_statistics(string_segment, DataType::String);
+  EXPECT_EQ(string_statistics.distinct_count, 3);
+  EXPECT_EQ(string_statistics.run_count, 3);
+  EXPECT_EQ(string_statistics.string_bytes, 105);
+  EXPECT_EQ(string_statistics.distinct_string_bytes, 103);
+  EXPECT_EQ(string_statistics.string_heap_bytes, 101);
+  EXPECT_EQ(string_statistics.max_string_length, 100);
+  EXPECT_FALSE(string_statistics.max_frame_offset);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, CollectStatisticsReadsAccessHistory) {
+  const auto segment = create_segment<int32_t>([](const auto index) {
+    return index;
+  });
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 10;
+  segment->access_counter[SegmentAccessCounter::AccessType::Monotonic] = 20;
+  segment->access_counter[SegmentAccessCounter::AccessType::Point] = 30;
+  segment->access_counter[SegmentAccessCounter::AccessType::Random] = 40;
+
+  const auto statistics = collect_segment_encoding_statistics(segment, DataType::Int);
+  EXPECT_EQ(statistics.sequential_access_count, 30);
+  EXPECT_EQ(statistics.random_access_count, 70);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, CollectStatisticsDoesNotCountAccesses) {
+  const auto segment = create_segment<int32_t>([](const auto index) {
+    return index % 10;
+  });
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 10;
+
+  // Reading the segment for the advice must not change the access history the advice is based on.
+  const auto statistics = collect_segment_encoding_statistics(segment, DataType::Int);
+  EXPECT_EQ(statistics.distinct_count, 10);
+  EXPECT_EQ(segment->access_counter[SegmentAccessCounter::AccessType::Sequential], 10);
+
+  const auto dictionary_segment =
+      ChunkEncoder::encode_segment(segment, DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto previous_access_counter = dictionary_segment->access_counter;
+  const auto dictionary_statistics = collect_segment_encoding_statistics(dictionary_segment, DataType::Int);
+  EXPECT_EQ(dictionary_statistics.distinct_count, 10);
+  EXPECT_EQ(dictionary_segment->access_counter, previous_access_counter);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, EstimateEncodedSegmentSize) {
+  auto statistics = SegmentEncodingStatistics{};
+  statistics.data_type = DataType::Int;
+  statistics.row_count = ChunkOffset{4096};
+  statistics.distinct_count = 4;
+  statistics.run_count = 2;
+  statistics.max_frame_offset = 3;
+
+  EXPECT_EQ(estimate_encoded_segment_size(statistics, SegmentEncodingSpec{EncodingType::Unencoded}), 4096 * 4);
+  EXPECT_EQ(estimate_encoded_segment_size(
+                statistics, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger}),
+            4 * 4 + 4096);
+  EXPECT_EQ(estimate_encoded_segment_size(
+                statistics, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking}),
+            4 * 4 + 4096 * 3 / 8);
+  EXPECT_EQ(estimate_encoded_segment_size(
+                statistics, SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::BitPacking}),
+            2 * 4 + 4096 * 2 / 8);
+  EXPECT_EQ(estimate_encoded_segment_size(statistics, SegmentEncodingSpec{EncodingType::RunLength}), 2 * (4 + 4) + 1);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, SmallSegmentsUseDefaultEncoding) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{1, 1, 1, 1, 1});
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::Int), SegmentEncodingSpec{EncodingType::FrameOfReference});
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::Int, true), SegmentEncodingSpec{EncodingType::Unencoded});
+}
+
+TEST_F(SegmentEncodingAdvisorTest, SortedValuesUseRunLength) {
+  const auto segment = create_segment<int32_t>([](const auto index) {
+    return index / 1'000;
+  });
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::Int).encoding_type, EncodingType::RunLength);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, ColdSegmentsUseBitPacking) {
+  const auto segment = create_segment<int32_t>([](const auto index) {
+    return index % 4;
+  });
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::Int),
+            (SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::BitPacking}));
+
+  // After ten full scans, decoding speed outweighs the memory savings.
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 10 * row_count;
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::Int), SegmentEncodingSpec{EncodingType::Unencoded});
+}
+
+TEST_F(SegmentEncodingAdvisorTest, FewDistinctStringsUseDictionary) {
+  const auto segment = create_segment<pmr_string>([](const auto index) {
+    return pmr_string{"value_"} + pmr_string{std::to_string(index % 5)};
+  });
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::String).encoding_type, EncodingType::Dictionary);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, ShortUniqueStringsUseFixedStringDictionary) {
+  const auto segment = create_segment<pmr_string>([](const auto index) {
+    return pmr_string{"value_"} + pmr_string{std::to_string(index)};
+  });
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::String).encoding_type,
+            EncodingType::FixedStringDictionary);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, LongUniqueStringsUseLZ4UnlessAccessedRandomly) {
+  const auto segment = create_segment<pmr_string>([](const auto index) {
+    return pmr_string(20 + index % 180, static_cast<char>('a' + index % 26)) + pmr_string{std::to_string(index)};
+  });
+  EXPECT_EQ(advise_segment_encoding_spec(segment, DataType::String).encoding_type, EncodingType::LZ4);
+
+  segment->access_counter[SegmentAccessCounter::AccessType::Random] = row_count;
+  EXPECT_NE(advise_segment_encoding_spec(segment, DataType::String).encoding_type, EncodingType::LZ4);
+}
+
+}  // namespace hyrise
@@ -341,4 +341,49 @@ TEST_F(StorageTableTest, CreatePartialHashIndexOnEmptyChunks) {
   EXPECT_THROW(table->create_partial_hash_index(ColumnID{0}, {}), std::logic_error);
 }
 
+TEST_F(StorageTableTest, InsertShards) {
+  EXPECT_EQ(table->insert_shard_count(), 1);
+  EXPECT_THROW(table->set_insert_shard_count(4), std::logic_error);
+
+  const auto mvcc_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  EXPECT_THROW(mvcc_table->set_insert_shard_count(0), std::logic_error);
+  mvcc_table->set_insert_shard_count(4);
+  EXPECT_EQ(mvcc_table->insert_shard_count(), 4);
+  EXPECT_TRUE(mvcc_table->insert_tail_chunk_ids().empty());
+
+  // The calling thread always uses the same shard.
+  auto& shard = mvcc_table->insert_shard();
+  EXPECT_EQ(&mvcc_table->insert_shard(), &shard);
+
+  mvcc_table->append_mutable_chunk();
+  shard.tail_chunk_id = ChunkID{0};
+  EXPECT_EQ(mvcc_table->insert_tail_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+
+  // The shard count cannot be changed while there are mutable chunks.
+  EXPECT_THROW(mvcc_table->set_insert_shard_count(1), std::logic_error);
+}
+
+TEST_F(StorageTableTest, InsertTailOfSingleShard) {
+  const auto mvcc_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  EXPECT_TRUE(mvcc_table->insert_tail_chunk_ids().empty());
+
+  mvcc_table->append({4, "Hello,"});
+  mvcc_table->append({6, "world"});
+  mvcc_table->append({3, "!"});
+  EXPECT_EQ(mvcc_table->insert_tail_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+
+  EXPECT_EQ(mvcc_table->insert_tail_chunk_id(), ChunkID{1});
+
+  // A kept tail remains the insert tail when chunks are appended after it.
+  mvcc_table->keep_insert_tail();
+  mvcc_table->append_chunk(mvcc_table->get_chunk(ChunkID{0})->segments(), std::make_shared<MvccData>(2, CommitID{0}));
+  mvcc_table->last_chunk()->set_immutable();
+  EXPECT_EQ(mvcc_table->insert_tail_chunk_id(), ChunkID{1});
+  EXPECT_EQ(mvcc_table->insert_tail_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+
+  mvcc_table->get_chunk(ChunkID{1})->set_immutable();
+  EXPECT_EQ(mvcc_table->insert_tail_chunk_id(), ChunkID{2});
+  EXPECT_TRUE(mvcc_table->insert_tail_chunk_ids().empty());
+}
+
 }  // namespace hyrise
@@ -8,9 +8,12 @@
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
 #include "operators/validate.hpp"
+#include "statistics/segment_sketch.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
 #include "tasks/chunk_compression_task.hpp"
 #include "types.hpp"
 
@@ -63,6 +66,14 @@ TEST_F(ChunkCompressionTaskTest, DictionarySize) {
       ASSERT_TRUE(dict_segment);
       EXPECT_EQ(dict_segment->unique_values_count(), dictionary_sizes[chunk_id][column_id]);
     }
+
+    // The sketches for the StatisticsMaintenancePlugin are built once the chunk is compressed.
+    const auto sketches = chunk->sketches();
+    ASSERT_TRUE(sketches);
+    ASSERT_EQ(sketches->size(), chunk->column_count());
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      EXPECT_NEAR((*sketches)[column_id].distinct_values.estimate(), dictionary_sizes[chunk_id][column_id], 0.5);
+    }
   }
 }
 
@@ -104,6 +115,23 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12);
 }
 
+TEST_F(ChunkCompressionTaskTest, AdviseEncodingPerSegment) {
+  const auto column_definitions =
+      TableColumnDefinitions{{"sorted", DataType::Int, false}, {"few_distinct", DataType::String, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2'000}, UseMvcc::Yes);
+  for (auto row_id = int32_t{0}; row_id < 2'000; ++row_id) {
+    table->append({row_id / 100, pmr_string{row_id % 2 == 0 ? "even" : "odd"}});
+  }
+  table->last_chunk()->set_immutable();
+
+  const auto compression_task = std::make_shared<ChunkCompressionTask>(table, ChunkID{0});
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({compression_task});
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(ColumnID{1})));
+}
+
 TEST_F(ChunkCompressionTaskTest, IgnoreDeletedChunk) {
   const auto table = load_table("resources/test_data/tbl/compression_input.tbl", ChunkOffset{8});
   table->get_chunk(ChunkID{0})->increase_invalid_row_count(ChunkOffset{8});
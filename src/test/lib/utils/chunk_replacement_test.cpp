@@ -0,0 +1,117 @@
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/chunk_replacement.hpp"
+
+namespace hyrise {
+
+class ChunkReplacementTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Values 9..1 in three chunks of three rows.
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                     ChunkOffset{3}, UseMvcc::Yes);
+    for (auto value = int32_t{9}; value >= 1; --value) {
+      _table->append({value});
+    }
+    _table->last_chunk()->set_immutable();
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+ protected:
+  static size_t _visible_row_count(const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkReplacementTest, ReplaceChunks) {
+  const auto chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{1}};
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+  ASSERT_TRUE(_table->try_claim_chunks_for_cleanup(chunk_ids));
+  EXPECT_TRUE(try_replace_chunks("table_a", _table, chunk_ids, sort_definitions));
+
+  // The valid rows of the old chunks are appended in sorted order. The old chunks are logically deleted.
+  ASSERT_EQ(_table->chunk_count(), 5);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->get_cleanup_commit_id());
+  auto expected_value = int32_t{4};
+  for (const auto chunk_id : {ChunkID{3}, ChunkID{4}}) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_EQ(chunk->individually_sorted_by(), sort_definitions);
+    ASSERT_EQ(chunk->size(), 3);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 3; ++chunk_offset) {
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{expected_value});
+      ++expected_value;
+    }
+  }
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 9);
+}
+
+TEST_F(ChunkReplacementTest, ConflictReleasesClaims) {
+  const auto chunk_ids = std::vector<ChunkID>{ChunkID{0}};
+  ASSERT_TRUE(_table->try_claim_chunks_for_cleanup(chunk_ids));
+
+  // A concurrent transaction locks the rows of chunk 0.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  const auto delete_operator = std::make_shared<Delete>(validate);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+
+  EXPECT_FALSE(try_replace_chunks("table_a", _table, chunk_ids));
+  EXPECT_EQ(_table->chunk_count(), 3);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  // The chunk can be claimed again.
+  EXPECT_TRUE(_table->try_claim_chunks_for_cleanup(chunk_ids));
+  _table->release_cleanup_claims(chunk_ids);
+  transaction_context->rollback(RollbackReason::User);
+}
+
+TEST_F(ChunkReplacementTest, DeferredChunkRemoval) {
+  auto removal = DeferredChunkRemoval{};
+  const auto chunk_ids = std::vector<ChunkID>{ChunkID{0}};
+  ASSERT_TRUE(_table->try_claim_chunks_for_cleanup(chunk_ids));
+
+  // The old chunk must not be removed as long as a transaction that started before the replacement is active.
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  ASSERT_TRUE(try_replace_chunks("table_a", _table, chunk_ids));
+  removal.add(_table, ChunkID{0});
+  EXPECT_EQ(removal.remove_invisible_chunks(), 0);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(_visible_row_count(transaction_context), 9);
+
+  transaction_context->commit();
+  transaction_context = nullptr;
+  EXPECT_EQ(removal.remove_invisible_chunks(), 1);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(removal.remove_invisible_chunks(), 0);
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 9);
+}
+
+}  // namespace hyrise
@@ -122,7 +122,8 @@ TEST_F(PrintUtilsTest, print_expressions) {
 }
 
 TEST_F(PrintUtilsTest, all_encoding_options) {
-  EXPECT_EQ(all_encoding_options(), "Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference, LZ4");
+  EXPECT_EQ(all_encoding_options(),
+            "Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference, LZ4, FSST");
 }
 
 }  // namespace hyrise
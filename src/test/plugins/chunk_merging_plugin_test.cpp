@@ -0,0 +1,267 @@
+#include <memory>
+#include <vector>
+
+#include "../../plugins/chunk_merging_plugin.hpp"
+#include "../../plugins/mvcc_delete_plugin.hpp"
+#include "all_type_variant.hpp"
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class ChunkMergingPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Values 1..16 in four chunks of four rows.
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                     ChunkOffset{4}, UseMvcc::Yes);
+    for (auto value = int32_t{1}; value <= 16; ++value) {
+      _table->append({value});
+    }
+    _table->last_chunk()->set_immutable();
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+ protected:
+  static size_t _merge_chunks(ChunkMergingPlugin& plugin) {
+    return plugin._merge_chunks();
+  }
+
+  static std::vector<ChunkID> _merge_candidates(const Table& table) {
+    return ChunkMergingPlugin::_merge_candidates(table);
+  }
+
+  static bool _try_merge_chunks(ChunkMergingPlugin& plugin, const std::shared_ptr<Table>& table,
+                                const std::vector<ChunkID>& chunk_ids) {
+    return plugin._try_merge_chunks("table_a", table, chunk_ids);
+  }
+
+  static void _collect_garbage(MvccDeletePlugin& plugin) {
+    plugin._garbage_collection_loop();
+  }
+
+  static void _delete_rows(const int32_t min_value, const int32_t max_value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    const auto table_scan = std::make_shared<TableScan>(
+        validate, between_inclusive_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), min_value, max_value));
+    table_scan->execute();
+
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    delete_operator->set_transaction_context(transaction_context);
+    delete_operator->execute();
+    transaction_context->commit();
+  }
+
+  static size_t _seal_idle_deltas(ChunkMergingPlugin& plugin) {
+    return plugin._seal_idle_deltas();
+  }
+
+  void _insert_row(const int32_t value) {
+    const auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    values->append({value});
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  static size_t _visible_row_count(const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkMergingPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseChunkMergingPlugin")));
+  EXPECT_NO_THROW(plugin_manager.exec_user_function("hyriseChunkMergingPlugin", "MergeChunks"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseChunkMergingPlugin"));
+}
+
+TEST_F(ChunkMergingPluginTest, DescriptionAndProvidedFunction) {
+  auto plugin = ChunkMergingPlugin{};
+  EXPECT_EQ(plugin.description(), "Chunk merging plugin");
+  const auto& provided_functions = plugin.provided_user_executable_functions();
+  ASSERT_EQ(provided_functions.size(), 1);
+  EXPECT_EQ(provided_functions.front().first, "MergeChunks");
+}
+
+TEST_F(ChunkMergingPluginTest, MergeCandidates) {
+  EXPECT_TRUE(_merge_candidates(*_table).empty());
+
+  // Chunks 0 and 3 keep a single valid row each, but are not adjacent.
+  _delete_rows(1, 3);
+  _delete_rows(13, 15);
+  EXPECT_TRUE(_merge_candidates(*_table).empty());
+
+  // Chunk 1 with two valid rows is sparse as well.
+  _delete_rows(5, 6);
+  EXPECT_EQ(_merge_candidates(*_table), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+
+  // Physically deleted chunks do not separate their neighbors.
+  _delete_rows(9, 12);
+  EXPECT_EQ(_merge_candidates(*_table), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}}));
+  _table->get_chunk(ChunkID{2})->set_cleanup_commit_id(Hyrise::get().transaction_manager.last_commit_id());
+  _table->remove_chunk(ChunkID{2});
+  EXPECT_EQ(_merge_candidates(*_table), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{3}}));
+}
+
+TEST_F(ChunkMergingPluginTest, MergeSparseChunks) {
+  auto plugin = ChunkMergingPlugin{};
+  EXPECT_EQ(_merge_chunks(plugin), 0);
+
+  _delete_rows(1, 3);
+  _delete_rows(5, 6);
+  EXPECT_EQ(_merge_chunks(plugin), 2);
+
+  // The valid rows of chunks 0 and 1 are appended in their original order as a new chunk.
+  ASSERT_EQ(_table->chunk_count(), 5);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  const auto merged_chunk = _table->get_chunk(ChunkID{4});
+  EXPECT_FALSE(merged_chunk->is_mutable());
+  ASSERT_EQ(merged_chunk->size(), 3);
+  EXPECT_EQ((*merged_chunk->get_segment(ColumnID{0}))[ChunkOffset{0}], AllTypeVariant{4});
+  EXPECT_EQ((*merged_chunk->get_segment(ColumnID{0}))[ChunkOffset{1}], AllTypeVariant{7});
+  EXPECT_EQ((*merged_chunk->get_segment(ColumnID{0}))[ChunkOffset{2}], AllTypeVariant{8});
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 11);
+
+  // The merged chunk is not sparse. The next run only removes the old chunks physically.
+  EXPECT_EQ(_merge_chunks(plugin), 0);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1}));
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 11);
+}
+
+TEST_F(ChunkMergingPluginTest, KeepChunksVisibleToActiveTransactions) {
+  auto plugin = ChunkMergingPlugin{};
+  _delete_rows(1, 3);
+  _delete_rows(5, 6);
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(_merge_chunks(plugin), 2);
+
+  // The old chunks must not be removed as long as the transaction that started before the merge is active.
+  EXPECT_EQ(_merge_chunks(plugin), 0);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(_visible_row_count(transaction_context), 11);
+
+  transaction_context->commit();
+  transaction_context = nullptr;
+  EXPECT_EQ(_merge_chunks(plugin), 0);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}));
+}
+
+TEST_F(ChunkMergingPluginTest, ConcurrentGarbageCollection) {
+  auto plugin = ChunkMergingPlugin{};
+  auto mvcc_delete_plugin = MvccDeletePlugin{};
+
+  // Chunks 0 and 1 are sparse and consist mostly of dead rows. Thus, they are candidates for both the merge and the
+  // garbage collection of the MvccDeletePlugin.
+  _delete_rows(1, 3);
+  _delete_rows(5, 6);
+  const auto chunk_ids = _merge_candidates(*_table);
+  ASSERT_EQ(chunk_ids, (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+
+  // The garbage collection rewrites the chunks after we chose them. The merge must skip them.
+  _collect_garbage(mvcc_delete_plugin);
+  ASSERT_EQ(_table->chunk_count(), 5);
+  const auto cleanup_commit_id = _table->get_chunk(ChunkID{0})->get_cleanup_commit_id();
+  ASSERT_TRUE(cleanup_commit_id);
+  EXPECT_FALSE(_try_merge_chunks(plugin, _table, chunk_ids));
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id(), cleanup_commit_id);
+  EXPECT_EQ(_table->chunk_count(), 5);
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 11);
+
+  // Vice versa, the garbage collection skips chunks that the merge claimed.
+  _delete_rows(9, 11);
+  _delete_rows(13, 14);
+  ASSERT_TRUE(_table->try_claim_chunks_for_cleanup({ChunkID{2}}));
+  _collect_garbage(mvcc_delete_plugin);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->get_cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{3})->get_cleanup_commit_id());
+  _table->release_cleanup_claims({ChunkID{2}});
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 6);
+}
+
+
+TEST_F(ChunkMergingPluginTest, SealIdleDeltas) {
+  auto plugin = ChunkMergingPlugin{};
+  _insert_row(17);
+  ASSERT_EQ(_table->chunk_count(), 5);
+  const auto delta = _table->get_chunk(ChunkID{4});
+
+  // The delta is only sealed once it did not grow since the previous run.
+  EXPECT_EQ(_seal_idle_deltas(plugin), 0);
+  _insert_row(18);
+  EXPECT_EQ(_seal_idle_deltas(plugin), 0);
+  EXPECT_TRUE(delta->is_mutable());
+  EXPECT_EQ(_seal_idle_deltas(plugin), 1);
+  EXPECT_FALSE(delta->is_mutable());
+  EXPECT_TRUE(delta->is_full());
+  EXPECT_EQ(_seal_idle_deltas(plugin), 0);
+
+  // Subsequent Inserts continue in a new chunk.
+  _insert_row(19);
+  ASSERT_EQ(_table->chunk_count(), 6);
+  EXPECT_EQ(delta->size(), 2);
+  EXPECT_EQ(_table->get_chunk(ChunkID{5})->size(), 1);
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 19);
+}
+
+TEST_F(ChunkMergingPluginTest, MergeSealedDeltas) {
+  auto plugin = ChunkMergingPlugin{};
+  _insert_row(17);
+  EXPECT_EQ(_merge_chunks(plugin), 0);
+
+  // The sealed delta has no sparse neighbor yet.
+  EXPECT_EQ(_merge_chunks(plugin), 0);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{4})->is_mutable());
+
+  _insert_row(18);
+  EXPECT_EQ(_merge_chunks(plugin), 0);
+  EXPECT_EQ(_merge_chunks(plugin), 2);
+
+  ASSERT_EQ(_table->chunk_count(), 7);
+  const auto merged_chunk = _table->get_chunk(ChunkID{6});
+  ASSERT_EQ(merged_chunk->size(), 2);
+  EXPECT_EQ((*merged_chunk->get_segment(ColumnID{0}))[ChunkOffset{0}], AllTypeVariant{17});
+  EXPECT_EQ((*merged_chunk->get_segment(ColumnID{0}))[ChunkOffset{1}], AllTypeVariant{18});
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 18);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,199 @@
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../plugins/clustering_plugin.hpp"
+#include "all_type_variant.hpp"
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class ClusteringPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Twelve rows in four chunks of three rows. Column a holds a permutation of 1..12, column b its negation.
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}},
+                                     TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    for (const auto value : {7, 2, 11, 4, 12, 1, 9, 5, 3, 10, 6, 8}) {
+      _table->append({value, -value});
+    }
+    _table->last_chunk()->set_immutable();
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+
+    Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  }
+
+ protected:
+  static size_t _cluster_tables(ClusteringPlugin& plugin) {
+    return plugin._cluster_tables();
+  }
+
+  static std::unordered_map<std::string, ColumnID> _clustering_keys(const ClusteringPlugin& plugin) {
+    return plugin._clustering_keys();
+  }
+
+  static void _set_clustering_keys(ClusteringPlugin& plugin, const std::string& value) {
+    plugin._clustering_keys_setting->set(value);
+  }
+
+  static size_t _visible_row_count(const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ClusteringPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseClusteringPlugin")));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("ClusteringPlugin.clustering_keys"));
+  EXPECT_NO_THROW(plugin_manager.exec_user_function("hyriseClusteringPlugin", "ClusterTables"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseClusteringPlugin"));
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("ClusteringPlugin.clustering_keys"));
+}
+
+TEST_F(ClusteringPluginTest, DescriptionAndProvidedFunction) {
+  auto plugin = ClusteringPlugin{};
+  EXPECT_EQ(plugin.description(), "Chunk clustering plugin");
+  const auto& provided_functions = plugin.provided_user_executable_functions();
+  ASSERT_EQ(provided_functions.size(), 1);
+  EXPECT_EQ(provided_functions.front().first, "ClusterTables");
+}
+
+TEST_F(ClusteringPluginTest, ConfiguredClusteringKeys) {
+  auto plugin = ClusteringPlugin{};
+  EXPECT_TRUE(_clustering_keys(plugin).empty());
+
+  _set_clustering_keys(plugin, "table_a.b, unknown_table.a,table_a.a");
+  const auto expected_keys = std::unordered_map<std::string, ColumnID>{{"table_a", ColumnID{0}}};
+  EXPECT_EQ(_clustering_keys(plugin), expected_keys);
+
+  // Unknown columns are skipped.
+  _set_clustering_keys(plugin, "table_a.c");
+  EXPECT_TRUE(_clustering_keys(plugin).empty());
+
+  EXPECT_THROW(_set_clustering_keys(plugin, "table_a"), InvalidInputException);
+  EXPECT_THROW(_set_clustering_keys(plugin, "table_a."), InvalidInputException);
+}
+
+TEST_F(ClusteringPluginTest, LearnedClusteringKeys) {
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+
+  // Column-to-column comparisons are no candidates.
+  Hyrise::get().default_lqp_cache->set("ColumnComparison", PredicateNode::make(equals_(a, b), stored_table_node));
+  auto plugin = ClusteringPlugin{};
+  EXPECT_TRUE(_clustering_keys(plugin).empty());
+
+  // Predicates are weighted by the frequency of their plans.
+  Hyrise::get().default_lqp_cache->set("PredicateA", PredicateNode::make(less_than_(a, 5), stored_table_node));
+  for (auto execution = 0; execution < 3; ++execution) {
+    Hyrise::get().default_lqp_cache->set("PredicateB",
+                                         PredicateNode::make(between_inclusive_(b, -8, -3), stored_table_node));
+  }
+  auto expected_keys = std::unordered_map<std::string, ColumnID>{{"table_a", ColumnID{1}}};
+  EXPECT_EQ(_clustering_keys(plugin), expected_keys);
+
+  // Configured keys take precedence.
+  _set_clustering_keys(plugin, "table_a.a");
+  expected_keys = std::unordered_map<std::string, ColumnID>{{"table_a", ColumnID{0}}};
+  EXPECT_EQ(_clustering_keys(plugin), expected_keys);
+}
+
+TEST_F(ClusteringPluginTest, ClusterChunks) {
+  auto plugin = ClusteringPlugin{};
+  EXPECT_EQ(_cluster_tables(plugin), 0);
+
+  _set_clustering_keys(plugin, "table_a.a");
+  EXPECT_EQ(_cluster_tables(plugin), 4);
+
+  // The old chunks are logically deleted, the rows are reinserted in sorted order with disjoint value ranges.
+  ASSERT_EQ(_table->chunk_count(), 8);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->get_cleanup_commit_id());
+  }
+
+  const auto sorted_by = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+  auto expected_value = int32_t{1};
+  for (auto chunk_id = ChunkID{4}; chunk_id < 8; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_EQ(chunk->individually_sorted_by(), sorted_by);
+    ASSERT_EQ(chunk->size(), 3);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 3; ++chunk_offset) {
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{expected_value});
+      EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{-expected_value});
+      ++expected_value;
+    }
+  }
+
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 12);
+
+  // All chunks are sorted now. The next run only removes the old chunks physically.
+  EXPECT_EQ(_cluster_tables(plugin), 0);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    EXPECT_FALSE(_table->get_chunk(chunk_id));
+  }
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 12);
+}
+
+TEST_F(ClusteringPluginTest, KeepChunksVisibleToActiveTransactions) {
+  auto plugin = ClusteringPlugin{};
+  _set_clustering_keys(plugin, "table_a.a");
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(_cluster_tables(plugin), 4);
+
+  // The old chunks must not be removed as long as the transaction that started before the reorganization is active.
+  EXPECT_EQ(_cluster_tables(plugin), 0);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(_visible_row_count(transaction_context), 12);
+
+  transaction_context->commit();
+  transaction_context = nullptr;
+  EXPECT_EQ(_cluster_tables(plugin), 0);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}));
+}
+
+TEST_F(ClusteringPluginTest, SkipClaimedChunks) {
+  auto plugin = ClusteringPlugin{};
+  _set_clustering_keys(plugin, "table_a.a");
+
+  // Another plugin (e.g., the MvccDeletePlugin) is rewriting chunk 1.
+  ASSERT_TRUE(_table->try_claim_chunks_for_cleanup({ChunkID{1}}));
+  EXPECT_EQ(_cluster_tables(plugin), 0);
+  EXPECT_EQ(_table->chunk_count(), 4);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    EXPECT_FALSE(_table->get_chunk(chunk_id)->get_cleanup_commit_id());
+  }
+
+  _table->release_cleanup_claims({ChunkID{1}});
+  EXPECT_EQ(_cluster_tables(plugin), 4);
+  EXPECT_EQ(_visible_row_count(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes)), 12);
+}
+
+}  // namespace hyrise
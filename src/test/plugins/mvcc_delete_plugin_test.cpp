@@ -9,6 +9,7 @@
 #include "expression/expression_functional.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "lib/utils/plugin_test_utils.hpp"
+#include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
@@ -16,6 +17,7 @@
 #include "operators/validate.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "utils/chunk_replacement.hpp"
 #include "utils/load_table.hpp"
 #include "utils/plugin_manager.hpp"
 
@@ -68,7 +70,32 @@ class MvccDeletePluginTest : public BaseTest {
   }
 
   static void _delete_chunk_physically(const std::string& table_name, ChunkID chunk_id) {
-    MvccDeletePlugin::_delete_chunk_physically(Hyrise::get().storage_manager.get_table(table_name), chunk_id);
+    auto chunks_to_delete = DeferredChunkRemoval{};
+    chunks_to_delete.add(Hyrise::get().storage_manager.get_table(table_name), chunk_id);
+    chunks_to_delete.remove_invisible_chunks();
+  }
+
+  static void _compact_mvcc_data(MvccDeletePlugin& plugin) {
+    plugin._compact_mvcc_data_loop();
+  }
+
+  static void _collect_garbage(MvccDeletePlugin& plugin) {
+    plugin._garbage_collection_loop();
+  }
+
+  static void _physical_delete(MvccDeletePlugin& plugin) {
+    plugin._physical_delete_loop();
+  }
+
+  static size_t _visible_row_count(const std::string& table_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
   }
 
   static int32_t _get_int_value_from_table(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
@@ -215,4 +242,143 @@ TEST_F(MvccDeletePluginTest, PhysicalDelete) {
   EXPECT_FALSE(table->get_chunk(chunk_to_delete_id));
 }
 
+/**
+ * This test checks the compaction of MVCC data. Chunk 0 is immutable and all of its rows are visible to the active
+ * transaction. Thus, its MVCC data is compacted. The row versions are kept until the transaction that was active
+ * during the compaction has finished.
+ */
+TEST_F(MvccDeletePluginTest, CompactMvccData) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  const auto mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  auto plugin = MvccDeletePlugin{};
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _compact_mvcc_data(plugin);
+  EXPECT_TRUE(mvcc_data->is_compacted());
+  EXPECT_TRUE(mvcc_data->has_row_versions());
+
+  _compact_mvcc_data(plugin);
+  EXPECT_TRUE(mvcc_data->has_row_versions());
+
+  auto get_table = std::make_shared<GetTable>(_table_name);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 3);
+
+  transaction_context->commit();
+  transaction_context = nullptr;
+  _compact_mvcc_data(plugin);
+  EXPECT_FALSE(mvcc_data->has_row_versions());
+
+  // Updates still invalidate the rows of the compacted chunk.
+  _increment_all_values_by_one();
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->invalid_row_count(), 3);
+  transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  get_table = std::make_shared<GetTable>(_table_name);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 3);
+}
+
+TEST_F(MvccDeletePluginTest, DoNotCompactMostlyInvalidatedChunks) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  auto plugin = MvccDeletePlugin{};
+
+  // Chunk 0 is entirely invalidated and will be consolidated by the logical delete, chunk 1 is still mutable.
+  _increment_all_values_by_one();
+  _compact_mvcc_data(plugin);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->mvcc_data()->is_compacted());
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->mvcc_data()->is_compacted());
+}
+
+/**
+ * This test checks the garbage collection. After three updates of all values, chunks 0 and 1 only contain invalidated
+ * rows and are marked for the physical delete. Rows of chunk 2 are only rewritten once no active transaction can see
+ * their invalidated rows anymore.
+ */
+TEST_F(MvccDeletePluginTest, CollectGarbage) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  auto plugin = MvccDeletePlugin{};
+
+  // --- Expected: _, _, _ | _, _, _, 3 | 4, 5
+  _increment_all_values_by_one();
+  _increment_all_values_by_one();
+  ASSERT_EQ(table->chunk_count(), 3);
+
+  // The rows invalidated by the third update are not dead as long as an older transaction is active.
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _increment_all_values_by_one();
+  // --- Expected: _, _, _ | _, _, _, _ | _, _, 4, 5 | 6
+  ASSERT_EQ(table->chunk_count(), 4);
+  _collect_garbage(plugin);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_FALSE(table->get_chunk(ChunkID{2})->get_cleanup_commit_id());
+  EXPECT_EQ(table->chunk_count(), 4);
+  transaction_context->commit();
+  transaction_context = nullptr;
+  EXPECT_EQ(_visible_row_count(_table_name), 3);
+
+  _physical_delete(plugin);
+  _physical_delete(plugin);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0}));
+  EXPECT_FALSE(table->get_chunk(ChunkID{1}));
+
+  // Now, half of the rows of chunk 2 are dead. Its valid rows are appended as a new, immutable chunk.
+  _collect_garbage(plugin);
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->get_cleanup_commit_id());
+  ASSERT_EQ(table->chunk_count(), 5);
+  const auto rewritten_chunk = table->get_chunk(ChunkID{4});
+  EXPECT_FALSE(rewritten_chunk->is_mutable());
+  ASSERT_EQ(rewritten_chunk->size(), 2);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{4}, ColumnID{0}, ChunkOffset{0}), 4);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{4}, ColumnID{0}, ChunkOffset{1}), 5);
+  EXPECT_EQ(_visible_row_count(_table_name), 3);
+}
+
+TEST_F(MvccDeletePluginTest, CollectGarbageOfCompactedMvccData) {
+  // Chunk 0 holds 1..8, of which only row 0 is deleted. That is not enough for a rewrite.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{8}, UseMvcc::Yes);
+  for (auto value = int32_t{1}; value <= 8; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->set_immutable();
+  Hyrise::get().storage_manager.add_table("gcTable", table);
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("gcTable");
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  const auto table_scan = std::make_shared<TableScan>(validate, equals_(_column_a, 1));
+  table_scan->execute();
+  const auto delete_operator = std::make_shared<Delete>(table_scan);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+  transaction_context->commit();
+  const auto delete_commit_id = transaction_context->commit_id();
+
+  auto plugin = MvccDeletePlugin{};
+  const auto mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  _compact_mvcc_data(plugin);
+  ASSERT_TRUE(mvcc_data->is_compacted());
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{0}), delete_commit_id);
+
+  // Without active transactions, the horizon is the last CommitID. The end CID of the dead row is freed.
+  const auto horizon_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  _collect_garbage(plugin);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{0}), horizon_commit_id);
+  EXPECT_EQ(_visible_row_count("gcTable"), 7);
+}
+
 }  // namespace hyrise
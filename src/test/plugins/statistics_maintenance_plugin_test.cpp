@@ -0,0 +1,158 @@
+#include <memory>
+
+#include "../../plugins/statistics_maintenance_plugin.hpp"
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/segment_sketch.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+class StatisticsMaintenancePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                     ChunkOffset{100}, UseMvcc::Yes);
+    _append_rows(100);
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+
+    Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+    Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  }
+
+ protected:
+  void _append_rows(const int32_t row_count) {
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      _table->append({value});
+    }
+  }
+
+  static size_t _update_stale_statistics(StatisticsMaintenancePlugin& plugin) {
+    return plugin._update_stale_statistics();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsMaintenancePluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseStatisticsMaintenancePlugin")));
+  EXPECT_NO_THROW(plugin_manager.exec_user_function("hyriseStatisticsMaintenancePlugin", "UpdateStaleStatistics"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseStatisticsMaintenancePlugin"));
+}
+
+TEST_F(StatisticsMaintenancePluginTest, DescriptionAndProvidedFunction) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  EXPECT_EQ(plugin.description(), "Statistics maintenance plugin");
+  const auto& provided_functions = plugin.provided_user_executable_functions();
+  ASSERT_EQ(provided_functions.size(), 1);
+  EXPECT_EQ(provided_functions.front().first, "UpdateStaleStatistics");
+}
+
+TEST_F(StatisticsMaintenancePluginTest, UpdateStatisticsAfterInserts) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  EXPECT_EQ(_update_stale_statistics(plugin), 0);
+  EXPECT_EQ(_table->table_statistics()->row_count, 100);
+
+  // Less than the minimum number of modified rows.
+  _append_rows(999);
+  EXPECT_EQ(_update_stale_statistics(plugin), 0);
+  EXPECT_EQ(_table->table_statistics()->row_count, 100);
+
+  const auto pqp = std::make_shared<TableWrapper>(_table);
+  Hyrise::get().default_pqp_cache->set("SELECT * FROM table_a", pqp);
+
+  _append_rows(1);
+  EXPECT_EQ(_update_stale_statistics(plugin), 1);
+  EXPECT_EQ(_table->table_statistics()->row_count, 1'100);
+  EXPECT_FALSE(Hyrise::get().default_pqp_cache->has("SELECT * FROM table_a"));
+
+  EXPECT_EQ(_update_stale_statistics(plugin), 0);
+}
+
+TEST_F(StatisticsMaintenancePluginTest, UpdateStatisticsAfterDeletes) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  _append_rows(9'900);
+  EXPECT_EQ(_update_stale_statistics(plugin), 1);
+  EXPECT_EQ(_table->table_statistics()->row_count, 10'000);
+
+  // Invalidate 999 rows, which is below the threshold of 10 % of the rows.
+  for (auto chunk_id = ChunkID{0}; chunk_id < 9; ++chunk_id) {
+    _table->get_chunk(chunk_id)->increase_invalid_row_count(ChunkOffset{111});
+  }
+  EXPECT_EQ(_update_stale_statistics(plugin), 0);
+
+  _table->get_chunk(ChunkID{9})->increase_invalid_row_count(ChunkOffset{1});
+  EXPECT_EQ(_update_stale_statistics(plugin), 1);
+
+  // Invalidated rows that were already considered do not make the statistics stale again.
+  EXPECT_EQ(_update_stale_statistics(plugin), 0);
+}
+
+TEST_F(StatisticsMaintenancePluginTest, UpdateStatisticsFromSketches) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  _append_rows(2'000);
+  EXPECT_EQ(_update_stale_statistics(plugin), 1);
+
+  // The sketches of immutable chunks are stored, the sketches of the mutable last chunk are not.
+  const auto chunk_count = _table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count - 1; ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->sketches());
+  }
+  EXPECT_FALSE(_table->get_chunk(ChunkID{chunk_count - 1})->sketches());
+
+  const auto table_statistics = _table->table_statistics();
+  EXPECT_EQ(table_statistics->row_count, 2'100);
+
+  const auto column_statistics =
+      std::dynamic_pointer_cast<const AttributeStatistics<int32_t>>(table_statistics->column_statistics[ColumnID{0}]);
+  ASSERT_TRUE(column_statistics);
+  ASSERT_TRUE(column_statistics->null_value_ratio);
+  EXPECT_FLOAT_EQ(column_statistics->null_value_ratio->ratio, 0.0f);
+
+  // The bins of the previous histogram (values 0 to 99) are scaled to the new counts and extended to the new maximum.
+  const auto& histogram = column_statistics->histogram;
+  ASSERT_TRUE(histogram);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 2'100.0f);
+  EXPECT_NEAR(histogram->total_distinct_count(), 2'000.0f, 100.0f);
+  EXPECT_EQ(histogram->bin_minimum(BinID{0}), 0);
+  EXPECT_EQ(histogram->bin_maximum(histogram->bin_count() - 1), 1'999);
+}
+
+TEST_F(StatisticsMaintenancePluginTest, UpdateNullValueRatioFromSketches) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}}, TableType::Data,
+                                             ChunkOffset{1'000}, UseMvcc::Yes);
+  table->append({pmr_string{"a"}});
+  Hyrise::get().storage_manager.add_table("table_b", table);
+
+  for (auto row_id = 0; row_id < 2'999; ++row_id) {
+    table->append({NULL_VALUE});
+  }
+
+  auto plugin = StatisticsMaintenancePlugin{};
+  EXPECT_EQ(_update_stale_statistics(plugin), 1);
+
+  const auto table_statistics = table->table_statistics();
+  EXPECT_EQ(table_statistics->row_count, 3'000);
+
+  const auto column_statistics = std::dynamic_pointer_cast<const AttributeStatistics<pmr_string>>(
+      table_statistics->column_statistics[ColumnID{0}]);
+  ASSERT_TRUE(column_statistics);
+  ASSERT_TRUE(column_statistics->null_value_ratio);
+  EXPECT_NEAR(column_statistics->null_value_ratio->ratio, 2'999.0f / 3'000.0f, 0.0001f);
+
+  const auto& histogram = column_statistics->histogram;
+  ASSERT_TRUE(histogram);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 1.0f);
+  EXPECT_FLOAT_EQ(histogram->total_distinct_count(), 1.0f);
+}
+
+}  // namespace hyrise